@@ -16,6 +16,17 @@
 #ifndef RAJAPerf_AppsData_HPP
 #define RAJAPerf_AppsData_HPP
 
+#include "common/RAJAPerfSuite.hpp"
+#include "common/RPTypes.hpp"
+#include "common/DataUtils.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <initializer_list>
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
 
 namespace rajaperf
 {
@@ -145,6 +156,247 @@ struct ADomain
    Index_type  n_real_zones;
 };
 
+
+//
+// AoS and AoSoA layout variants store all fields of a kernel in one array 
+// and access each field through a RAJA::View with a permuted layout. The
+// field classes below give pointer-like access (f[i], f + offset) to one
+// field, so kernel bodies and NDPTRSET run unchanged on them.
+//
+// Field classes are templated on the index type of the kernel using them,
+// like the kernel classes, so kernels instantiated with either index width
+// index fields with their own Index_type.
+//
+// AoS layout: the fields of each index are contiguous.
+//
+template <typename REAL, typename INDEX>
+class AoSField
+{
+public:
+  typedef REAL value_type;
+  typedef INDEX index_type;
+
+  AoSField(REAL* data, INDEX nfields, INDEX len, INDEX field)
+    : m_view(data, 
+             RAJA::make_permuted_layout( {nfields, len}, 
+                   RAJA::as_array<camp::idx_seq<1, 0> >::get() ) ),
+      m_field(field),
+      m_offset(0) { }
+
+  static INDEX getStorageLength(INDEX nfields, INDEX len)
+  {
+    return nfields * len;
+  }
+
+  RAJA_HOST_DEVICE
+  REAL& operator[](INDEX i) const 
+  { 
+    return m_view(m_field, i + m_offset); 
+  }
+
+  AoSField operator+(INDEX offset) const
+  {
+    AoSField shifted(*this);
+    shifted.m_offset += offset;
+    return shifted;
+  }
+
+private:
+  RAJA::View<REAL, RAJA::Layout<2> > m_view;
+  INDEX m_field;
+  INDEX m_offset;
+};
+
+//
+// AoSoA layout: indices are grouped in tiles of one data alignment unit 
+// (SIMD register or cache line) of values per field; within a tile, each
+// field's values are contiguous.
+//
+// AoSoA variants loop over tiles and over lanes within each tile, and 
+// index fields with an AoSoAField::Index, so tile and lane come from loop
+// counters rather than a division per access. An Index converts to the 
+// plain index for other arrays in kernel bodies.
+//
+template <typename REAL, typename INDEX>
+class AoSoAField
+{
+public:
+  typedef REAL value_type;
+  typedef INDEX index_type;
+
+  static const INDEX tile_width = RAJA::DATA_ALIGN / sizeof(REAL);
+
+  struct Index
+  {
+    Index(INDEX t, INDEX l) : tile(t), lane(l) { }
+
+    RAJA_HOST_DEVICE
+    operator INDEX() const { return tile * tile_width + lane; }
+
+    INDEX tile;
+    INDEX lane;
+  };
+
+  AoSoAField(REAL* data, INDEX nfields, INDEX len, INDEX field)
+    : m_view(data, 
+             RAJA::make_permuted_layout( 
+                   {nfields, getNumTiles(len), tile_width}, 
+                   RAJA::as_array<camp::idx_seq<1, 0, 2> >::get() ) ),
+      m_field(field),
+      m_offset(0),
+      m_tile_offset(0),
+      m_lane_offset(0) { }
+
+  static INDEX getNumTiles(INDEX len)
+  {
+    return (len + tile_width - 1) / tile_width;
+  }
+
+  //
+  // Lanes [lbegin, lend) of tile it whose indices are in [ibegin, iend); 
+  // tiles getTile(ibegin) through getNumTiles(iend) - 1 cover the range.
+  //
+  template <typename I>
+  static I getTile(I i)
+  {
+    return i / tile_width;
+  }
+
+  template <typename I>
+  static void getLanes(I it, I ibegin, I iend, I& lbegin, I& lend)
+  {
+    const I tbase = it * tile_width;
+    lbegin = ( ibegin > tbase ? ibegin - tbase : 0 );
+    lend = ( iend - tbase < tile_width ? iend - tbase : tile_width );
+  }
+
+  static INDEX getStorageLength(INDEX nfields, INDEX len)
+  {
+    return nfields * getNumTiles(len) * tile_width;
+  }
+
+  RAJA_HOST_DEVICE
+  REAL& operator[](INDEX i) const 
+  { 
+    const INDEX j = i + m_offset;
+    return m_view(m_field, j / tile_width, j % tile_width); 
+  }
+
+  RAJA_HOST_DEVICE
+  REAL& operator[](const Index& i) const 
+  { 
+    const INDEX lane = i.lane + m_lane_offset;
+    const INDEX carry = ( lane >= tile_width ? 1 : 0 );
+    return m_view(m_field, i.tile + m_tile_offset + carry, 
+                  lane - carry * tile_width); 
+  }
+
+  //
+  // Offset is split into whole tiles and lanes here, once, so that 
+  // accesses with an Index only carry a lane over into the next tile.
+  //
+  AoSoAField operator+(INDEX offset) const
+  {
+    AoSoAField shifted(*this);
+    shifted.m_offset += offset;
+    shifted.m_tile_offset = shifted.m_offset / tile_width;
+    shifted.m_lane_offset = shifted.m_offset % tile_width;
+    if ( shifted.m_lane_offset < 0 ) {
+      shifted.m_tile_offset -= 1;
+      shifted.m_lane_offset += tile_width;
+    }
+    return shifted;
+  }
+
+private:
+  RAJA::View<REAL, RAJA::Layout<3> > m_view;
+  INDEX m_field;
+  INDEX m_offset;
+  INDEX m_tile_offset;
+  INDEX m_lane_offset;
+};
+
+template <typename REAL, typename INDEX>
+const INDEX AoSoAField<REAL, INDEX>::tile_width;
+
+inline bool isAoSVariant(VariantID vid)
+{
+  return ( vid == Base_Seq_AoS || vid == RAJA_Seq_AoS );
+}
+
+inline bool isAoSoAVariant(VariantID vid)
+{
+  return ( vid == Base_Seq_AoSoA || vid == RAJA_Seq_AoSoA );
+}
+
+//
+// Allocate multi-field array for given field layout and copy field arrays 
+// (each of length len) into it; fields are numbered in the order given.
+//
+template <typename FIELD, typename REAL>
+void allocAndPackFields(REAL*& data, std::initializer_list<REAL*> fields,
+                        typename FIELD::index_type len, VariantID vid)
+{
+  typedef typename FIELD::index_type INDEX;
+
+  const INDEX nfields = fields.size();
+  allocAndInitData(data, FIELD::getStorageLength(nfields, len), vid);
+
+  INDEX ifield = 0;
+  for (REAL* src : fields) {
+    FIELD dst(data, nfields, len, ifield++);
+    for (INDEX i = 0; i < len; ++i) {
+      dst[i] = src[i];
+    }
+  }
+}
+
+//
+// Copy one field of multi-field array back to its field array.
+//
+template <typename FIELD, typename REAL>
+void unpackField(REAL* dst, const FIELD& src, 
+                 typename FIELD::index_type len)
+{
+  for (typename FIELD::index_type i = 0; i < len; ++i) {
+    dst[i] = src[i];
+  }
+}
+
+
+#if defined(RAJA_ENABLE_OPENMP)
+//
+// RAJA_OpenMP_Simd variants run loops over an index set holding one 
+// contiguous range segment per OpenMP thread; segments run in parallel 
+// and each segment runs as a SIMD loop.
+//
+typedef RAJA::TypedIndexSet<RAJA::RangeSegment> OpenMPSimdISet;
+
+typedef RAJA::ExecPolicy<RAJA::omp_parallel_for_segit, 
+                         RAJA::simd_exec> omp_parallel_simd_exec;
+
+//
+// Each segment gets len / nseg indices, and the first len % nseg segments
+// get one more. Bounds are computed without forming len * is, which 
+// overflows the index type for large ranges.
+//
+template <typename INDEX>
+void makeOpenMPSimdISet(OpenMPSimdISet& iset, INDEX ibegin, INDEX iend)
+{
+  const INDEX nseg = omp_get_max_threads();
+  const INDEX len = iend - ibegin;
+  const INDEX seglen = len / nseg;
+  const INDEX nlong = len % nseg;
+  for (INDEX is = 0; is < nseg; ++is) {
+    const INDEX sbegin = ibegin + is * seglen + RAJA_MIN(is, nlong);
+    const INDEX send = sbegin + seglen + ( is < nlong ? 1 : 0 );
+    if ( send > sbegin ) {
+      iset.push_back( RAJA::RangeSegment(sbegin, send) );
+    }
+  }
+}
+#endif
+
 } // end namespace apps
 } // end namespace rajaperf
 
@@ -91,7 +91,7 @@ namespace apps
   Real_type fyi = half * ( fy1[i] + fy2[i] - fy3[i] - fy4[i] ) ; \
   Real_type fyj = half * ( fy2[i] + fy3[i] - fy4[i] - fy1[i] ) ; \
  \
-  Real_type rarea  = 1.0 / ( xi * yj - xj * yi + ptiny ) ; \
+  Real_type rarea  = Real_type(1.0) / ( xi * yj - xj * yi + ptiny ) ; \
  \
   Real_type dfxdx  = rarea * ( fxi * yj - fxj * yi ) ; \
  \
@@ -102,6 +102,19 @@ namespace apps
  \
   div[i] = dfxdx + dfydy + affine ;
 
+//
+// Prefetch entries that DEL_DOT_VEC_2D_BODY uses for zone iz, which 
+// *_Prefetch variants get from real_zones ahead of the loop. Corner 
+// pointers v1 and v2 are one entry past v4 and v3 (see NDSET2D), so only
+// lines of v4 and v3 are prefetched.
+//
+#define DEL_DOT_VEC_2D_PREFETCH(iz) \
+  RAJAPERF_PREFETCH(&x4[iz]);  RAJAPERF_PREFETCH(&x3[iz]); \
+  RAJAPERF_PREFETCH(&y4[iz]);  RAJAPERF_PREFETCH(&y3[iz]); \
+  RAJAPERF_PREFETCH(&fx4[iz]); RAJAPERF_PREFETCH(&fx3[iz]); \
+  RAJAPERF_PREFETCH(&fy4[iz]); RAJAPERF_PREFETCH(&fy3[iz]); \
+  RAJAPERF_PREFETCH_W(&div[iz]);
+
 
 #if defined(RAJA_ENABLE_CUDA)
 
@@ -166,28 +179,57 @@ __global__ void deldotvec2d(Real_ptr div,
 #endif // if defined(RAJA_ENABLE_CUDA)
 
 
-DEL_DOT_VEC_2D::DEL_DOT_VEC_2D(const RunParams& params)
+template <typename REAL, typename INDEX>
+DEL_DOT_VEC_2D<REAL, INDEX>::DEL_DOT_VEC_2D(const RunParams& params)
   : KernelBase(rajaperf::Apps_DEL_DOT_VEC_2D, params)
 {
   setDefaultSize(312);  // See rzmax in ADomain struct
   setDefaultReps(1050);
 
+#if defined(RAJA_ENABLE_OPENMP)
+  setVariantDefined(Base_OpenMP_Simd);
+  setVariantDefined(RAJA_OpenMP_Simd);
+  setVariantDefined(Base_OpenMP_Sched);
+#endif
+
+  setVariantDefined(Base_Seq_Prefetch);
+  setVariantDefined(RAJA_Seq_Prefetch);
+#if defined(RAJA_ENABLE_OPENMP)
+  setVariantDefined(Base_OpenMP_Prefetch);
+  setVariantDefined(RAJA_OpenMP_Prefetch);
+#endif
+
   m_domain = new ADomain(getRunSize(), /* ndims = */ 2);
 }
 
-DEL_DOT_VEC_2D::~DEL_DOT_VEC_2D() 
+template <typename REAL, typename INDEX>
+DEL_DOT_VEC_2D<REAL, INDEX>::~DEL_DOT_VEC_2D() 
 {
   delete m_domain;
 }
 
-Index_type DEL_DOT_VEC_2D::getItsPerRep() const 
+template <typename REAL, typename INDEX>
+Index_type DEL_DOT_VEC_2D<REAL, INDEX>::getItsPerRep() const 
 { 
   return m_domain->n_real_zones;
 }
 
-void DEL_DOT_VEC_2D::setUp(VariantID vid)
+template <typename REAL, typename INDEX>
+double DEL_DOT_VEC_2D<REAL, INDEX>::getBytesPerRep() const
+{
+  return ( sizeof(Index_type) + 5.0 * sizeof(Real_type) ) * getItsPerRep();
+}
+
+template <typename REAL, typename INDEX>
+double DEL_DOT_VEC_2D<REAL, INDEX>::getFLOPsPerRep() const
 {
-  int max_loop_index = m_domain->nnalls;
+  return 54.0 * getItsPerRep();
+}
+
+template <typename REAL, typename INDEX>
+void DEL_DOT_VEC_2D<REAL, INDEX>::setUp(VariantID vid)
+{
+  Index_type max_loop_index = m_domain->nnalls;
 
   allocAndInitData(m_x, max_loop_index, vid);
   allocAndInitData(m_y, max_loop_index, vid);
@@ -199,9 +241,10 @@ void DEL_DOT_VEC_2D::setUp(VariantID vid)
   m_half = 0.5;
 }
 
-void DEL_DOT_VEC_2D::runKernel(VariantID vid)
+template <typename REAL, typename INDEX>
+void DEL_DOT_VEC_2D<REAL, INDEX>::runKernel(VariantID vid)
 {
-  const Index_type run_reps = getRunReps();
+  const Index_type run_reps = getBatchReps();
   const Index_type ibegin = 0;
   const Index_type iend = m_domain->n_real_zones;
 
@@ -242,7 +285,110 @@ void DEL_DOT_VEC_2D::runKernel(VariantID vid)
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         RAJA::forall<RAJA::simd_exec>(
-          RAJA::RangeSegment(ibegin, iend), [=](int ii) {
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type ii) {
+          DEL_DOT_VEC_2D_BODY;
+        }); 
+
+      }
+      stopTimer(); 
+
+      break;
+    }
+
+    case Base_Simd : {
+
+      DEL_DOT_VEC_2D_DATA;
+
+      NDSET2D(m_domain->jp, x,x1,x2,x3,x4) ;
+      NDSET2D(m_domain->jp, y,y1,y2,y3,y4) ;
+      NDSET2D(m_domain->jp, xdot,fx1,fx2,fx3,fx4) ;
+      NDSET2D(m_domain->jp, ydot,fy1,fy2,fy3,fy4) ;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJAPERF_SIMD
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          DEL_DOT_VEC_2D_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Simd : {
+
+      DEL_DOT_VEC_2D_DATA;
+
+      NDSET2D(m_domain->jp, x,x1,x2,x3,x4) ;
+      NDSET2D(m_domain->jp, y,y1,y2,y3,y4) ;
+      NDSET2D(m_domain->jp, xdot,fx1,fx2,fx3,fx4) ;
+      NDSET2D(m_domain->jp, ydot,fy1,fy2,fy3,fy4) ;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type ii) {
+          DEL_DOT_VEC_2D_BODY;
+        }); 
+
+      }
+      stopTimer(); 
+
+      break;
+    }
+
+    case Base_Seq_Prefetch : {
+
+      DEL_DOT_VEC_2D_DATA;
+
+      NDSET2D(m_domain->jp, x,x1,x2,x3,x4) ;
+      NDSET2D(m_domain->jp, y,y1,y2,y3,y4) ;
+      NDSET2D(m_domain->jp, xdot,fx1,fx2,fx3,fx4) ;
+      NDSET2D(m_domain->jp, ydot,fy1,fy2,fy3,fy4) ;
+
+      const Index_type dist = getPrefetchDistance();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          if ( dist > 0 && ii + dist < iend ) {
+            const Index_type iz = real_zones[ii + dist];
+            DEL_DOT_VEC_2D_PREFETCH(iz);
+          }
+          DEL_DOT_VEC_2D_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    } 
+
+    case RAJA_Seq_Prefetch : {
+
+      DEL_DOT_VEC_2D_DATA;
+
+      NDSET2D(m_domain->jp, x,x1,x2,x3,x4) ;
+      NDSET2D(m_domain->jp, y,y1,y2,y3,y4) ;
+      NDSET2D(m_domain->jp, xdot,fx1,fx2,fx3,fx4) ;
+      NDSET2D(m_domain->jp, ydot,fy1,fy2,fy3,fy4) ;
+
+      const Index_type dist = getPrefetchDistance();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type ii) {
+          if ( dist > 0 && ii + dist < iend ) {
+            const Index_type iz = real_zones[ii + dist];
+            DEL_DOT_VEC_2D_PREFETCH(iz);
+          }
           DEL_DOT_VEC_2D_BODY;
         }); 
 
@@ -252,6 +398,30 @@ void DEL_DOT_VEC_2D::runKernel(VariantID vid)
       break;
     }
 
+    case Base_ThreadPool : {
+
+      DEL_DOT_VEC_2D_DATA;
+
+      NDSET2D(m_domain->jp, x,x1,x2,x3,x4) ;
+      NDSET2D(m_domain->jp, y,y1,y2,y3,y4) ;
+      NDSET2D(m_domain->jp, xdot,fx1,fx2,fx3,fx4) ;
+      NDSET2D(m_domain->jp, ydot,fy1,fy2,fy3,fy4) ;
+
+      ThreadPool& pool = getThreadPool();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        pool.forall(ibegin, iend, [=](Index_type ii) {
+          DEL_DOT_VEC_2D_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
 #if defined(RAJA_ENABLE_OPENMP)      
     case Base_OpenMP : {
 
@@ -289,7 +459,56 @@ void DEL_DOT_VEC_2D::runKernel(VariantID vid)
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         RAJA::forall<RAJA::omp_parallel_for_exec>(
-          RAJA::RangeSegment(ibegin, iend), [=](int ii) {
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type ii) {
+          DEL_DOT_VEC_2D_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_OpenMP_Simd : {
+
+      DEL_DOT_VEC_2D_DATA;
+
+      NDSET2D(m_domain->jp, x,x1,x2,x3,x4) ;
+      NDSET2D(m_domain->jp, y,y1,y2,y3,y4) ;
+      NDSET2D(m_domain->jp, xdot,fx1,fx2,fx3,fx4) ;
+      NDSET2D(m_domain->jp, ydot,fy1,fy2,fy3,fy4) ;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for simd
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          DEL_DOT_VEC_2D_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP_Simd : {
+
+      DEL_DOT_VEC_2D_DATA;
+
+      NDSET2D(m_domain->jp, x,x1,x2,x3,x4) ;
+      NDSET2D(m_domain->jp, y,y1,y2,y3,y4) ;
+      NDSET2D(m_domain->jp, xdot,fx1,fx2,fx3,fx4) ;
+      NDSET2D(m_domain->jp, ydot,fy1,fy2,fy3,fy4) ;
+
+      OpenMPSimdISet iset;
+      makeOpenMPSimdISet(iset, ibegin, iend);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<omp_parallel_simd_exec>(
+          iset, [=](Index_type ii) {
           DEL_DOT_VEC_2D_BODY;
         });
 
@@ -299,6 +518,105 @@ void DEL_DOT_VEC_2D::runKernel(VariantID vid)
       break;
     }
 
+    case Base_OpenMP_Sched : {
+
+      DEL_DOT_VEC_2D_DATA;
+
+      NDSET2D(m_domain->jp, x,x1,x2,x3,x4) ;
+      NDSET2D(m_domain->jp, y,y1,y2,y3,y4) ;
+      NDSET2D(m_domain->jp, xdot,fx1,fx2,fx3,fx4) ;
+      NDSET2D(m_domain->jp, ydot,fy1,fy2,fy3,fy4) ;
+
+      const OpenMPSchedule& sched = getOpenMPSchedule();
+      const int grain = getTaskloopGrainsize(sched, iend - ibegin);
+      setOpenMPRuntimeSchedule(sched);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if ( sched.kind == TaskloopSchedule ) {
+
+          #pragma omp parallel
+          #pragma omp single
+          {
+            #pragma omp taskloop grainsize(grain)
+            for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+              DEL_DOT_VEC_2D_BODY;
+            }
+          }
+
+        } else {
+
+          #pragma omp parallel for schedule(runtime)
+          for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+            DEL_DOT_VEC_2D_BODY;
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_OpenMP_Prefetch : {
+
+      DEL_DOT_VEC_2D_DATA;
+
+      NDSET2D(m_domain->jp, x,x1,x2,x3,x4) ;
+      NDSET2D(m_domain->jp, y,y1,y2,y3,y4) ;
+      NDSET2D(m_domain->jp, xdot,fx1,fx2,fx3,fx4) ;
+      NDSET2D(m_domain->jp, ydot,fy1,fy2,fy3,fy4) ;
+
+      const Index_type dist = getPrefetchDistance();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for 
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          if ( dist > 0 && ii + dist < iend ) {
+            const Index_type iz = real_zones[ii + dist];
+            DEL_DOT_VEC_2D_PREFETCH(iz);
+          }
+          DEL_DOT_VEC_2D_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    } 
+
+    case RAJA_OpenMP_Prefetch : {
+
+      DEL_DOT_VEC_2D_DATA;
+
+      NDSET2D(m_domain->jp, x,x1,x2,x3,x4) ;
+      NDSET2D(m_domain->jp, y,y1,y2,y3,y4) ;
+      NDSET2D(m_domain->jp, xdot,fx1,fx2,fx3,fx4) ;
+      NDSET2D(m_domain->jp, ydot,fy1,fy2,fy3,fy4) ;
+
+      const Index_type dist = getPrefetchDistance();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type ii) {
+          if ( dist > 0 && ii + dist < iend ) {
+            const Index_type iz = real_zones[ii + dist];
+            DEL_DOT_VEC_2D_PREFETCH(iz);
+          }
+          DEL_DOT_VEC_2D_BODY;
+        }); 
+
+      }
+      stopTimer(); 
+
+      break;
+    }
 
 #if defined(RAJA_ENABLE_TARGET_OPENMP)                     
 
@@ -308,9 +626,9 @@ void DEL_DOT_VEC_2D::runKernel(VariantID vid)
 
       DEL_DOT_VEC_2D_DATA;
 
-      int n=m_domain->nnalls;
-      int nn=m_domain->n_real_zones;
-      int jp=m_domain->jp;
+      Index_type n = m_domain->nnalls;
+      Index_type nn = m_domain->n_real_zones;
+      Index_type jp = m_domain->jp;
 
       #pragma omp target enter data map(to:x[0:n],y[0:n],xdot[0:n],ydot[0:n],div[0:n],real_zones[0:nn], \
           ptiny, half, jp )
@@ -349,9 +667,9 @@ void DEL_DOT_VEC_2D::runKernel(VariantID vid)
 
       DEL_DOT_VEC_2D_DATA;
 
-      int n=m_domain->nnalls;
-      int nn=m_domain->n_real_zones;
-      int jp=m_domain->jp;
+      Index_type n = m_domain->nnalls;
+      Index_type nn = m_domain->n_real_zones;
+      Index_type jp = m_domain->jp;
 
       #pragma omp target enter data map(to:x[0:n],y[0:n],xdot[0:n],ydot[0:n],div[0:n],real_zones[0:nn], \
           ptiny, half, jp )
@@ -391,6 +709,56 @@ void DEL_DOT_VEC_2D::runKernel(VariantID vid)
 #endif //RAJA_ENABLE_TARGET_OPENMP
 #endif //RAJA_ENABLE_OMP                             
 
+#if defined(RAJA_ENABLE_TBB)
+    case Base_TBB : {
+
+      DEL_DOT_VEC_2D_DATA;
+
+      NDSET2D(m_domain->jp, x,x1,x2,x3,x4) ;
+      NDSET2D(m_domain->jp, y,y1,y2,y3,y4) ;
+      NDSET2D(m_domain->jp, xdot,fx1,fx2,fx3,fx4) ;
+      NDSET2D(m_domain->jp, ydot,fy1,fy2,fy3,fy4) ;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(ibegin, iend),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type ii = r.begin(); ii < r.end(); ++ii ) {
+            DEL_DOT_VEC_2D_BODY;
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_TBB : {
+
+      DEL_DOT_VEC_2D_DATA;
+
+      NDSET2D(m_domain->jp, x,x1,x2,x3,x4) ;
+      NDSET2D(m_domain->jp, y,y1,y2,y3,y4) ;
+      NDSET2D(m_domain->jp, xdot,fx1,fx2,fx3,fx4) ;
+      NDSET2D(m_domain->jp, ydot,fy1,fy2,fy3,fy4) ;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::tbb_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type ii) {
+          DEL_DOT_VEC_2D_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
     case Base_CUDA : {
 
@@ -456,12 +824,14 @@ void DEL_DOT_VEC_2D::runKernel(VariantID vid)
   }
 }
 
-void DEL_DOT_VEC_2D::updateChecksum(VariantID vid)
+template <typename REAL, typename INDEX>
+void DEL_DOT_VEC_2D<REAL, INDEX>::updateChecksum(VariantID vid)
 {
   checksum[vid] += calcChecksum(m_div, getRunSize());
 }
 
-void DEL_DOT_VEC_2D::tearDown(VariantID vid)
+template <typename REAL, typename INDEX>
+void DEL_DOT_VEC_2D<REAL, INDEX>::tearDown(VariantID vid)
 {
   (void) vid;
 
@@ -472,5 +842,7 @@ void DEL_DOT_VEC_2D::tearDown(VariantID vid)
   deallocData(m_div);
 }
 
+RAJAPERF_INSTANTIATE_KERNEL(DEL_DOT_VEC_2D);
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -28,15 +28,20 @@ namespace apps
 {
 struct ADomain;
 
+template <typename REAL, typename INDEX>
 class DEL_DOT_VEC_2D : public KernelBase
 {
 public:
+  RAJAPERF_REAL_TYPES(REAL);
+  RAJAPERF_INDEX_TYPES(INDEX);
 
   DEL_DOT_VEC_2D(const RunParams& params);
 
   ~DEL_DOT_VEC_2D();
 
-  Index_type getItsPerRep() const;
+  rajaperf::Index_type getItsPerRep() const;
+  double getBytesPerRep() const;
+  double getFLOPsPerRep() const;
 
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
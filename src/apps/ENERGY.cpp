@@ -93,6 +93,7 @@
 
 #include "ENERGY.hpp"
 
+#include "AppsData.hpp"
 #include "common/DataUtils.hpp"
 
 #include "RAJA/RAJA.hpp"
@@ -127,15 +128,15 @@ namespace apps
 
 
 #define ENERGY_BODY1 \
-  e_new[i] = e_old[i] - 0.5 * delvc[i] * \
-             (p_old[i] + q_old[i]) + 0.5 * work[i];
+  e_new[i] = e_old[i] - Real_type(0.5) * delvc[i] * \
+             (p_old[i] + q_old[i]) + Real_type(0.5) * work[i];
 
 #define ENERGY_BODY2 \
   if ( delvc[i] > 0.0 ) { \
      q_new[i] = 0.0 ; \
   } \
   else { \
-     Real_type vhalf = 1.0 / (1.0 + compHalfStep[i]) ; \
+     Real_type vhalf = Real_type(1.0) / (Real_type(1.0) + compHalfStep[i]) ; \
      Real_type ssc = ( pbvc[i] * e_new[i] \
         + vhalf * vhalf * bvc[i] * pHalfStep[i] ) / rho0 ; \
      if ( ssc <= 0.1111111e-36 ) { \
@@ -147,12 +148,12 @@ namespace apps
   }
 
 #define ENERGY_BODY3 \
-  e_new[i] = e_new[i] + 0.5 * delvc[i] \
-             * ( 3.0*(p_old[i] + q_old[i]) \
-                 - 4.0*(pHalfStep[i] + q_new[i])) ;
+  e_new[i] = e_new[i] + Real_type(0.5) * delvc[i] \
+             * ( Real_type(3.0)*(p_old[i] + q_old[i]) \
+                 - Real_type(4.0)*(pHalfStep[i] + q_new[i])) ;
 
 #define ENERGY_BODY4 \
-  e_new[i] += 0.5 * work[i]; \
+  e_new[i] += Real_type(0.5) * work[i]; \
   if ( fabs(e_new[i]) < e_cut ) { e_new[i] = 0.0  ; } \
   if ( e_new[i]  < emin ) { e_new[i] = emin ; }
 
@@ -171,9 +172,9 @@ namespace apps
      } \
      q_tilde = (ssc*ql_old[i] + qq_old[i]) ; \
   } \
-  e_new[i] = e_new[i] - ( 7.0*(p_old[i] + q_old[i]) \
-                         - 8.0*(pHalfStep[i] + q_new[i]) \
-                         + (p_new[i] + q_tilde)) * delvc[i] / 6.0 ; \
+  e_new[i] = e_new[i] - ( Real_type(7.0)*(p_old[i] + q_old[i]) \
+                         - Real_type(8.0)*(pHalfStep[i] + q_new[i]) \
+                         + (p_new[i] + q_tilde)) * delvc[i] / Real_type(6.0) ; \
   if ( fabs(e_new[i]) < e_cut ) { \
      e_new[i] = 0.0  ; \
   } \
@@ -194,6 +195,56 @@ namespace apps
      if (fabs(q_new[i]) < q_cut) q_new[i] = 0.0 ; \
   }
 
+//
+// Each loop body reads and writes only entry i of each array, so fused 
+// variants run all of them in one loop.
+//
+#define ENERGY_BODY_FUSED \
+  ENERGY_BODY1; \
+  ENERGY_BODY2; \
+  ENERGY_BODY3; \
+  ENERGY_BODY4; \
+  ENERGY_BODY5; \
+  ENERGY_BODY6;
+
+
+//
+// AoS and AoSoA layout variants hold all per-zone fields in one array.
+//
+#define ENERGY_DATA_SETUP_LAYOUT(FIELD) \
+  const Index_type nzones = getRunSize(); \
+  Real_ptr fields; \
+  allocAndPackFields<FIELD>(fields, \
+    {m_e_new, m_e_old, m_delvc, m_p_new, m_p_old, m_q_new, m_q_old, \
+     m_work, m_compHalfStep, m_pHalfStep, m_bvc, m_pbvc, \
+     m_ql_old, m_qq_old, m_vnewc}, nzones, vid); \
+\
+  FIELD e_new(fields, 15, nzones, 0); \
+  FIELD e_old(fields, 15, nzones, 1); \
+  FIELD delvc(fields, 15, nzones, 2); \
+  FIELD p_new(fields, 15, nzones, 3); \
+  FIELD p_old(fields, 15, nzones, 4); \
+  FIELD q_new(fields, 15, nzones, 5); \
+  FIELD q_old(fields, 15, nzones, 6); \
+  FIELD work(fields, 15, nzones, 7); \
+  FIELD compHalfStep(fields, 15, nzones, 8); \
+  FIELD pHalfStep(fields, 15, nzones, 9); \
+  FIELD bvc(fields, 15, nzones, 10); \
+  FIELD pbvc(fields, 15, nzones, 11); \
+  FIELD ql_old(fields, 15, nzones, 12); \
+  FIELD qq_old(fields, 15, nzones, 13); \
+  FIELD vnewc(fields, 15, nzones, 14); \
+  const Real_type rho0 = m_rho0; \
+  const Real_type e_cut = m_e_cut; \
+  const Real_type emin = m_emin; \
+  const Real_type q_cut = m_q_cut;
+
+#define ENERGY_DATA_TEARDOWN_LAYOUT \
+  unpackField(m_e_new, e_new, nzones); \
+  unpackField(m_q_new, q_new, nzones); \
+  deallocData(fields);
+
+
 #if defined(RAJA_ENABLE_CUDA)
 
   //
@@ -334,18 +385,64 @@ __global__ void energycalc6(Real_ptr delvc,
 #endif // if defined(RAJA_ENABLE_CUDA)
 
 
-ENERGY::ENERGY(const RunParams& params)
+template <typename REAL, typename INDEX>
+ENERGY<REAL, INDEX>::ENERGY(const RunParams& params)
   : KernelBase(rajaperf::Apps_ENERGY, params)
 {
   setDefaultSize(100000);
   setDefaultReps(1300);
+
+#if defined(RAJA_ENABLE_OPENMP)
+  setVariantDefined(Base_OpenMP_Simd);
+  setVariantDefined(RAJA_OpenMP_Simd);
+#endif
+
+  setVariantDefined(Base_Seq_AoS);
+  setVariantDefined(RAJA_Seq_AoS);
+  setVariantDefined(Base_Seq_AoSoA);
+  setVariantDefined(RAJA_Seq_AoSoA);
+
+  setVariantDefined(Base_Seq_Fused);
+  setVariantDefined(RAJA_Seq_Fused);
+#if defined(RAJA_ENABLE_OPENMP)
+  setVariantDefined(Base_OpenMP_Fused);
+  setVariantDefined(RAJA_OpenMP_Fused);
+  setVariantDefined(Base_OpenMP_Region);
+  setVariantDefined(RAJA_OpenMP_Region);
+#endif
+}
+
+template <typename REAL, typename INDEX>
+ENERGY<REAL, INDEX>::~ENERGY() 
+{
+}
+
+template <typename REAL, typename INDEX>
+double ENERGY<REAL, INDEX>::getBytesPerRep() const
+{
+  return 47.0 * sizeof(Real_type) * getRunSize();
+}
+
+template <typename REAL, typename INDEX>
+double ENERGY<REAL, INDEX>::getFusedBytesPerRep() const
+{
+  return 15.0 * sizeof(Real_type) * getRunSize();
+}
+
+template <typename REAL, typename INDEX>
+int ENERGY<REAL, INDEX>::getLoopsPerRep() const
+{
+  return 6;
 }
 
-ENERGY::~ENERGY() 
+template <typename REAL, typename INDEX>
+double ENERGY<REAL, INDEX>::getFLOPsPerRep() const
 {
+  return 55.0 * getRunSize();
 }
 
-void ENERGY::setUp(VariantID vid)
+template <typename REAL, typename INDEX>
+void ENERGY<REAL, INDEX>::setUp(VariantID vid)
 {
   allocAndInitData(m_e_new, getRunSize(), vid);
   allocAndInitData(m_e_old, getRunSize(), vid);
@@ -369,9 +466,10 @@ void ENERGY::setUp(VariantID vid)
   initData(m_q_cut);
 }
 
-void ENERGY::runKernel(VariantID vid)
+template <typename REAL, typename INDEX>
+void ENERGY<REAL, INDEX>::runKernel(VariantID vid)
 {
-  const Index_type run_reps = getRunReps();
+  const Index_type run_reps = getBatchReps();
   const Index_type ibegin = 0;
   const Index_type iend = getRunSize();
 
@@ -422,32 +520,118 @@ void ENERGY::runKernel(VariantID vid)
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         RAJA::forall<RAJA::simd_exec>(
-          RAJA::RangeSegment(ibegin, iend), [=](int i) {
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          ENERGY_BODY1;
+        }); 
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          ENERGY_BODY2;
+        }); 
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          ENERGY_BODY3;
+        }); 
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          ENERGY_BODY4;
+        }); 
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          ENERGY_BODY5;
+        }); 
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          ENERGY_BODY6;
+        }); 
+
+      }
+      stopTimer(); 
+
+      break;
+    }
+
+    case Base_Simd : {
+
+      ENERGY_DATA;
+  
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY1;
+        }
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY2;
+        }
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY3;
+        }
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY4;
+        }
+  
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY5;
+        }
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY6;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Simd : {
+
+      ENERGY_DATA;
+ 
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           ENERGY_BODY1;
         }); 
 
         RAJA::forall<RAJA::simd_exec>(
-          RAJA::RangeSegment(ibegin, iend), [=](int i) {
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           ENERGY_BODY2;
         }); 
 
         RAJA::forall<RAJA::simd_exec>(
-          RAJA::RangeSegment(ibegin, iend), [=](int i) {
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           ENERGY_BODY3;
         }); 
 
         RAJA::forall<RAJA::simd_exec>(
-          RAJA::RangeSegment(ibegin, iend), [=](int i) {
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           ENERGY_BODY4;
         }); 
 
         RAJA::forall<RAJA::simd_exec>(
-          RAJA::RangeSegment(ibegin, iend), [=](int i) {
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           ENERGY_BODY5;
         }); 
 
         RAJA::forall<RAJA::simd_exec>(
-          RAJA::RangeSegment(ibegin, iend), [=](int i) {
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           ENERGY_BODY6;
         }); 
 
@@ -457,6 +641,308 @@ void ENERGY::runKernel(VariantID vid)
       break;
     }
 
+    case Base_Seq_AoS : {
+
+      typedef AoSField<Real_type, Index_type> Field;
+      ENERGY_DATA_SETUP_LAYOUT(Field);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY1;
+        }
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY2;
+        }
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY3;
+        }
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY4;
+        }
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY5;
+        }
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY6;
+        }
+
+      }
+      stopTimer();
+
+      ENERGY_DATA_TEARDOWN_LAYOUT;
+
+      break;
+    }
+
+    case RAJA_Seq_AoS : {
+
+      typedef AoSField<Real_type, Index_type> Field;
+      ENERGY_DATA_SETUP_LAYOUT(Field);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          ENERGY_BODY1;
+        }); 
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          ENERGY_BODY2;
+        }); 
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          ENERGY_BODY3;
+        }); 
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          ENERGY_BODY4;
+        }); 
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          ENERGY_BODY5;
+        }); 
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          ENERGY_BODY6;
+        }); 
+
+      }
+      stopTimer();
+
+      ENERGY_DATA_TEARDOWN_LAYOUT;
+
+      break;
+    }
+
+    case Base_Seq_AoSoA : {
+
+      typedef AoSoAField<Real_type, Index_type> Field;
+      ENERGY_DATA_SETUP_LAYOUT(Field);
+
+      typedef typename Field::Index AoSoAIndex;
+      const Index_type tbegin = Field::getTile(ibegin);
+      const Index_type tend = Field::getNumTiles(iend);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type it = tbegin; it < tend; ++it ) {
+          Index_type lbegin, lend;
+          Field::getLanes(it, ibegin, iend, lbegin, lend);
+          for (AoSoAIndex i(it, lbegin); i.lane < lend; ++i.lane ) {
+            ENERGY_BODY1;
+          }
+        }
+
+        for (Index_type it = tbegin; it < tend; ++it ) {
+          Index_type lbegin, lend;
+          Field::getLanes(it, ibegin, iend, lbegin, lend);
+          for (AoSoAIndex i(it, lbegin); i.lane < lend; ++i.lane ) {
+            ENERGY_BODY2;
+          }
+        }
+
+        for (Index_type it = tbegin; it < tend; ++it ) {
+          Index_type lbegin, lend;
+          Field::getLanes(it, ibegin, iend, lbegin, lend);
+          for (AoSoAIndex i(it, lbegin); i.lane < lend; ++i.lane ) {
+            ENERGY_BODY3;
+          }
+        }
+
+        for (Index_type it = tbegin; it < tend; ++it ) {
+          Index_type lbegin, lend;
+          Field::getLanes(it, ibegin, iend, lbegin, lend);
+          for (AoSoAIndex i(it, lbegin); i.lane < lend; ++i.lane ) {
+            ENERGY_BODY4;
+          }
+        }
+
+        for (Index_type it = tbegin; it < tend; ++it ) {
+          Index_type lbegin, lend;
+          Field::getLanes(it, ibegin, iend, lbegin, lend);
+          for (AoSoAIndex i(it, lbegin); i.lane < lend; ++i.lane ) {
+            ENERGY_BODY5;
+          }
+        }
+
+        for (Index_type it = tbegin; it < tend; ++it ) {
+          Index_type lbegin, lend;
+          Field::getLanes(it, ibegin, iend, lbegin, lend);
+          for (AoSoAIndex i(it, lbegin); i.lane < lend; ++i.lane ) {
+            ENERGY_BODY6;
+          }
+        }
+
+      }
+      stopTimer();
+
+      ENERGY_DATA_TEARDOWN_LAYOUT;
+
+      break;
+    }
+
+    case RAJA_Seq_AoSoA : {
+
+      typedef AoSoAField<Real_type, Index_type> Field;
+      ENERGY_DATA_SETUP_LAYOUT(Field);
+
+      typedef typename Field::Index AoSoAIndex;
+      const Index_type tbegin = Field::getTile(ibegin);
+      const Index_type tend = Field::getNumTiles(iend);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(tbegin, tend), [=](Index_type it) {
+          Index_type lbegin, lend;
+          Field::getLanes(it, ibegin, iend, lbegin, lend);
+          for (AoSoAIndex i(it, lbegin); i.lane < lend; ++i.lane ) {
+            ENERGY_BODY1;
+          }
+        }); 
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(tbegin, tend), [=](Index_type it) {
+          Index_type lbegin, lend;
+          Field::getLanes(it, ibegin, iend, lbegin, lend);
+          for (AoSoAIndex i(it, lbegin); i.lane < lend; ++i.lane ) {
+            ENERGY_BODY2;
+          }
+        }); 
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(tbegin, tend), [=](Index_type it) {
+          Index_type lbegin, lend;
+          Field::getLanes(it, ibegin, iend, lbegin, lend);
+          for (AoSoAIndex i(it, lbegin); i.lane < lend; ++i.lane ) {
+            ENERGY_BODY3;
+          }
+        }); 
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(tbegin, tend), [=](Index_type it) {
+          Index_type lbegin, lend;
+          Field::getLanes(it, ibegin, iend, lbegin, lend);
+          for (AoSoAIndex i(it, lbegin); i.lane < lend; ++i.lane ) {
+            ENERGY_BODY4;
+          }
+        }); 
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(tbegin, tend), [=](Index_type it) {
+          Index_type lbegin, lend;
+          Field::getLanes(it, ibegin, iend, lbegin, lend);
+          for (AoSoAIndex i(it, lbegin); i.lane < lend; ++i.lane ) {
+            ENERGY_BODY5;
+          }
+        }); 
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(tbegin, tend), [=](Index_type it) {
+          Index_type lbegin, lend;
+          Field::getLanes(it, ibegin, iend, lbegin, lend);
+          for (AoSoAIndex i(it, lbegin); i.lane < lend; ++i.lane ) {
+            ENERGY_BODY6;
+          }
+        }); 
+
+      }
+      stopTimer();
+
+      ENERGY_DATA_TEARDOWN_LAYOUT;
+
+      break;
+    }
+
+    case Base_Seq_Fused : {
+
+      ENERGY_DATA;
+  
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY_FUSED;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    } 
+
+    case RAJA_Seq_Fused : {
+
+      ENERGY_DATA;
+ 
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          ENERGY_BODY_FUSED;
+        }); 
+
+      }
+      stopTimer(); 
+
+      break;
+    }
+
+    case Base_ThreadPool : {
+
+      ENERGY_DATA;
+  
+      ThreadPool& pool = getThreadPool();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        pool.forall(ibegin, iend, [=](Index_type i) {
+          ENERGY_BODY1;
+        });
+
+        pool.forall(ibegin, iend, [=](Index_type i) {
+          ENERGY_BODY2;
+        });
+
+        pool.forall(ibegin, iend, [=](Index_type i) {
+          ENERGY_BODY3;
+        });
+
+        pool.forall(ibegin, iend, [=](Index_type i) {
+          ENERGY_BODY4;
+        });
+  
+        pool.forall(ibegin, iend, [=](Index_type i) {
+          ENERGY_BODY5;
+        });
+
+        pool.forall(ibegin, iend, [=](Index_type i) {
+          ENERGY_BODY6;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
 #if defined(RAJA_ENABLE_OPENMP)      
     case Base_OpenMP : {
 
@@ -467,8 +953,8 @@ void ENERGY::runKernel(VariantID vid)
 //       do this in RAJA. So, the base OpenMP variant is coded the
 //       way it is to be able to do an "apples to apples" comparison.
 //
-//       This will be changed in the future when the required feature 
-//       is added to RAJA.
+//       The Base_OpenMP_Region and RAJA_OpenMP_Region variants are 
+//       written with one parallel region per rep.
 //
 
       ENERGY_DATA;
@@ -520,32 +1006,120 @@ void ENERGY::runKernel(VariantID vid)
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         RAJA::forall<RAJA::omp_parallel_for_exec>(
-          RAJA::RangeSegment(ibegin, iend), [=](int i) {
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           ENERGY_BODY1;
         });
 
         RAJA::forall<RAJA::omp_parallel_for_exec>(
-          RAJA::RangeSegment(ibegin, iend), [=](int i) {
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           ENERGY_BODY2;
         });
 
         RAJA::forall<RAJA::omp_parallel_for_exec>(
-          RAJA::RangeSegment(ibegin, iend), [=](int i) {
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           ENERGY_BODY3;
         });
 
         RAJA::forall<RAJA::omp_parallel_for_exec>(
-          RAJA::RangeSegment(ibegin, iend), [=](int i) {
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           ENERGY_BODY4;
         });
 
         RAJA::forall<RAJA::omp_parallel_for_exec>(
-          RAJA::RangeSegment(ibegin, iend), [=](int i) {
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           ENERGY_BODY5;
         });
 
         RAJA::forall<RAJA::omp_parallel_for_exec>(
-          RAJA::RangeSegment(ibegin, iend), [=](int i) {
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          ENERGY_BODY6;
+        });
+
+      }
+      stopTimer();
+      break;
+    }
+
+    case Base_OpenMP_Simd : {
+
+      ENERGY_DATA;
+      
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+    
+        #pragma omp parallel for simd
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY1;
+        }
+
+        #pragma omp parallel for simd
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY2;
+        }
+
+        #pragma omp parallel for simd
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY3;
+        }
+
+        #pragma omp parallel for simd
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY4;
+        }
+
+        #pragma omp parallel for simd
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY5;
+        }
+
+        #pragma omp parallel for simd
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY6;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP_Simd : {
+
+      ENERGY_DATA;
+
+      OpenMPSimdISet iset;
+      makeOpenMPSimdISet(iset, ibegin, iend);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<omp_parallel_simd_exec>(
+          iset, [=](Index_type i) {
+          ENERGY_BODY1;
+        });
+
+        RAJA::forall<omp_parallel_simd_exec>(
+          iset, [=](Index_type i) {
+          ENERGY_BODY2;
+        });
+
+        RAJA::forall<omp_parallel_simd_exec>(
+          iset, [=](Index_type i) {
+          ENERGY_BODY3;
+        });
+
+        RAJA::forall<omp_parallel_simd_exec>(
+          iset, [=](Index_type i) {
+          ENERGY_BODY4;
+        });
+
+        RAJA::forall<omp_parallel_simd_exec>(
+          iset, [=](Index_type i) {
+          ENERGY_BODY5;
+        });
+
+        RAJA::forall<omp_parallel_simd_exec>(
+          iset, [=](Index_type i) {
           ENERGY_BODY6;
         });
 
@@ -553,12 +1127,157 @@ void ENERGY::runKernel(VariantID vid)
       stopTimer();
       break;
     }
+
+    case Base_OpenMP_Fused : {
+
+      ENERGY_DATA;
+      
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+    
+        #pragma omp parallel for
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY_FUSED;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP_Fused : {
+
+      ENERGY_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          ENERGY_BODY_FUSED;
+        });
+
+      }
+      stopTimer();
+      break;
+    }
+
+    case Base_OpenMP_Region : {
+
+      ENERGY_DATA;
+      
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+//
+// Loop bodies read and write only entry i of each array, and a static 
+// schedule gives each thread the same iterations in every loop, so no 
+// barrier is needed between loops. Join at the end of region is the 
+// only barrier in a rep.
+//
+        #pragma omp parallel
+        {
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            ENERGY_BODY1;
+          }
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            ENERGY_BODY2;
+          }
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            ENERGY_BODY3;
+          }
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            ENERGY_BODY4;
+          }
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            ENERGY_BODY5;
+          }
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            ENERGY_BODY6;
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP_Region : {
+
+      ENERGY_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+//
+// RAJA::omp_for_nowait_exec does not specify a schedule, so threads may 
+// get different iterations in successive loops. Each loop reads entries 
+// of e_new or q_new written by the loop before it, so loops run with 
+// RAJA::omp_for_exec, which ends with a barrier, in the one parallel 
+// region; only the last loop, followed by the join, is nowait.
+//
+        #pragma omp parallel
+        {
+
+          RAJA::forall<RAJA::omp_for_exec>(
+            RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+            ENERGY_BODY1;
+          });
+
+          RAJA::forall<RAJA::omp_for_exec>(
+            RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+            ENERGY_BODY2;
+          });
+
+          RAJA::forall<RAJA::omp_for_exec>(
+            RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+            ENERGY_BODY3;
+          });
+
+          RAJA::forall<RAJA::omp_for_exec>(
+            RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+            ENERGY_BODY4;
+          });
+
+          RAJA::forall<RAJA::omp_for_exec>(
+            RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+            ENERGY_BODY5;
+          });
+
+          RAJA::forall<RAJA::omp_for_nowait_exec>(
+            RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+            ENERGY_BODY6;
+          });
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
 #define NUMTEAMS 128
     case Base_OpenMPTarget : {
       ENERGY_DATA;
 
-      int n = getRunSize();
+      Index_type n = getRunSize();
       #pragma omp target enter data map(to:e_new[0:n],e_old[0:n],delvc[0:n],p_new[0:n],p_old[0:n], \
        q_new[0:n],q_old[0:n],work[0:n],compHalfStep[0:n],pHalfStep[0:n],bvc[0:n],pbvc[0:n], \
        ql_old[0:n],qq_old[0:n],vnewc[0:n],rho0,e_cut,emin,q_cut)
@@ -607,7 +1326,7 @@ void ENERGY::runKernel(VariantID vid)
     case RAJA_OpenMPTarget : {
       ENERGY_DATA;
 
-      int n = getRunSize();
+      Index_type n = getRunSize();
 
       #pragma omp target enter data map(to:e_new[0:n],e_old[0:n],delvc[0:n],p_new[0:n],p_old[0:n], \
        q_new[0:n],q_old[0:n],work[0:n],compHalfStep[0:n],pHalfStep[0:n],bvc[0:n],pbvc[0:n], \
@@ -621,32 +1340,32 @@ void ENERGY::runKernel(VariantID vid)
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         RAJA::forall<RAJA::omp_target_parallel_for_exec<NUMTEAMS>>(
-          RAJA::RangeSegment(ibegin, iend), [=](int i) {
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           ENERGY_BODY1;
         });
 
         RAJA::forall<RAJA::omp_target_parallel_for_exec<NUMTEAMS>>(
-          RAJA::RangeSegment(ibegin, iend), [=](int i) {
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           ENERGY_BODY2;
         });
 
         RAJA::forall<RAJA::omp_target_parallel_for_exec<NUMTEAMS>>(
-          RAJA::RangeSegment(ibegin, iend), [=](int i) {
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           ENERGY_BODY3;
         });
 
         RAJA::forall<RAJA::omp_target_parallel_for_exec<NUMTEAMS>>(
-          RAJA::RangeSegment(ibegin, iend), [=](int i) {
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           ENERGY_BODY4;
         });
 
         RAJA::forall<RAJA::omp_target_parallel_for_exec<NUMTEAMS>>(
-          RAJA::RangeSegment(ibegin, iend), [=](int i) {
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           ENERGY_BODY5;
         });
 
         RAJA::forall<RAJA::omp_target_parallel_for_exec<NUMTEAMS>>(
-          RAJA::RangeSegment(ibegin, iend), [=](int i) {
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           ENERGY_BODY6;
        });
 
@@ -661,6 +1380,105 @@ void ENERGY::runKernel(VariantID vid)
 #endif
 #endif
 
+#if defined(RAJA_ENABLE_TBB)
+    case Base_TBB : {
+
+      ENERGY_DATA;
+  
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(ibegin, iend),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            ENERGY_BODY1;
+          }
+        });
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(ibegin, iend),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            ENERGY_BODY2;
+          }
+        });
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(ibegin, iend),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            ENERGY_BODY3;
+          }
+        });
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(ibegin, iend),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            ENERGY_BODY4;
+          }
+        });
+  
+        tbb::parallel_for(tbb::blocked_range<Index_type>(ibegin, iend),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            ENERGY_BODY5;
+          }
+        });
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(ibegin, iend),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            ENERGY_BODY6;
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_TBB : {
+
+      ENERGY_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::tbb_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          ENERGY_BODY1;
+        });
+
+        RAJA::forall<RAJA::tbb_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          ENERGY_BODY2;
+        });
+
+        RAJA::forall<RAJA::tbb_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          ENERGY_BODY3;
+        });
+
+        RAJA::forall<RAJA::tbb_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          ENERGY_BODY4;
+        });
+
+        RAJA::forall<RAJA::tbb_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          ENERGY_BODY5;
+        });
+
+        RAJA::forall<RAJA::tbb_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          ENERGY_BODY6;
+        });
+
+      }
+      stopTimer();
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
     case Base_CUDA : {
     
@@ -776,13 +1594,15 @@ void ENERGY::runKernel(VariantID vid)
   }
 }
 
-void ENERGY::updateChecksum(VariantID vid)
+template <typename REAL, typename INDEX>
+void ENERGY<REAL, INDEX>::updateChecksum(VariantID vid)
 {
   checksum[vid] += calcChecksum(m_e_new, getRunSize());
   checksum[vid] += calcChecksum(m_q_new, getRunSize());
 }
 
-void ENERGY::tearDown(VariantID vid)
+template <typename REAL, typename INDEX>
+void ENERGY<REAL, INDEX>::tearDown(VariantID vid)
 {
   (void) vid;
 
@@ -803,5 +1623,7 @@ void ENERGY::tearDown(VariantID vid)
   deallocData(m_vnewc);
 }
 
+RAJAPERF_INSTANTIATE_KERNEL(ENERGY);
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -27,14 +27,22 @@ class RunParams;
 namespace apps
 {
 
+template <typename REAL, typename INDEX>
 class ENERGY : public KernelBase
 {
 public:
+  RAJAPERF_REAL_TYPES(REAL);
+  RAJAPERF_INDEX_TYPES(INDEX);
 
   ENERGY(const RunParams& params);
 
   ~ENERGY();
 
+  double getBytesPerRep() const;
+  double getFLOPsPerRep() const;
+  double getFusedBytesPerRep() const;
+  int getLoopsPerRep() const;
+
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
   void updateChecksum(VariantID vid);
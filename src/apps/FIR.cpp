@@ -29,14 +29,38 @@
 ///   out[i] = sum;
 /// }
 ///
+/// COEFFLEN is 16 by default and may be any of FIRCoeffLens (see 
+/// '--fir-coefflen'); coefficients repeat the pattern above (3.0 every 
+/// fifth entry). Loops are compiled for each length, so coefflen is a 
+/// compile-time constant in them.
+///
+/// *_Blocked variants compute FIR_BLOCK_LEN consecutive outputs at a time
+/// in registers, so each coefficient is loaded once per block and the 
+/// loop over outputs in a block, rather than the reduction over 
+/// coefficients, is the one that is vectorized:
+///
+/// for (Index_type ib = ibegin; ib < iblocked_end; ib += FIR_BLOCK_LEN ) {
+///   Real_type sum[FIR_BLOCK_LEN] = { 0.0 }; 
+///   for (Index_type j = 0; j < coefflen; ++j ) { 
+///     for (Index_type b = 0; b < FIR_BLOCK_LEN; ++b ) { 
+///       sum[b] += coeff[j]*in[ib+b+j]; 
+///     } 
+///   } 
+///   for (Index_type b = 0; b < FIR_BLOCK_LEN; ++b ) { 
+///     out[ib+b] = sum[b];
+///   } 
+/// }
+///
+/// with the remaining outputs computed as in the reference loop.
+///
 
 #include "FIR.hpp"
 
+#include "AppsData.hpp"
 #include "common/DataUtils.hpp"
 
 #include "RAJA/RAJA.hpp"
 
-#include <algorithm>
 #include <iostream>
 
 namespace rajaperf 
@@ -47,23 +71,13 @@ namespace apps
 #define USE_CONSTANT_MEMORY
 //#undef USE_CONSTANT_MEMORY
 
-#define COEFFLEN (16)
-
-#define FIR_COEFF \
-  Real_type coeff_array[COEFFLEN] = { 3.0, -1.0, -1.0, -1.0, \
-                                      -1.0, 3.0, -1.0, -1.0, \
-                                      -1.0, -1.0, 3.0, -1.0, \
-                                      -1.0, -1.0, -1.0, 3.0 };
-
-
 #define FIR_DATA \
   ResReal_ptr in = m_in; \
   ResReal_ptr out = m_out; \
 \
-  Real_type coeff[COEFFLEN]; \
-  std::copy(std::begin(coeff_array), std::end(coeff_array), std::begin(coeff));\
+  const Real_type* const coeff = m_coeff; \
 \
-  const Index_type coefflen = m_coefflen;
+  const Index_type coefflen = COEFFLEN;
 
 
 #define FIR_BODY \
@@ -74,6 +88,24 @@ namespace apps
   } \
   out[i] = sum;
 
+#define FIR_BLOCKED_BODY \
+  const Index_type ib = ibegin + ibk * FIR_BLOCK_LEN; \
+\
+  Real_type sum[FIR_BLOCK_LEN]; \
+  for (Index_type b = 0; b < FIR_BLOCK_LEN; ++b ) { \
+    sum[b] = 0.0; \
+  } \
+  for (Index_type j = 0; j < coefflen; ++j ) { \
+    const Real_type c = coeff[j]; \
+    RAJAPERF_SIMD \
+    for (Index_type b = 0; b < FIR_BLOCK_LEN; ++b ) { \
+      sum[b] += c*in[ib+b+j]; \
+    } \
+  } \
+  for (Index_type b = 0; b < FIR_BLOCK_LEN; ++b ) { \
+    out[ib+b] = sum[b]; \
+  }
+
 
 #if defined(RAJA_ENABLE_CUDA)
   //
@@ -84,7 +116,7 @@ namespace apps
 
 #if defined(USE_CONSTANT_MEMORY)
 
-__constant__ Real_type coeff[COEFFLEN];
+__constant__ Real_type coeff[FIR_MAX_COEFFLEN];
 
 #define FIR_DATA_SETUP_CUDA \
   Real_ptr in; \
@@ -94,7 +126,7 @@ __constant__ Real_type coeff[COEFFLEN];
 \
   allocAndInitCudaDeviceData(in, m_in, getRunSize()); \
   allocAndInitCudaDeviceData(out, m_out, getRunSize()); \
-  cudaMemcpyToSymbol(coeff, coeff_array, COEFFLEN * sizeof(Real_type));
+  cudaMemcpyToSymbol(coeff, m_coeff, coefflen * sizeof(Real_type));
 
 
 #define FIR_DATA_TEARDOWN_CUDA \
@@ -123,8 +155,8 @@ __global__ void fir(Real_ptr out, Real_ptr in,
 \
   allocAndInitCudaDeviceData(in, m_in, getRunSize()); \
   allocAndInitCudaDeviceData(out, m_out, getRunSize()); \
-  Real_ptr tcoeff = &coeff_array[0]; \
-  allocAndInitCudaDeviceData(coeff, tcoeff, COEFFLEN);
+  Real_ptr tcoeff = &m_coeff[0]; \
+  allocAndInitCudaDeviceData(coeff, tcoeff, coefflen);
 
 
 #define FIR_DATA_TEARDOWN_CUDA \
@@ -149,41 +181,96 @@ __global__ void fir(Real_ptr out, Real_ptr in,
 #endif // if defined(RAJA_ENABLE_CUDA)
 
 
-FIR::FIR(const RunParams& params)
+template <typename REAL, typename INDEX>
+FIR<REAL, INDEX>::FIR(const RunParams& params)
   : KernelBase(rajaperf::Apps_FIR, params)
 {
   setDefaultSize(100000);
   setDefaultReps(1600);
 
-  m_coefflen = COEFFLEN;
+#if defined(RAJA_ENABLE_OPENMP)
+  setVariantDefined(Base_OpenMP_Simd);
+  setVariantDefined(RAJA_OpenMP_Simd);
+#endif
+
+  setVariantDefined(Base_Seq_Blocked);
+  setVariantDefined(RAJA_Seq_Blocked);
+#if defined(RAJA_ENABLE_OPENMP)
+  setVariantDefined(Base_OpenMP_Blocked);
+  setVariantDefined(RAJA_OpenMP_Blocked);
+#endif
+
+  for (Index_type j = 0; j < FIR_MAX_COEFFLEN; ++j) {
+    m_coeff[j] = ( j % 5 == 0 ? 3.0 : -1.0 );
+  }
+
+  m_coefflen = params.getFIRCoeffLen();
+}
+
+template <typename REAL, typename INDEX>
+FIR<REAL, INDEX>::~FIR() 
+{
+}
+
+template <typename REAL, typename INDEX>
+Index_type FIR<REAL, INDEX>::getItsPerRep() const { 
+  const rajaperf::Index_type its = getRunSize() - m_coefflen;
+  return ( its > 0 ? its : 0 );
 }
 
-FIR::~FIR() 
+template <typename REAL, typename INDEX>
+double FIR<REAL, INDEX>::getBytesPerRep() const
 {
+  return ( 2.0 * getItsPerRep() + m_coefflen ) * sizeof(Real_type);
 }
 
-Index_type FIR::getItsPerRep() const { 
-  return getRunSize() - m_coefflen;
+template <typename REAL, typename INDEX>
+double FIR<REAL, INDEX>::getFLOPsPerRep() const
+{
+  return 2.0 * m_coefflen * getItsPerRep();
 }
 
-void FIR::setUp(VariantID vid)
+template <typename REAL, typename INDEX>
+void FIR<REAL, INDEX>::setUp(VariantID vid)
 {
   allocAndInitData(m_in, getRunSize(), vid);
   allocAndInitData(m_out, getRunSize(), vid);
 }
 
-void FIR::runKernel(VariantID vid)
+template <typename REAL, typename INDEX>
+void FIR<REAL, INDEX>::runKernel(VariantID vid)
+{
+  //
+  // Cases must match FIRCoeffLens.
+  //
+  switch ( m_coefflen ) {
+    case 4 : runKernelCoeffLen<4>(vid); break;
+    case 8 : runKernelCoeffLen<8>(vid); break;
+    case 16 : runKernelCoeffLen<16>(vid); break;
+    case 32 : runKernelCoeffLen<32>(vid); break;
+    case 64 : runKernelCoeffLen<64>(vid); break;
+    case 128 : runKernelCoeffLen<128>(vid); break;
+    default : {
+      std::cout << "\n  FIR : Unsupported coefficient length = " 
+                << m_coefflen << std::endl;
+    }
+  }
+}
+
+template <typename REAL, typename INDEX>
+template <int COEFFLEN>
+void FIR<REAL, INDEX>::runKernelCoeffLen(VariantID vid)
 {
-  const Index_type run_reps = getRunReps();
+  const Index_type run_reps = getBatchReps();
   const Index_type ibegin = 0;
-  const Index_type iend = getRunSize() - m_coefflen;
+  const Index_type iend = ibegin + getItsPerRep();
+  const Index_type nblocks = (iend - ibegin) / FIR_BLOCK_LEN;
+  const Index_type iblocked_end = ibegin + nblocks * FIR_BLOCK_LEN;
 
   switch ( vid ) {
 
     case Base_Seq : {
 
-      FIR_COEFF;
-
       FIR_DATA;
   
       startTimer();
@@ -201,15 +288,91 @@ void FIR::runKernel(VariantID vid)
 
     case RAJA_Seq : {
 
-      FIR_COEFF;
+      FIR_DATA;
+ 
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          FIR_BODY;
+        }); 
+
+      }
+      stopTimer(); 
+
+      break;
+    }
+
+    case Base_Simd : {
+
+      FIR_DATA;
+  
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          FIR_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Simd : {
 
       FIR_DATA;
  
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          FIR_BODY;
+        }); 
+
+      }
+      stopTimer(); 
+
+      break;
+    }
+
+    case Base_Seq_Blocked : {
+
+      FIR_DATA;
+  
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type ibk = 0; ibk < nblocks; ++ibk ) {
+          FIR_BLOCKED_BODY;
+        }
+        for (Index_type i = iblocked_end; i < iend; ++i ) {
+          FIR_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq_Blocked : {
+
+      FIR_DATA;
+ 
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(0, nblocks), [=](Index_type ibk) {
+          FIR_BLOCKED_BODY;
+        }); 
         RAJA::forall<RAJA::seq_exec>(
-          RAJA::RangeSegment(ibegin, iend), [=](int i) {
+          RAJA::RangeSegment(iblocked_end, iend), [=](Index_type i) {
           FIR_BODY;
         }); 
 
@@ -219,11 +382,28 @@ void FIR::runKernel(VariantID vid)
       break;
     }
 
+    case Base_ThreadPool : {
+
+      FIR_DATA;
+  
+      ThreadPool& pool = getThreadPool();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        pool.forall(ibegin, iend, [=](Index_type i) {
+          FIR_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
 #if defined(RAJA_ENABLE_OPENMP)      
     case Base_OpenMP : {
 
-      FIR_COEFF;
-
       FIR_DATA;
  
       startTimer();
@@ -242,7 +422,83 @@ void FIR::runKernel(VariantID vid)
 
     case RAJA_OpenMP : {
 
-      FIR_COEFF;
+      FIR_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          FIR_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_OpenMP_Simd : {
+
+      FIR_DATA;
+ 
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for simd
+        for (Index_type i = ibegin; i < iend; ++i ) {
+           FIR_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP_Simd : {
+
+      FIR_DATA;
+
+      OpenMPSimdISet iset;
+      makeOpenMPSimdISet(iset, ibegin, iend);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<omp_parallel_simd_exec>(
+          iset, [=](Index_type i) {
+          FIR_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_OpenMP_Blocked : {
+
+      FIR_DATA;
+ 
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type ibk = 0; ibk < nblocks; ++ibk ) {
+           FIR_BLOCKED_BODY;
+        }
+        for (Index_type i = iblocked_end; i < iend; ++i ) {
+           FIR_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP_Blocked : {
 
       FIR_DATA;
 
@@ -250,7 +506,11 @@ void FIR::runKernel(VariantID vid)
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         RAJA::forall<RAJA::omp_parallel_for_exec>(
-          RAJA::RangeSegment(ibegin, iend), [=](int i) {
+          RAJA::RangeSegment(0, nblocks), [=](Index_type ibk) {
+          FIR_BLOCKED_BODY;
+        });
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(iblocked_end, iend), [=](Index_type i) {
           FIR_BODY;
         });
 
@@ -259,16 +519,15 @@ void FIR::runKernel(VariantID vid)
 
       break;
     }
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
 #define NUMTEAMS 128
 
     case Base_OpenMPTarget : {
 
-      FIR_COEFF;
-
       FIR_DATA;
 
-      int n = getRunSize();
+      Index_type n = getRunSize();
       #pragma omp target enter data map(to:coeff[0:COEFFLEN],in[0:n],out[0:n])
 
       startTimer();
@@ -289,11 +548,9 @@ void FIR::runKernel(VariantID vid)
 
     case RAJA_OpenMPTarget : {
 
-      FIR_COEFF;
-
       FIR_DATA;
 
-      int n = getRunSize();
+      Index_type n = getRunSize();
       #pragma omp target enter data map(to:coeff[0:COEFFLEN],in[0:n],out[0:n])
 
       startTimer();
@@ -301,7 +558,7 @@ void FIR::runKernel(VariantID vid)
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         RAJA::forall<RAJA::omp_target_parallel_for_exec<NUMTEAMS>>(
-          RAJA::RangeSegment(ibegin, iend), [=](int i) {
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           FIR_BODY;
         });
 
@@ -315,11 +572,49 @@ void FIR::runKernel(VariantID vid)
 #endif //RAJA_ENABLE_TARGET_OPENMP
 #endif //RAJA_ENABLE_OMP                             
 
+#if defined(RAJA_ENABLE_TBB)
+    case Base_TBB : {
+
+      FIR_DATA;
+  
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(ibegin, iend),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            FIR_BODY;
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_TBB : {
+
+      FIR_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::tbb_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          FIR_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
     case Base_CUDA : {
 
-      FIR_COEFF;
-
       FIR_DATA_SETUP_CUDA;
 
       startTimer();
@@ -348,8 +643,6 @@ void FIR::runKernel(VariantID vid)
 
     case RAJA_CUDA : {
 
-      FIR_COEFF;
-
       FIR_DATA_SETUP_CUDA;
 
       startTimer();
@@ -376,12 +669,14 @@ void FIR::runKernel(VariantID vid)
   }
 }
 
-void FIR::updateChecksum(VariantID vid)
+template <typename REAL, typename INDEX>
+void FIR<REAL, INDEX>::updateChecksum(VariantID vid)
 {
   checksum[vid] += calcChecksum(m_out, getRunSize());
 }
 
-void FIR::tearDown(VariantID vid)
+template <typename REAL, typename INDEX>
+void FIR<REAL, INDEX>::tearDown(VariantID vid)
 {
   (void) vid;
  
@@ -389,5 +684,7 @@ void FIR::tearDown(VariantID vid)
   deallocData(m_out);
 }
 
+RAJAPERF_INSTANTIATE_KERNEL(FIR);
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -27,15 +27,28 @@ class RunParams;
 namespace apps
 {
 
+//
+// Max coefficient length FIR is compiled for (see FIRCoeffLens), and 
+// number of consecutive outputs each iteration of *_Blocked variants 
+// computes in registers.
+//
+const int FIR_MAX_COEFFLEN = 128;
+const int FIR_BLOCK_LEN = 16;
+
+template <typename REAL, typename INDEX>
 class FIR : public KernelBase
 {
 public:
+  RAJAPERF_REAL_TYPES(REAL);
+  RAJAPERF_INDEX_TYPES(INDEX);
 
   FIR(const RunParams& params);
 
   ~FIR();
 
-  Index_type getItsPerRep() const;
+  rajaperf::Index_type getItsPerRep() const;
+  double getBytesPerRep() const;
+  double getFLOPsPerRep() const;
 
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
@@ -43,9 +56,13 @@ public:
   void tearDown(VariantID vid);
 
 private:
+  template <int COEFFLEN>
+  void runKernelCoeffLen(VariantID vid);
+
   Real_ptr m_in;
   Real_ptr m_out;
 
+  Real_type m_coeff[FIR_MAX_COEFFLEN];
   Index_type m_coefflen;
 };
 
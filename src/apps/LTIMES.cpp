@@ -133,7 +133,8 @@ __global__ void ltimes(Real_ptr phidat, Real_ptr elldat, Real_ptr psidat,
 #endif // if defined(RAJA_ENABLE_CUDA)
 
 
-LTIMES::LTIMES(const RunParams& params)
+template <typename REAL, typename INDEX>
+LTIMES<REAL, INDEX>::LTIMES(const RunParams& params)
   : KernelBase(rajaperf::Apps_LTIMES, params)
 {
 #if 1
@@ -151,13 +152,46 @@ LTIMES::LTIMES(const RunParams& params)
   setDefaultSize(m_num_d_default * m_num_m_default * 
                  m_num_g_default * m_num_z_default);
   setDefaultReps(500);
+
+#if defined(RAJA_ENABLE_OPENMP)
+  setVariantDefined(Base_OpenMP_Simd);
+  setVariantDefined(RAJA_OpenMP_Simd);
+#endif
+}
+
+template <typename REAL, typename INDEX>
+LTIMES<REAL, INDEX>::~LTIMES() 
+{
 }
 
-LTIMES::~LTIMES() 
+template <typename REAL, typename INDEX>
+double LTIMES<REAL, INDEX>::getBytesPerRep() const
 {
+  const double num_z = m_num_z_default;
+  const double num_g = m_num_g_default;
+  const double num_m = 
+    static_cast<Index_type>(run_params.getSizeFactor() * m_num_m_default);
+  const double num_d = m_num_d_default;
+
+  return ( 2.0 * num_m * num_g * num_z +   // phi (read and written)
+           num_d * num_m +                 // ell
+           num_d * num_g * num_z ) * sizeof(Real_type);
+}
+
+template <typename REAL, typename INDEX>
+double LTIMES<REAL, INDEX>::getFLOPsPerRep() const
+{
+  const double num_z = m_num_z_default;
+  const double num_g = m_num_g_default;
+  const double num_m = 
+    static_cast<Index_type>(run_params.getSizeFactor() * m_num_m_default);
+  const double num_d = m_num_d_default;
+
+  return 2.0 * num_d * num_m * num_g * num_z;
 }
 
-void LTIMES::setUp(VariantID vid)
+template <typename REAL, typename INDEX>
+void LTIMES<REAL, INDEX>::setUp(VariantID vid)
 {
   m_num_z = m_num_z_default;
   m_num_g = m_num_g_default;  
@@ -168,14 +202,15 @@ void LTIMES::setUp(VariantID vid)
   m_elllen = m_num_d * m_num_m;
   m_psilen = m_num_d * m_num_g * m_num_z;
 
-  allocAndInitDataConst(m_phidat, int(m_philen), Real_type(0.0), vid);
-  allocAndInitData(m_elldat, int(m_elllen), vid);
-  allocAndInitData(m_psidat, int(m_psilen), vid);
+  allocAndInitDataConst(m_phidat, m_philen, Real_type(0.0), vid);
+  allocAndInitData(m_elldat, m_elllen, vid);
+  allocAndInitData(m_psidat, m_psilen, vid);
 }
 
-void LTIMES::runKernel(VariantID vid)
+template <typename REAL, typename INDEX>
+void LTIMES<REAL, INDEX>::runKernel(VariantID vid)
 {
-  const Index_type run_reps = getRunReps();
+  const Index_type run_reps = getBatchReps();
 
   switch ( vid ) {
 
@@ -261,6 +296,114 @@ void LTIMES::runKernel(VariantID vid)
       break;
     }
 
+    case Base_Simd : {
+
+      LTIMES_DATA;
+  
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type d = 0; d < num_d; ++d ) {
+          for (Index_type z = 0; z < num_z; ++z ) {
+            for (Index_type g = 0; g < num_g; ++g ) {
+              RAJAPERF_SIMD
+              for (Index_type m = 0; m < num_m; ++m ) {
+                LTIMES_BODY;
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Simd : {
+
+#if defined(USE_FORALLN_FOR_SEQ)
+
+      LTIMES_DATA;
+
+      LTIMES_VIEWS_RAJA;
+ 
+      using EXEC_POL = 
+        RAJA::NestedPolicy<RAJA::ExecList< RAJA::seq_exec, 
+                                           RAJA::seq_exec, 
+                                           RAJA::seq_exec, 
+                                           RAJA::simd_exec> >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forallN< EXEC_POL, ID, IZ, IG, IM >(
+              RAJA::RangeSegment(0, num_d),
+              RAJA::RangeSegment(0, num_z),
+              RAJA::RangeSegment(0, num_g),
+              RAJA::RangeSegment(0, num_m),
+          [=](ID d, IZ z, IG g, IM m) {
+          LTIMES_BODY_RAJA;
+        });
+
+      }
+      stopTimer(); 
+
+#else // use RAJA::nested
+
+      LTIMES_DATA;
+
+      LTIMES_VIEWS_RAJA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+      
+        RAJA::nested::forall(RAJA::nested::Policy<
+                             RAJA::nested::For<3, RAJA::seq_exec>,
+                             RAJA::nested::For<2, RAJA::seq_exec>,
+                             RAJA::nested::For<1, RAJA::seq_exec>,
+                             RAJA::nested::For<0, RAJA::simd_exec> >{},
+                             camp::make_tuple(IDRange(0, num_d),
+                                              IZRange(0, num_z),
+                                              IGRange(0, num_g),
+                                              IMRange(0, num_m)), 
+          [=](ID d, IZ z, IG g, IM m) {
+          LTIMES_BODY_RAJA;
+        });
+
+      }
+      stopTimer(); 
+
+#endif
+
+      break;
+    }
+
+    case Base_ThreadPool : {
+
+      LTIMES_DATA;
+
+      ThreadPool& pool = getThreadPool();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type d = 0; d < num_d; ++d ) {
+          pool.forall(0, num_z, [=](Index_type z) {
+            for (Index_type g = 0; g < num_g; ++g ) {
+              for (Index_type m = 0; m < num_m; ++m ) {
+                LTIMES_BODY;
+              }
+            }
+          });
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
 #if defined(RAJA_ENABLE_OPENMP)      
     case Base_OpenMP : {
 
@@ -340,6 +483,90 @@ void LTIMES::runKernel(VariantID vid)
       }
       stopTimer();
 
+#endif
+
+      break;
+    }
+
+    case Base_OpenMP_Simd : {
+
+      LTIMES_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type d = 0; d < num_d; ++d ) {
+          #pragma omp parallel for
+          for (Index_type z = 0; z < num_z; ++z ) {
+            for (Index_type g = 0; g < num_g; ++g ) {
+              #pragma omp simd
+              for (Index_type m = 0; m < num_m; ++m ) {
+                LTIMES_BODY;
+              }
+            }
+          }
+        }  
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP_Simd : {
+
+#if defined(USE_FORALLN_FOR_OPENMP)
+
+      LTIMES_DATA;
+
+      LTIMES_VIEWS_RAJA;
+
+      using EXEC_POL = 
+        RAJA::NestedPolicy<RAJA::ExecList< RAJA::seq_exec,
+                                           RAJA::omp_parallel_for_exec,
+                                           RAJA::seq_exec,
+                                           RAJA::simd_exec> >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forallN< EXEC_POL, ID, IZ, IG, IM >(
+              RAJA::RangeSegment(0, num_d),
+              RAJA::RangeSegment(0, num_z),
+              RAJA::RangeSegment(0, num_g),
+              RAJA::RangeSegment(0, num_m),
+          [=](ID d, IZ z, IG g, IM m) {
+          LTIMES_BODY_RAJA;
+        });
+
+      }
+      stopTimer();
+
+#else // use RAJA::nested
+
+      LTIMES_DATA;
+
+      LTIMES_VIEWS_RAJA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::nested::forall(RAJA::nested::Policy<
+                             RAJA::nested::For<3, RAJA::seq_exec>,
+                             RAJA::nested::For<2, RAJA::omp_parallel_for_exec>,
+                             RAJA::nested::For<1, RAJA::seq_exec>,
+                             RAJA::nested::For<0, RAJA::simd_exec> >{},
+                             camp::make_tuple(IDRange(0, num_d),
+                                              IZRange(0, num_z),
+                                              IGRange(0, num_g),
+                                              IMRange(0, num_m)),
+          [=](ID d, IZ z, IG g, IM m) {
+          LTIMES_BODY_RAJA;
+        });
+
+      }
+      stopTimer();
+
 #endif
 
       break;
@@ -359,6 +586,93 @@ void LTIMES::runKernel(VariantID vid)
 #endif //RAJA_ENABLE_TARGET_OPENMP
 #endif //RAJA_ENABLE_OMP
 
+#if defined(RAJA_ENABLE_TBB)
+    case Base_TBB : {
+
+      LTIMES_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type d = 0; d < num_d; ++d ) {
+          tbb::parallel_for(tbb::blocked_range<Index_type>(0, num_z),
+            [=](const tbb::blocked_range<Index_type>& r) {
+            for (Index_type z = r.begin(); z < r.end(); ++z ) {
+              for (Index_type g = 0; g < num_g; ++g ) {
+                for (Index_type m = 0; m < num_m; ++m ) {
+                  LTIMES_BODY;
+                }
+              }
+            }
+          });
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_TBB : {
+
+#if defined(USE_FORALLN_FOR_TBB)
+
+      LTIMES_DATA;
+
+      LTIMES_VIEWS_RAJA;
+
+      using EXEC_POL = 
+        RAJA::NestedPolicy<RAJA::ExecList< RAJA::seq_exec,
+                                           RAJA::tbb_for_exec,
+                                           RAJA::seq_exec,
+                                           RAJA::seq_exec> >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forallN< EXEC_POL, ID, IZ, IG, IM >(
+              RAJA::RangeSegment(0, num_d),
+              RAJA::RangeSegment(0, num_z),
+              RAJA::RangeSegment(0, num_g),
+              RAJA::RangeSegment(0, num_m),
+          [=](ID d, IZ z, IG g, IM m) {
+          LTIMES_BODY_RAJA;
+        });
+
+      }
+      stopTimer();
+
+#else // use RAJA::nested
+
+      LTIMES_DATA;
+
+      LTIMES_VIEWS_RAJA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::nested::forall(RAJA::nested::Policy<
+                             RAJA::nested::For<3, RAJA::seq_exec>,
+                             RAJA::nested::For<2, RAJA::tbb_for_exec>,
+                             RAJA::nested::For<1, RAJA::seq_exec>,
+                             RAJA::nested::For<0, RAJA::seq_exec> >{},
+                             camp::make_tuple(IDRange(0, num_d),
+                                              IZRange(0, num_z),
+                                              IGRange(0, num_g),
+                                              IMRange(0, num_m)),
+          [=](ID d, IZ z, IG g, IM m) {
+          LTIMES_BODY_RAJA;
+        });
+
+      }
+      stopTimer();
+
+#endif
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
     case Base_CUDA : {
 
@@ -453,12 +767,14 @@ void LTIMES::runKernel(VariantID vid)
   }
 }
 
-void LTIMES::updateChecksum(VariantID vid)
+template <typename REAL, typename INDEX>
+void LTIMES<REAL, INDEX>::updateChecksum(VariantID vid)
 {
   checksum[vid] += calcChecksum(m_phidat, m_philen);
 }
 
-void LTIMES::tearDown(VariantID vid)
+template <typename REAL, typename INDEX>
+void LTIMES<REAL, INDEX>::tearDown(VariantID vid)
 {
   (void) vid;
  
@@ -467,5 +783,7 @@ void LTIMES::tearDown(VariantID vid)
   deallocData(m_psidat);
 }
 
+RAJAPERF_INSTANTIATE_KERNEL(LTIMES);
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -27,14 +27,20 @@ class RunParams;
 namespace apps
 {
 
+template <typename REAL, typename INDEX>
 class LTIMES : public KernelBase
 {
 public:
+  RAJAPERF_REAL_TYPES(REAL);
+  RAJAPERF_INDEX_TYPES(INDEX);
 
   LTIMES(const RunParams& params);
 
   ~LTIMES();
 
+  double getBytesPerRep() const;
+  double getFLOPsPerRep() const;
+
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
   void updateChecksum(VariantID vid);
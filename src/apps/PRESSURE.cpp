@@ -30,6 +30,7 @@
 
 #include "PRESSURE.hpp"
 
+#include "AppsData.hpp"
 #include "common/DataUtils.hpp"
 
 #include "RAJA/RAJA.hpp"
@@ -54,7 +55,7 @@ namespace apps
    
 
 #define PRESSURE_BODY1 \
-  bvc[i] = cls * (compression[i] + 1.0);
+  bvc[i] = cls * (compression[i] + Real_type(1.0));
 
 #define PRESSURE_BODY2 \
   p_new[i] = bvc[i] * e_old[i] ; \
@@ -62,6 +63,14 @@ namespace apps
   if ( vnewc[i] >= eosvmax ) p_new[i] = 0.0 ; \
   if ( p_new[i]  <  pmin ) p_new[i]   = pmin ;
 
+//
+// Both loop bodies read and write only entry i of each array, so fused 
+// variants run them in one loop.
+//
+#define PRESSURE_BODY_FUSED \
+  PRESSURE_BODY1; \
+  PRESSURE_BODY2;
+
 
 #if defined(RAJA_ENABLE_CUDA)
 
@@ -121,18 +130,59 @@ __global__ void pressurecalc2(Real_ptr p_new, Real_ptr bvc, Real_ptr e_old,
 #endif // if defined(RAJA_ENABLE_CUDA)
 
 
-PRESSURE::PRESSURE(const RunParams& params)
+template <typename REAL, typename INDEX>
+PRESSURE<REAL, INDEX>::PRESSURE(const RunParams& params)
   : KernelBase(rajaperf::Apps_PRESSURE, params)
 {
   setDefaultSize(100000);
   setDefaultReps(7000);
+
+#if defined(RAJA_ENABLE_OPENMP)
+  setVariantDefined(Base_OpenMP_Simd);
+  setVariantDefined(RAJA_OpenMP_Simd);
+#endif
+
+  setVariantDefined(Base_Seq_Fused);
+  setVariantDefined(RAJA_Seq_Fused);
+#if defined(RAJA_ENABLE_OPENMP)
+  setVariantDefined(Base_OpenMP_Fused);
+  setVariantDefined(RAJA_OpenMP_Fused);
+  setVariantDefined(Base_OpenMP_Region);
+  setVariantDefined(RAJA_OpenMP_Region);
+#endif
+}
+
+template <typename REAL, typename INDEX>
+PRESSURE<REAL, INDEX>::~PRESSURE() 
+{
+}
+
+template <typename REAL, typename INDEX>
+double PRESSURE<REAL, INDEX>::getBytesPerRep() const
+{
+  return 6.0 * sizeof(Real_type) * getRunSize();
+}
+
+template <typename REAL, typename INDEX>
+double PRESSURE<REAL, INDEX>::getFusedBytesPerRep() const
+{
+  return 5.0 * sizeof(Real_type) * getRunSize();
 }
 
-PRESSURE::~PRESSURE() 
+template <typename REAL, typename INDEX>
+int PRESSURE<REAL, INDEX>::getLoopsPerRep() const
 {
+  return 2;
 }
 
-void PRESSURE::setUp(VariantID vid)
+template <typename REAL, typename INDEX>
+double PRESSURE<REAL, INDEX>::getFLOPsPerRep() const
+{
+  return 3.0 * getRunSize();
+}
+
+template <typename REAL, typename INDEX>
+void PRESSURE<REAL, INDEX>::setUp(VariantID vid)
 {
   allocAndInitData(m_compression, getRunSize(), vid);
   allocAndInitData(m_bvc, getRunSize(), vid);
@@ -146,9 +196,10 @@ void PRESSURE::setUp(VariantID vid)
   initData(m_eosvmax);
 }
 
-void PRESSURE::runKernel(VariantID vid)
+template <typename REAL, typename INDEX>
+void PRESSURE<REAL, INDEX>::runKernel(VariantID vid)
 {
-  const Index_type run_reps = getRunReps();
+  const Index_type run_reps = getBatchReps();
   const Index_type ibegin = 0;
   const Index_type iend = getRunSize();
 
@@ -183,12 +234,12 @@ void PRESSURE::runKernel(VariantID vid)
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         RAJA::forall<RAJA::simd_exec>(
-          RAJA::RangeSegment(ibegin, iend), [=](int i) {
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           PRESSURE_BODY1;
         }); 
 
         RAJA::forall<RAJA::simd_exec>(
-          RAJA::RangeSegment(ibegin, iend), [=](int i) {
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           PRESSURE_BODY2;
         }); 
 
@@ -198,6 +249,110 @@ void PRESSURE::runKernel(VariantID vid)
       break;
     }
 
+    case Base_Simd : {
+
+      PRESSURE_DATA;
+  
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          PRESSURE_BODY1;
+        }
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          PRESSURE_BODY2;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Simd : {
+
+      PRESSURE_DATA;
+ 
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          PRESSURE_BODY1;
+        }); 
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          PRESSURE_BODY2;
+        }); 
+
+      }
+      stopTimer(); 
+
+      break;
+    }
+
+    case Base_Seq_Fused : {
+
+      PRESSURE_DATA;
+  
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          PRESSURE_BODY_FUSED;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    } 
+
+    case RAJA_Seq_Fused : {
+
+      PRESSURE_DATA;
+ 
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          PRESSURE_BODY_FUSED;
+        }); 
+
+      }
+      stopTimer(); 
+
+      break;
+    }
+
+    case Base_ThreadPool : {
+
+      PRESSURE_DATA;
+  
+      ThreadPool& pool = getThreadPool();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        pool.forall(ibegin, iend, [=](Index_type i) {
+          PRESSURE_BODY1;
+        });
+
+        pool.forall(ibegin, iend, [=](Index_type i) {
+          PRESSURE_BODY2;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
 #if defined(RAJA_ENABLE_OPENMP)      
     case Base_OpenMP : {
 
@@ -208,8 +363,8 @@ void PRESSURE::runKernel(VariantID vid)
 //       do this in RAJA. So, the base OpenMP variant is coded the
 //       way it is to be able to do an "apples to apples" comparison.
 //
-//       This will be changed in the future when the required feature 
-//       is added to RAJA.
+//       The Base_OpenMP_Region and RAJA_OpenMP_Region variants are 
+//       written with one parallel region per rep.
 //
 
       PRESSURE_DATA;
@@ -241,12 +396,12 @@ void PRESSURE::runKernel(VariantID vid)
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         RAJA::forall<RAJA::omp_parallel_for_exec>(
-          RAJA::RangeSegment(ibegin, iend), [=](int i) {
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           PRESSURE_BODY1;
         });
 
         RAJA::forall<RAJA::omp_parallel_for_exec>(
-          RAJA::RangeSegment(ibegin, iend), [=](int i) {
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           PRESSURE_BODY2;
         });
 
@@ -256,6 +411,156 @@ void PRESSURE::runKernel(VariantID vid)
       break;
     }
 
+    case Base_OpenMP_Simd : {
+
+      PRESSURE_DATA;
+      
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+    
+        #pragma omp parallel for simd schedule(static)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          PRESSURE_BODY1;
+        }
+
+        #pragma omp parallel for simd schedule(static)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          PRESSURE_BODY2;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP_Simd : {
+
+      PRESSURE_DATA;
+
+      OpenMPSimdISet iset;
+      makeOpenMPSimdISet(iset, ibegin, iend);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<omp_parallel_simd_exec>(
+          iset, [=](Index_type i) {
+          PRESSURE_BODY1;
+        });
+
+        RAJA::forall<omp_parallel_simd_exec>(
+          iset, [=](Index_type i) {
+          PRESSURE_BODY2;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_OpenMP_Fused : {
+
+      PRESSURE_DATA;
+      
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+    
+        #pragma omp parallel for
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          PRESSURE_BODY_FUSED;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP_Fused : {
+
+      PRESSURE_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          PRESSURE_BODY_FUSED;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_OpenMP_Region : {
+
+      PRESSURE_DATA;
+      
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+//
+// With static schedules, each thread reads in the second loop only the 
+// entries of bvc it wrote in the first, so the loops need no barrier.
+//
+        #pragma omp parallel
+        {
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            PRESSURE_BODY1;
+          }
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            PRESSURE_BODY2;
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP_Region : {
+
+      PRESSURE_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+//
+// RAJA::omp_for_nowait_exec does not specify a schedule, so the second 
+// loop may read entries of bvc written by another thread in the first;
+// the first loop runs with RAJA::omp_for_exec, which ends with a barrier.
+//
+        #pragma omp parallel
+        {
+
+          RAJA::forall<RAJA::omp_for_exec>(
+            RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+            PRESSURE_BODY1;
+          });
+
+          RAJA::forall<RAJA::omp_for_nowait_exec>(
+            RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+            PRESSURE_BODY2;
+          });
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
 
 #define NUMTEAMS 128
@@ -264,7 +569,7 @@ void PRESSURE::runKernel(VariantID vid)
 
       PRESSURE_DATA;
 
-      int n=getRunSize();
+      Index_type n = getRunSize();
       #pragma omp target enter data map(to:compression[0:n], bvc[0:n], p_new[0:n], e_old[0:n], \
        vnewc[0:n], cls, p_cut, pmin, eosvmax )
 
@@ -293,7 +598,7 @@ void PRESSURE::runKernel(VariantID vid)
 
       PRESSURE_DATA;
 
-      int n=getRunSize();
+      Index_type n = getRunSize();
       #pragma omp target enter data map(to:compression[0:n], bvc[0:n], p_new[0:n], e_old[0:n], \
        vnewc[0:n], cls, p_cut, pmin, eosvmax )
 
@@ -302,12 +607,12 @@ void PRESSURE::runKernel(VariantID vid)
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         RAJA::forall<RAJA::omp_target_parallel_for_exec<NUMTEAMS>>(
-            RAJA::RangeSegment(ibegin, iend), [=](int i) {
+            RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           PRESSURE_BODY1;
         });
 
         RAJA::forall<RAJA::omp_target_parallel_for_exec<NUMTEAMS>>(
-            RAJA::RangeSegment(ibegin, iend), [=](int i) {
+            RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           PRESSURE_BODY2;
         });
 
@@ -321,6 +626,58 @@ void PRESSURE::runKernel(VariantID vid)
 #endif
 #endif                             
 
+#if defined(RAJA_ENABLE_TBB)
+    case Base_TBB : {
+
+      PRESSURE_DATA;
+  
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(ibegin, iend),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            PRESSURE_BODY1;
+          }
+        });
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(ibegin, iend),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            PRESSURE_BODY2;
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_TBB : {
+
+      PRESSURE_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::tbb_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          PRESSURE_BODY1;
+        });
+
+        RAJA::forall<RAJA::tbb_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          PRESSURE_BODY2;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
     case Base_CUDA : {
 
@@ -381,12 +738,14 @@ void PRESSURE::runKernel(VariantID vid)
   }
 }
 
-void PRESSURE::updateChecksum(VariantID vid)
+template <typename REAL, typename INDEX>
+void PRESSURE<REAL, INDEX>::updateChecksum(VariantID vid)
 {
   checksum[vid] += calcChecksum(m_p_new, getRunSize());
 }
 
-void PRESSURE::tearDown(VariantID vid)
+template <typename REAL, typename INDEX>
+void PRESSURE<REAL, INDEX>::tearDown(VariantID vid)
 {
   (void) vid;
  
@@ -397,5 +756,7 @@ void PRESSURE::tearDown(VariantID vid)
   deallocData(m_vnewc);
 }
 
+RAJAPERF_INSTANTIATE_KERNEL(PRESSURE);
+
 } // end namespace apps
 } // end namespace rajaperf
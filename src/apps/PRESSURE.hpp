@@ -27,14 +27,22 @@ class RunParams;
 namespace apps
 {
 
+template <typename REAL, typename INDEX>
 class PRESSURE : public KernelBase
 {
 public:
+  RAJAPERF_REAL_TYPES(REAL);
+  RAJAPERF_INDEX_TYPES(INDEX);
 
   PRESSURE(const RunParams& params);
 
   ~PRESSURE();
 
+  double getBytesPerRep() const;
+  double getFLOPsPerRep() const;
+  double getFusedBytesPerRep() const;
+  int getLoopsPerRep() const;
+
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
   void updateChecksum(VariantID vid);
@@ -93,7 +93,7 @@ namespace apps
   Real_ptr z = m_z; \
   ResReal_ptr vol = m_vol; \
 \
-  const Real_type vnormq = m_vnormq;
+  const Real_type vnormq = m_vnormq; \
 \
   Real_ptr x0,x1,x2,x3,x4,x5,x6,x7 ; \
   Real_ptr y0,y1,y2,y3,y4,y5,y6,y7 ; \
@@ -152,6 +152,29 @@ namespace apps
   vol[i] *= vnormq ;
 
 
+//
+// AoS and AoSoA layout variants hold x, y, z node coordinates in one array.
+//
+#define VOL3D_DATA_SETUP_LAYOUT(FIELD) \
+  const Index_type nnodes = m_domain->lpn; \
+  Real_ptr xyz; \
+  allocAndPackFields<FIELD>(xyz, {m_x, m_y, m_z}, nnodes, vid); \
+\
+  FIELD x(xyz, 3, nnodes, 0); \
+  FIELD y(xyz, 3, nnodes, 1); \
+  FIELD z(xyz, 3, nnodes, 2); \
+  ResReal_ptr vol = m_vol; \
+\
+  const Real_type vnormq = m_vnormq; \
+\
+  FIELD x0(x),x1(x),x2(x),x3(x),x4(x),x5(x),x6(x),x7(x) ; \
+  FIELD y0(y),y1(y),y2(y),y3(y),y4(y),y5(y),y6(y),y7(y) ; \
+  FIELD z0(z),z1(z),z2(z),z3(z),z4(z),z5(z),z6(z),z7(z) ;
+
+#define VOL3D_DATA_TEARDOWN_LAYOUT \
+  deallocData(xyz);
+
+
 #if defined(RAJA_ENABLE_CUDA)
 
   //
@@ -210,27 +233,53 @@ __global__ void vol3d(Real_ptr vol,
 #endif // if defined(RAJA_ENABLE_CUDA)
 
 
-VOL3D::VOL3D(const RunParams& params)
+template <typename REAL, typename INDEX>
+VOL3D<REAL, INDEX>::VOL3D(const RunParams& params)
   : KernelBase(rajaperf::Apps_VOL3D, params)
 {
   setDefaultSize(64);  // See rzmax in ADomain struct
   setDefaultReps(300);
 
+#if defined(RAJA_ENABLE_OPENMP)
+  setVariantDefined(Base_OpenMP_Simd);
+  setVariantDefined(RAJA_OpenMP_Simd);
+#endif
+
+  setVariantDefined(Base_Seq_AoS);
+  setVariantDefined(RAJA_Seq_AoS);
+  setVariantDefined(Base_Seq_AoSoA);
+  setVariantDefined(RAJA_Seq_AoSoA);
+
   m_domain = new ADomain(getRunSize(), /* ndims = */ 3);
 }
 
-VOL3D::~VOL3D() 
+template <typename REAL, typename INDEX>
+VOL3D<REAL, INDEX>::~VOL3D() 
 {
   delete m_domain;
 }
 
-Index_type VOL3D::getItsPerRep() const { 
+template <typename REAL, typename INDEX>
+Index_type VOL3D<REAL, INDEX>::getItsPerRep() const { 
   return m_domain->lpz+1 - m_domain->fpz;
 }
 
-void VOL3D::setUp(VariantID vid)
+template <typename REAL, typename INDEX>
+double VOL3D<REAL, INDEX>::getBytesPerRep() const
+{
+  return 4.0 * sizeof(Real_type) * getItsPerRep();
+}
+
+template <typename REAL, typename INDEX>
+double VOL3D<REAL, INDEX>::getFLOPsPerRep() const
+{
+  return 72.0 * getItsPerRep();
+}
+
+template <typename REAL, typename INDEX>
+void VOL3D<REAL, INDEX>::setUp(VariantID vid)
 {
-  int max_loop_index = m_domain->lpn;
+  Index_type max_loop_index = m_domain->lpn;
 
   allocAndInitData(m_x, max_loop_index, vid);
   allocAndInitData(m_y, max_loop_index, vid);
@@ -240,9 +289,10 @@ void VOL3D::setUp(VariantID vid)
   m_vnormq = 0.083333333333333333; /* vnormq = 1/12 */  
 }
 
-void VOL3D::runKernel(VariantID vid)
+template <typename REAL, typename INDEX>
+void VOL3D<REAL, INDEX>::runKernel(VariantID vid)
 {
-  const Index_type run_reps = getRunReps();
+  const Index_type run_reps = getBatchReps();
   const Index_type ibegin = m_domain->fpz;
   const Index_type iend = m_domain->lpz+1;
 
@@ -281,7 +331,51 @@ void VOL3D::runKernel(VariantID vid)
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         RAJA::forall<RAJA::simd_exec>(
-          RAJA::RangeSegment(ibegin, iend), [=](int i) {
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          VOL3D_BODY;
+        }); 
+
+      }
+      stopTimer(); 
+
+      break;
+    }
+
+    case Base_Simd : {
+
+      VOL3D_DATA;
+
+      NDPTRSET(m_domain->jp, m_domain->kp, x,x0,x1,x2,x3,x4,x5,x6,x7) ;
+      NDPTRSET(m_domain->jp, m_domain->kp, y,y0,y1,y2,y3,y4,y5,y6,y7) ;
+      NDPTRSET(m_domain->jp, m_domain->kp, z,z0,z1,z2,z3,z4,z5,z6,z7) ;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin ; i < iend ; ++i ) {
+          VOL3D_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Simd : {
+
+      VOL3D_DATA;
+
+      NDPTRSET(m_domain->jp, m_domain->kp, x,x0,x1,x2,x3,x4,x5,x6,x7) ;
+      NDPTRSET(m_domain->jp, m_domain->kp, y,y0,y1,y2,y3,y4,y5,y6,y7) ;
+      NDPTRSET(m_domain->jp, m_domain->kp, z,z0,z1,z2,z3,z4,z5,z6,z7) ;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           VOL3D_BODY;
         }); 
 
@@ -291,6 +385,143 @@ void VOL3D::runKernel(VariantID vid)
       break;
     }
 
+    case Base_Seq_AoS : {
+
+      typedef AoSField<Real_type, Index_type> Field;
+      VOL3D_DATA_SETUP_LAYOUT(Field);
+
+      NDPTRSET(m_domain->jp, m_domain->kp, x,x0,x1,x2,x3,x4,x5,x6,x7) ;
+      NDPTRSET(m_domain->jp, m_domain->kp, y,y0,y1,y2,y3,y4,y5,y6,y7) ;
+      NDPTRSET(m_domain->jp, m_domain->kp, z,z0,z1,z2,z3,z4,z5,z6,z7) ;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin ; i < iend ; ++i ) {
+          VOL3D_BODY;
+        }
+
+      }
+      stopTimer();
+
+      VOL3D_DATA_TEARDOWN_LAYOUT;
+
+      break;
+    }
+
+    case RAJA_Seq_AoS : {
+
+      typedef AoSField<Real_type, Index_type> Field;
+      VOL3D_DATA_SETUP_LAYOUT(Field);
+
+      NDPTRSET(m_domain->jp, m_domain->kp, x,x0,x1,x2,x3,x4,x5,x6,x7) ;
+      NDPTRSET(m_domain->jp, m_domain->kp, y,y0,y1,y2,y3,y4,y5,y6,y7) ;
+      NDPTRSET(m_domain->jp, m_domain->kp, z,z0,z1,z2,z3,z4,z5,z6,z7) ;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          VOL3D_BODY;
+        }); 
+
+      }
+      stopTimer(); 
+
+      VOL3D_DATA_TEARDOWN_LAYOUT;
+
+      break;
+    }
+
+    case Base_Seq_AoSoA : {
+
+      typedef AoSoAField<Real_type, Index_type> Field;
+      VOL3D_DATA_SETUP_LAYOUT(Field);
+
+      typedef typename Field::Index AoSoAIndex;
+      const Index_type tbegin = Field::getTile(ibegin);
+      const Index_type tend = Field::getNumTiles(iend);
+
+      NDPTRSET(m_domain->jp, m_domain->kp, x,x0,x1,x2,x3,x4,x5,x6,x7) ;
+      NDPTRSET(m_domain->jp, m_domain->kp, y,y0,y1,y2,y3,y4,y5,y6,y7) ;
+      NDPTRSET(m_domain->jp, m_domain->kp, z,z0,z1,z2,z3,z4,z5,z6,z7) ;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type it = tbegin; it < tend; ++it ) {
+          Index_type lbegin, lend;
+          Field::getLanes(it, ibegin, iend, lbegin, lend);
+          for (AoSoAIndex i(it, lbegin); i.lane < lend; ++i.lane ) {
+            VOL3D_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      VOL3D_DATA_TEARDOWN_LAYOUT;
+
+      break;
+    }
+
+    case RAJA_Seq_AoSoA : {
+
+      typedef AoSoAField<Real_type, Index_type> Field;
+      VOL3D_DATA_SETUP_LAYOUT(Field);
+
+      typedef typename Field::Index AoSoAIndex;
+      const Index_type tbegin = Field::getTile(ibegin);
+      const Index_type tend = Field::getNumTiles(iend);
+
+      NDPTRSET(m_domain->jp, m_domain->kp, x,x0,x1,x2,x3,x4,x5,x6,x7) ;
+      NDPTRSET(m_domain->jp, m_domain->kp, y,y0,y1,y2,y3,y4,y5,y6,y7) ;
+      NDPTRSET(m_domain->jp, m_domain->kp, z,z0,z1,z2,z3,z4,z5,z6,z7) ;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(tbegin, tend), [=](Index_type it) {
+          Index_type lbegin, lend;
+          Field::getLanes(it, ibegin, iend, lbegin, lend);
+          for (AoSoAIndex i(it, lbegin); i.lane < lend; ++i.lane ) {
+            VOL3D_BODY;
+          }
+        }); 
+
+      }
+      stopTimer(); 
+
+      VOL3D_DATA_TEARDOWN_LAYOUT;
+
+      break;
+    }
+
+    case Base_ThreadPool : {
+
+      VOL3D_DATA;
+
+      NDPTRSET(m_domain->jp, m_domain->kp, x,x0,x1,x2,x3,x4,x5,x6,x7) ;
+      NDPTRSET(m_domain->jp, m_domain->kp, y,y0,y1,y2,y3,y4,y5,y6,y7) ;
+      NDPTRSET(m_domain->jp, m_domain->kp, z,z0,z1,z2,z3,z4,z5,z6,z7) ;
+
+      ThreadPool& pool = getThreadPool();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        pool.forall(ibegin, iend, [=](Index_type i) {
+          VOL3D_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
 #if defined(RAJA_ENABLE_OPENMP)      
     case Base_OpenMP : {
 
@@ -326,7 +557,54 @@ void VOL3D::runKernel(VariantID vid)
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         RAJA::forall<RAJA::omp_parallel_for_exec>(
-          RAJA::RangeSegment(ibegin, iend), [=](int i) {
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          VOL3D_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_OpenMP_Simd : {
+
+      VOL3D_DATA;
+
+      NDPTRSET(m_domain->jp, m_domain->kp, x,x0,x1,x2,x3,x4,x5,x6,x7) ;
+      NDPTRSET(m_domain->jp, m_domain->kp, y,y0,y1,y2,y3,y4,y5,y6,y7) ;
+      NDPTRSET(m_domain->jp, m_domain->kp, z,z0,z1,z2,z3,z4,z5,z6,z7) ;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for simd
+        for (Index_type i = ibegin ; i < iend ; ++i ) {
+          VOL3D_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP_Simd : {
+
+      VOL3D_DATA;
+
+      NDPTRSET(m_domain->jp, m_domain->kp, x,x0,x1,x2,x3,x4,x5,x6,x7) ;
+      NDPTRSET(m_domain->jp, m_domain->kp, y,y0,y1,y2,y3,y4,y5,y6,y7) ;
+      NDPTRSET(m_domain->jp, m_domain->kp, z,z0,z1,z2,z3,z4,z5,z6,z7) ;
+
+      OpenMPSimdISet iset;
+      makeOpenMPSimdISet(iset, ibegin, iend);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<omp_parallel_simd_exec>(
+          iset, [=](Index_type i) {
           VOL3D_BODY;
         });
 
@@ -344,9 +622,9 @@ void VOL3D::runKernel(VariantID vid)
 
       VOL3D_DATA;
 
-      int n = m_domain->lpn;
-      int jp = m_domain->jp;
-      int kp = m_domain->kp;
+      Index_type n = m_domain->lpn;
+      Index_type jp = m_domain->jp;
+      Index_type kp = m_domain->kp;
 
       #pragma omp target enter data map(to:x[0:n],y[0:n],z[0:n],vnormq,vol[0:n],jp,kp)
 
@@ -377,9 +655,9 @@ void VOL3D::runKernel(VariantID vid)
 
       VOL3D_DATA;
 
-      int n = m_domain->lpn;
-      int jp = m_domain->jp;
-      int kp = m_domain->kp;
+      Index_type n = m_domain->lpn;
+      Index_type jp = m_domain->jp;
+      Index_type kp = m_domain->kp;
 
       #pragma omp target enter data map(to:x[0:n],y[0:n],z[0:n],vnormq,vol[0:n],jp,kp)
 
@@ -388,7 +666,7 @@ void VOL3D::runKernel(VariantID vid)
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         RAJA::forall<RAJA::omp_target_parallel_for_exec<NUMTEAMS>>(
-            RAJA::RangeSegment(ibegin, iend), [=](int i) {
+            RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           ResReal_ptr x0,x1,x2,x3,x4,x5,x6,x7 ;
           ResReal_ptr y0,y1,y2,y3,y4,y5,y6,y7 ;
           ResReal_ptr z0,z1,z2,z3,z4,z5,z6,z7 ;
@@ -409,6 +687,54 @@ void VOL3D::runKernel(VariantID vid)
 #endif //RAJA_ENABLE_TARGET_OPENMP
 #endif //RAJA_ENABLE_OMP                             
 
+#if defined(RAJA_ENABLE_TBB)
+    case Base_TBB : {
+
+      VOL3D_DATA;
+
+      NDPTRSET(m_domain->jp, m_domain->kp, x,x0,x1,x2,x3,x4,x5,x6,x7) ;
+      NDPTRSET(m_domain->jp, m_domain->kp, y,y0,y1,y2,y3,y4,y5,y6,y7) ;
+      NDPTRSET(m_domain->jp, m_domain->kp, z,z0,z1,z2,z3,z4,z5,z6,z7) ;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(ibegin, iend),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            VOL3D_BODY;
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_TBB : {
+
+      VOL3D_DATA;
+
+      NDPTRSET(m_domain->jp, m_domain->kp, x,x0,x1,x2,x3,x4,x5,x6,x7) ;
+      NDPTRSET(m_domain->jp, m_domain->kp, y,y0,y1,y2,y3,y4,y5,y6,y7) ;
+      NDPTRSET(m_domain->jp, m_domain->kp, z,z0,z1,z2,z3,z4,z5,z6,z7) ;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::tbb_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          VOL3D_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
     case Base_CUDA : {
 
@@ -473,12 +799,14 @@ void VOL3D::runKernel(VariantID vid)
   }
 }
 
-void VOL3D::updateChecksum(VariantID vid)
+template <typename REAL, typename INDEX>
+void VOL3D<REAL, INDEX>::updateChecksum(VariantID vid)
 {
   checksum[vid] += calcChecksum(m_vol, getRunSize());
 }
 
-void VOL3D::tearDown(VariantID vid)
+template <typename REAL, typename INDEX>
+void VOL3D<REAL, INDEX>::tearDown(VariantID vid)
 {
   (void) vid;
 
@@ -488,5 +816,7 @@ void VOL3D::tearDown(VariantID vid)
   deallocData(m_vol);
 }
 
+RAJAPERF_INSTANTIATE_KERNEL(VOL3D);
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -28,15 +28,20 @@ namespace apps
 {
 struct ADomain;
 
+template <typename REAL, typename INDEX>
 class VOL3D : public KernelBase
 {
 public:
+  RAJAPERF_REAL_TYPES(REAL);
+  RAJAPERF_INDEX_TYPES(INDEX);
 
   VOL3D(const RunParams& params);
 
   ~VOL3D();
 
-  Index_type getItsPerRep() const;
+  rajaperf::Index_type getItsPerRep() const;
+  double getBytesPerRep() const;
+  double getFLOPsPerRep() const;
 
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
@@ -162,7 +162,8 @@ for (Index_type j = jmin; j < jmax; j++) { \
 } /* j loop */
 
 
-COUPLE::COUPLE(const RunParams& params)
+template <typename REAL, typename INDEX>
+COUPLE<REAL, INDEX>::COUPLE(const RunParams& params)
   : KernelBase(rajaperf::Apps_COUPLE, params)
 {
   setDefaultSize(64);  // See rzmax in ADomain struct
@@ -178,19 +179,22 @@ COUPLE::COUPLE(const RunParams& params)
   m_kmax = m_domain->kmax;
 }
 
-COUPLE::~COUPLE() 
+template <typename REAL, typename INDEX>
+COUPLE<REAL, INDEX>::~COUPLE() 
 {
   delete m_domain;
 }
 
-Index_type COUPLE::getItsPerRep() const 
+template <typename REAL, typename INDEX>
+Index_type COUPLE<REAL, INDEX>::getItsPerRep() const 
 { 
   return  ( (m_imax - m_imin) * (m_jmax - m_jmin) * (m_kmax - m_kmin) ); 
 }
 
-void COUPLE::setUp(VariantID vid)
+template <typename REAL, typename INDEX>
+void COUPLE<REAL, INDEX>::setUp(VariantID vid)
 {
-  int max_loop_index = m_domain->lrn;
+  Index_type max_loop_index = m_domain->lrn;
 
   allocAndInitData(m_t0, max_loop_index, vid);
   allocAndInitData(m_t1, max_loop_index, vid);
@@ -210,9 +214,10 @@ void COUPLE::setUp(VariantID vid)
   m_ireal = Complex_type(0.0, 1.0); 
 }
 
-void COUPLE::runKernel(VariantID vid)
+template <typename REAL, typename INDEX>
+void COUPLE<REAL, INDEX>::runKernel(VariantID vid)
 {
-  const Index_type run_reps = getRunReps();
+  const Index_type run_reps = getBatchReps();
 
 //
 // RDH: Should we use forallN for this kernel???
@@ -245,7 +250,7 @@ void COUPLE::runKernel(VariantID vid)
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         RAJA::forall<RAJA::seq_exec>(
-          RAJA::RangeSegment(kmin, kmax), [=](int k) {
+          RAJA::RangeSegment(kmin, kmax), [=](Index_type k) {
           COUPLE_BODY;
         }); 
 
@@ -255,6 +260,61 @@ void COUPLE::runKernel(VariantID vid)
       break;
     }
 
+    case Base_Simd : {
+
+      COUPLE_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJAPERF_SIMD
+        for (Index_type k = kmin ; k < kmax ; ++k ) {
+          COUPLE_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Simd : {
+
+      COUPLE_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(kmin, kmax), [=](Index_type k) {
+          COUPLE_BODY;
+        }); 
+
+      }
+      stopTimer(); 
+
+      break;
+    }
+
+    case Base_ThreadPool : {
+
+      COUPLE_DATA;
+
+      ThreadPool& pool = getThreadPool();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        pool.forall(kmin, kmax, [=](Index_type k) {
+          COUPLE_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
 #if defined(RAJA_ENABLE_OPENMP)      
     case Base_OpenMP : {
       COUPLE_DATA;
@@ -280,7 +340,7 @@ void COUPLE::runKernel(VariantID vid)
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         RAJA::forall<RAJA::omp_parallel_for_exec>(
-          RAJA::RangeSegment(kmin, kmax), [=](int k) {
+          RAJA::RangeSegment(kmin, kmax), [=](Index_type k) {
           COUPLE_BODY;
         }); 
 
@@ -303,7 +363,7 @@ void COUPLE::runKernel(VariantID vid)
 
       COUPLE_DATA;
 
-      int n = m_domain->lrn;
+      Index_type n = m_domain->lrn;
       #pragma omp target enter data map(to:t0[0:n],t1[0:n],t2[0:n],denac[0:n],denlw[0:n], \
          dt, c10, fratio, r_fratio, c20, ireal, imin, imax, jmin, jmax, kmin, kmax )
 
@@ -311,7 +371,7 @@ void COUPLE::runKernel(VariantID vid)
       #pragma omp target data use_device_ptr(t0,t1,t2,denac,denlw)
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::forall<RAJA::omp_target_parallel_for_exec<NUMTEAMS>>(kmin, kmax, [=](int k) {
+        RAJA::forall<RAJA::omp_target_parallel_for_exec<NUMTEAMS>>(kmin, kmax, [=](Index_type k) {
           COUPLE_BODY;
         });
 
@@ -325,6 +385,46 @@ void COUPLE::runKernel(VariantID vid)
 #endif //RAJA_ENABLE_TARGET_OPENMP
 #endif //RAJA_ENABLE_OMP
 
+#if defined(RAJA_ENABLE_TBB)
+    case Base_TBB : {
+
+      COUPLE_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(kmin, kmax),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type k = r.begin(); k < r.end(); ++k ) {
+            COUPLE_BODY;
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_TBB : {
+
+      COUPLE_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::tbb_for_exec>(
+          RAJA::RangeSegment(kmin, kmax), [=](Index_type k) {
+          COUPLE_BODY;
+        }); 
+
+      }
+      stopTimer(); 
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
     case Base_CUDA :
     case RAJA_CUDA : {
@@ -340,16 +440,18 @@ void COUPLE::runKernel(VariantID vid)
   }
 }
 
-void COUPLE::updateChecksum(VariantID vid)
+template <typename REAL, typename INDEX>
+void COUPLE<REAL, INDEX>::updateChecksum(VariantID vid)
 {
-  int max_loop_index = m_domain->lrn;
+  Index_type max_loop_index = m_domain->lrn;
 
   checksum[vid] += calcChecksum(m_t0, max_loop_index);
   checksum[vid] += calcChecksum(m_t1, max_loop_index);
   checksum[vid] += calcChecksum(m_t2, max_loop_index);
 }
 
-void COUPLE::tearDown(VariantID vid)
+template <typename REAL, typename INDEX>
+void COUPLE<REAL, INDEX>::tearDown(VariantID vid)
 {
   (void) vid;
  
@@ -360,5 +462,7 @@ void COUPLE::tearDown(VariantID vid)
   deallocData(m_denlw);
 }
 
+RAJAPERF_INSTANTIATE_KERNEL(COUPLE);
+
 } // end namespace apps
 } // end namespace rajaperf
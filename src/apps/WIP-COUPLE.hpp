@@ -28,15 +28,18 @@ namespace apps
 {
 struct ADomain;
 
+template <typename REAL, typename INDEX>
 class COUPLE : public KernelBase
 {
 public:
+  RAJAPERF_REAL_TYPES(REAL);
+  RAJAPERF_INDEX_TYPES(INDEX);
 
   COUPLE(const RunParams& params);
 
   ~COUPLE();
 
-  Index_type getItsPerRep() const;
+  rajaperf::Index_type getItsPerRep() const;
 
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
@@ -33,6 +33,7 @@
 #include "IF_QUAD.hpp"
 
 #include "common/DataUtils.hpp"
+#include "common/SimdIntrinsics.hpp"
 
 #include "RAJA/RAJA.hpp"
 
@@ -52,16 +53,25 @@ namespace basic
 
 #define IF_QUAD_BODY  \
   x1[i] = 0.0; \
-  Real_type s = b[i]*b[i] - 4.0*a[i]*c[i]; \
+  Real_type s = b[i]*b[i] - Real_type(4.0)*a[i]*c[i]; \
   if ( s >= 0 ) { \
     s = sqrt(s); \
-    x2[i] = (-b[i]+s)/(2.0*a[i]); \
-    x1[i] = (-b[i]-s)/(2.0*a[i]); \
+    x2[i] = (-b[i]+s)/(Real_type(2.0)*a[i]); \
+    x1[i] = (-b[i]-s)/(Real_type(2.0)*a[i]); \
   } else { \
     x2[i] = 0.0; \
     x1[i] = 0.0; \
   }
 
+#define IF_QUAD_SIMD_BODY  \
+  const Vec va = Vec::load(a+i); \
+  const Vec vb = Vec::load(b+i); \
+  const Vec vs = vb*vb - vfour*va*Vec::load(c+i); \
+  const Vec vsqrt = Vec::sqrt(vs); \
+  const Vec v2a = vtwo*va; \
+  Vec::selectNonNegative(vs, (-vb+vsqrt)/v2a, vzero).store(x2+i); \
+  Vec::selectNonNegative(vs, (-vb-vsqrt)/v2a, vzero).store(x1+i);
+
 #if defined(RAJA_ENABLE_CUDA)
 
   //
@@ -105,18 +115,37 @@ __global__ void ifquad(Real_ptr x1, Real_ptr x2,
 #endif // if defined(RAJA_ENABLE_CUDA)
 
 
-IF_QUAD::IF_QUAD(const RunParams& params)
+template <typename REAL, typename INDEX>
+IF_QUAD<REAL, INDEX>::IF_QUAD(const RunParams& params)
   : KernelBase(rajaperf::Basic_IF_QUAD, params)
 {
    setDefaultSize(100000);
    setDefaultReps(1800);
+
+#if defined(RAJA_ENABLE_OPENMP)
+   setVariantDefined(Base_OpenMP_Sched);
+#endif
+}
+
+template <typename REAL, typename INDEX>
+IF_QUAD<REAL, INDEX>::~IF_QUAD() 
+{
 }
 
-IF_QUAD::~IF_QUAD() 
+template <typename REAL, typename INDEX>
+double IF_QUAD<REAL, INDEX>::getBytesPerRep() const
 {
+  return 5.0 * sizeof(Real_type) * getRunSize();
 }
 
-void IF_QUAD::setUp(VariantID vid)
+template <typename REAL, typename INDEX>
+double IF_QUAD<REAL, INDEX>::getFLOPsPerRep() const
+{
+  return 13.0 * getRunSize();
+}
+
+template <typename REAL, typename INDEX>
+void IF_QUAD<REAL, INDEX>::setUp(VariantID vid)
 {
   allocAndInitDataRandSign(m_a, getRunSize(), vid);
   allocAndInitData(m_b, getRunSize(), vid);
@@ -125,9 +154,10 @@ void IF_QUAD::setUp(VariantID vid)
   allocAndInitData(m_x2, getRunSize(), vid);
 }
 
-void IF_QUAD::runKernel(VariantID vid)
+template <typename REAL, typename INDEX>
+void IF_QUAD<REAL, INDEX>::runKernel(VariantID vid)
 {
-  const Index_type run_reps = getRunReps();
+  const Index_type run_reps = getBatchReps();
   const Index_type ibegin = 0;
   const Index_type iend = getRunSize();
 
@@ -158,7 +188,75 @@ void IF_QUAD::runKernel(VariantID vid)
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         RAJA::forall<RAJA::simd_exec>(
-          RAJA::RangeSegment(ibegin, iend), [=](int i) {
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          IF_QUAD_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_Simd : {
+
+      IF_QUAD_DATA;
+
+#if defined(RAJAPERF_HAVE_SIMD_INTRINSICS)
+      typedef SimdVec<Real_type> Vec;
+      const Vec vzero = Vec::zero();
+      const Vec vtwo = Vec::set1(2.0);
+      const Vec vfour = Vec::set1(4.0);
+#endif
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+#if defined(RAJAPERF_HAVE_SIMD_INTRINSICS)
+        forallSimd<Vec>(ibegin, iend,
+          [=](Index_type i) { IF_QUAD_SIMD_BODY; },
+          [=](Index_type i) { IF_QUAD_BODY; });
+#else
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          IF_QUAD_BODY;
+        }
+#endif
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Simd : {
+
+      IF_QUAD_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          IF_QUAD_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_ThreadPool : {
+
+      IF_QUAD_DATA;
+
+      ThreadPool& pool = getThreadPool();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        pool.forall(ibegin, iend, [=](Index_type i) {
           IF_QUAD_BODY;
         });
 
@@ -195,7 +293,7 @@ void IF_QUAD::runKernel(VariantID vid)
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         RAJA::forall<RAJA::omp_parallel_for_exec>(
-          RAJA::RangeSegment(ibegin, iend), [=](int i) {
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           IF_QUAD_BODY;
         });
 
@@ -206,6 +304,43 @@ void IF_QUAD::runKernel(VariantID vid)
       break;
     }
 
+    case Base_OpenMP_Sched : {
+
+      IF_QUAD_DATA;
+
+      const OpenMPSchedule& sched = getOpenMPSchedule();
+      const int grain = getTaskloopGrainsize(sched, iend - ibegin);
+      setOpenMPRuntimeSchedule(sched);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if ( sched.kind == TaskloopSchedule ) {
+
+          #pragma omp parallel
+          #pragma omp single
+          {
+            #pragma omp taskloop grainsize(grain)
+            for (Index_type i = ibegin; i < iend; ++i ) {
+              IF_QUAD_BODY;
+            }
+          }
+
+        } else {
+
+          #pragma omp parallel for schedule(runtime)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            IF_QUAD_BODY;
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
 
 #define NUMTEAMS 128
@@ -214,7 +349,7 @@ void IF_QUAD::runKernel(VariantID vid)
 
       IF_QUAD_DATA;
 
-      int n = getRunSize();
+      Index_type n = getRunSize();
       #pragma omp target enter data map(to:a[0:n],b[0:n],c[0:n],x1[0:n],x2[0:n])
 
       startTimer();
@@ -237,7 +372,7 @@ void IF_QUAD::runKernel(VariantID vid)
 
       IF_QUAD_DATA;
 
-      int n = getRunSize();
+      Index_type n = getRunSize();
       #pragma omp target enter data map(to:a[0:n],b[0:n],c[0:n],x1[0:n],x2[0:n])
 
       startTimer();
@@ -259,6 +394,47 @@ void IF_QUAD::runKernel(VariantID vid)
 #endif //RAJA_ENABLE_TARGET_OPENMP
 #endif //RAJA_ENABLE_OMP                             
 
+#if defined(RAJA_ENABLE_TBB)
+    case Base_TBB : {
+
+      IF_QUAD_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(ibegin, iend),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            IF_QUAD_BODY;
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_TBB : {
+
+      IF_QUAD_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::tbb_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          IF_QUAD_BODY;
+        });
+
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
     case Base_CUDA : {
 
@@ -308,13 +484,15 @@ void IF_QUAD::runKernel(VariantID vid)
 
 }
 
-void IF_QUAD::updateChecksum(VariantID vid)
+template <typename REAL, typename INDEX>
+void IF_QUAD<REAL, INDEX>::updateChecksum(VariantID vid)
 {
   checksum[vid] += calcChecksum(m_x1, getRunSize());
   checksum[vid] += calcChecksum(m_x2, getRunSize());
 }
 
-void IF_QUAD::tearDown(VariantID vid)
+template <typename REAL, typename INDEX>
+void IF_QUAD<REAL, INDEX>::tearDown(VariantID vid)
 {
   (void) vid;
   deallocData(m_a);
@@ -324,5 +502,7 @@ void IF_QUAD::tearDown(VariantID vid)
   deallocData(m_x2);
 }
 
+RAJAPERF_INSTANTIATE_KERNEL(IF_QUAD);
+
 } // end namespace basic
 } // end namespace rajaperf
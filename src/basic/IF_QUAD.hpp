@@ -26,14 +26,20 @@ class RunParams;
 namespace basic
 {
 
+template <typename REAL, typename INDEX>
 class IF_QUAD : public KernelBase
 {
 public:
+  RAJAPERF_REAL_TYPES(REAL);
+  RAJAPERF_INDEX_TYPES(INDEX);
 
   IF_QUAD(const RunParams& params);
 
   ~IF_QUAD();
 
+  double getBytesPerRep() const;
+  double getFLOPsPerRep() const;
+
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
   void updateChecksum(VariantID vid);
@@ -24,6 +24,9 @@
 #include "INIT3.hpp"
 
 #include "common/DataUtils.hpp"
+#include "common/StdPar.hpp"
+#include "common/SimdIntrinsics.hpp"
+#include "common/StreamingStores.hpp"
 
 #include "RAJA/RAJA.hpp"
 
@@ -44,6 +47,21 @@ namespace basic
 #define INIT3_BODY  \
   out1[i] = out2[i] = out3[i] = - in1[i] - in2[i] ;
 
+#define INIT3_SIMD_BODY  \
+  const Vec vout = - Vec::load(in1+i) - Vec::load(in2+i); \
+  vout.store(out1+i); \
+  vout.store(out2+i); \
+  vout.store(out3+i);
+
+//
+// Value stored by INIT3_BODY, for *_NTStore variants.
+//
+#define INIT3_VALUE  \
+  - in1[i] - in2[i]
+
+#define INIT3_NT_OUTPUTS  \
+  Real_ptr const nt_out[3] = { out1, out2, out3 };
+
 
 #if defined(RAJA_ENABLE_CUDA)
 
@@ -89,18 +107,52 @@ __global__ void init3(Real_ptr out1, Real_ptr out2, Real_ptr out3,
 #endif // if defined(RAJA_ENABLE_CUDA)
 
 
-INIT3::INIT3(const RunParams& params)
+template <typename REAL, typename INDEX>
+INIT3<REAL, INDEX>::INIT3(const RunParams& params)
   : KernelBase(rajaperf::Basic_INIT3, params)
 {
    setDefaultSize(100000);
    setDefaultReps(5000);
+
+#if defined(RAJAPERF_ENABLE_STDPAR)
+   setVariantDefined(Base_StdPar);
+#endif
+
+#if defined(RAJAPERF_HAVE_NT_STORES)
+   setVariantDefined(Base_Seq_NTStore);
+   setVariantDefined(RAJA_Seq_NTStore);
+#if defined(RAJA_ENABLE_OPENMP)
+   setVariantDefined(Base_OpenMP_NTStore);
+   setVariantDefined(RAJA_OpenMP_NTStore);
+#endif
+#endif
 }
 
-INIT3::~INIT3() 
+template <typename REAL, typename INDEX>
+INIT3<REAL, INDEX>::~INIT3() 
 {
 }
 
-void INIT3::setUp(VariantID vid)
+template <typename REAL, typename INDEX>
+double INIT3<REAL, INDEX>::getBytesPerRep() const
+{
+  return 5.0 * sizeof(Real_type) * getRunSize();
+}
+
+template <typename REAL, typename INDEX>
+double INIT3<REAL, INDEX>::getBytesWrittenPerRep() const
+{
+  return 3.0 * sizeof(Real_type) * getRunSize();
+}
+
+template <typename REAL, typename INDEX>
+double INIT3<REAL, INDEX>::getFLOPsPerRep() const
+{
+  return 2.0 * getRunSize();
+}
+
+template <typename REAL, typename INDEX>
+void INIT3<REAL, INDEX>::setUp(VariantID vid)
 {
   allocAndInitData(m_out1, getRunSize(), vid);
   allocAndInitData(m_out2, getRunSize(), vid);
@@ -109,9 +161,10 @@ void INIT3::setUp(VariantID vid)
   allocAndInitData(m_in2, getRunSize(), vid);
 }
 
-void INIT3::runKernel(VariantID vid)
+template <typename REAL, typename INDEX>
+void INIT3<REAL, INDEX>::runKernel(VariantID vid)
 {
-  const Index_type run_reps = getRunReps();
+  const Index_type run_reps = getBatchReps();
   const Index_type ibegin = 0;
   const Index_type iend = getRunSize();
 
@@ -152,6 +205,133 @@ void INIT3::runKernel(VariantID vid)
       break;
     }
 
+    case Base_Simd : {
+
+      INIT3_DATA;
+
+#if defined(RAJAPERF_HAVE_SIMD_INTRINSICS)
+      typedef SimdVec<Real_type> Vec;
+#endif
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+#if defined(RAJAPERF_HAVE_SIMD_INTRINSICS)
+        forallSimd<Vec>(ibegin, iend,
+          [=](Index_type i) { INIT3_SIMD_BODY; },
+          [=](Index_type i) { INIT3_BODY; });
+#else
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          INIT3_BODY;
+        }
+#endif
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Simd : {
+
+      INIT3_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          INIT3_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RAJAPERF_HAVE_NT_STORES)
+    case Base_Seq_NTStore : {
+
+      INIT3_DATA;
+      INIT3_NT_OUTPUTS;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        ntStoreRange(nt_out, ibegin, iend, [=](Index_type i) {
+          return INIT3_VALUE;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq_NTStore : {
+
+      INIT3_DATA;
+      INIT3_NT_OUTPUTS;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        forallNTStore<RAJA::seq_exec>(nt_out, ibegin, iend, 
+          [=](Index_type i) {
+          return INIT3_VALUE;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
+    case Base_ThreadPool : {
+
+      INIT3_DATA;
+
+      ThreadPool& pool = getThreadPool();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        pool.forall(ibegin, iend, [=](Index_type i) {
+          INIT3_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RAJAPERF_ENABLE_STDPAR)
+    case Base_StdPar : {
+
+      INIT3_DATA;
+
+      typedef IndexIterator<Index_type> Iter;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        std::for_each(std::execution::par_unseq,
+                      Iter(ibegin), Iter(iend),
+                      [=](Index_type i) {
+          INIT3_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_OPENMP)
     case Base_OpenMP : {
 
@@ -189,6 +369,52 @@ void INIT3::runKernel(VariantID vid)
       break;
     }
 
+#if defined(RAJAPERF_HAVE_NT_STORES)
+    case Base_OpenMP_NTStore : {
+
+      INIT3_DATA;
+      INIT3_NT_OUTPUTS;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          Index_type cbegin, cend;
+          getNTStoreChunk<Real_type>(ibegin, iend, 
+                                     omp_get_num_threads(), 
+                                     omp_get_thread_num(), cbegin, cend);
+          ntStoreRange(nt_out, cbegin, cend, [=](Index_type i) {
+            return INIT3_VALUE;
+          });
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP_NTStore : {
+
+      INIT3_DATA;
+      INIT3_NT_OUTPUTS;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        forallNTStore<RAJA::omp_parallel_for_exec>(nt_out, ibegin, iend, 
+          [=](Index_type i) {
+          return INIT3_VALUE;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
 
 #define NUMTEAMS 128
@@ -197,7 +423,7 @@ void INIT3::runKernel(VariantID vid)
 
       INIT3_DATA;
 
-      int n = getRunSize();
+      Index_type n = getRunSize();
       #pragma omp target enter data map(to:in1[0:n],in2[0:n],out1[0:n],out2[0:n],out3[0:n])
 
       startTimer();
@@ -220,7 +446,7 @@ void INIT3::runKernel(VariantID vid)
 
       INIT3_DATA;
 
-      int n = getRunSize();
+      Index_type n = getRunSize();
       #pragma omp target enter data map(to:in1[0:n],in2[0:n],out1[0:n],out2[0:n],out3[0:n])
 
       startTimer();
@@ -242,6 +468,46 @@ void INIT3::runKernel(VariantID vid)
 #endif //RAJA_ENABLE_TARGET_OPENMP
 #endif //RAJA_ENABLE_OMP                             
 
+#if defined(RAJA_ENABLE_TBB)
+    case Base_TBB : {
+
+      INIT3_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(ibegin, iend),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            INIT3_BODY;
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_TBB : {
+
+      INIT3_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::tbb_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          INIT3_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
     case Base_CUDA : {
 
@@ -291,14 +557,16 @@ void INIT3::runKernel(VariantID vid)
 
 }
 
-void INIT3::updateChecksum(VariantID vid)
+template <typename REAL, typename INDEX>
+void INIT3<REAL, INDEX>::updateChecksum(VariantID vid)
 {
   checksum[vid] += calcChecksum(m_out1, getRunSize());
   checksum[vid] += calcChecksum(m_out2, getRunSize());
   checksum[vid] += calcChecksum(m_out3, getRunSize());
 }
 
-void INIT3::tearDown(VariantID vid)
+template <typename REAL, typename INDEX>
+void INIT3<REAL, INDEX>::tearDown(VariantID vid)
 {
   (void) vid;
   deallocData(m_out1);
@@ -308,5 +576,7 @@ void INIT3::tearDown(VariantID vid)
   deallocData(m_in2);
 }
 
+RAJAPERF_INSTANTIATE_KERNEL(INIT3);
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -26,14 +26,21 @@ class RunParams;
 namespace basic
 {
 
+template <typename REAL, typename INDEX>
 class INIT3 : public KernelBase
 {
 public:
+  RAJAPERF_REAL_TYPES(REAL);
+  RAJAPERF_INDEX_TYPES(INDEX);
 
   INIT3(const RunParams& params);
 
   ~INIT3();
 
+  double getBytesPerRep() const;
+  double getBytesWrittenPerRep() const;
+  double getFLOPsPerRep() const;
+
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
   void updateChecksum(VariantID vid);
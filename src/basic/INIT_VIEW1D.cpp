@@ -29,6 +29,7 @@
 #include "INIT_VIEW1D.hpp"
 
 #include "common/DataUtils.hpp"
+#include "common/SimdIntrinsics.hpp"
 
 #include "RAJA/RAJA.hpp"
 
@@ -54,6 +55,9 @@ namespace basic
 #define INIT_VIEW1D_BODY  \
   a[i] = v;
 
+#define INIT_VIEW1D_SIMD_BODY  \
+  vv.store(a+i);
+
 #define INIT_VIEW1D_BODY_RAJA  \
   view(i) = v;
 
@@ -99,26 +103,42 @@ __global__ void initview1d(Real_ptr a,
 #endif // if defined(RAJA_ENABLE_CUDA)
 
 
-INIT_VIEW1D::INIT_VIEW1D(const RunParams& params)
+template <typename REAL, typename INDEX>
+INIT_VIEW1D<REAL, INDEX>::INIT_VIEW1D(const RunParams& params)
   : KernelBase(rajaperf::Basic_INIT_VIEW1D, params)
 {
    setDefaultSize(500000);
    setDefaultReps(5000);
 }
 
-INIT_VIEW1D::~INIT_VIEW1D() 
+template <typename REAL, typename INDEX>
+INIT_VIEW1D<REAL, INDEX>::~INIT_VIEW1D() 
+{
+}
+
+template <typename REAL, typename INDEX>
+double INIT_VIEW1D<REAL, INDEX>::getBytesPerRep() const
+{
+  return 1.0 * sizeof(Real_type) * getRunSize();
+}
+
+template <typename REAL, typename INDEX>
+double INIT_VIEW1D<REAL, INDEX>::getFLOPsPerRep() const
 {
+  return 0.0;
 }
 
-void INIT_VIEW1D::setUp(VariantID vid)
+template <typename REAL, typename INDEX>
+void INIT_VIEW1D<REAL, INDEX>::setUp(VariantID vid)
 {
   allocAndInitData(m_a, getRunSize(), vid);
   m_val = 0.123;
 }
 
-void INIT_VIEW1D::runKernel(VariantID vid)
+template <typename REAL, typename INDEX>
+void INIT_VIEW1D<REAL, INDEX>::runKernel(VariantID vid)
 {
-  const Index_type run_reps = getRunReps();
+  const Index_type run_reps = getBatchReps();
   const Index_type ibegin = 0;
   const Index_type iend = getRunSize();
 
@@ -161,6 +181,72 @@ void INIT_VIEW1D::runKernel(VariantID vid)
       break;
     }
 
+    case Base_Simd : {
+
+      INIT_VIEW1D_DATA;
+
+#if defined(RAJAPERF_HAVE_SIMD_INTRINSICS)
+      typedef SimdVec<Real_type> Vec;
+      const Vec vv = Vec::set1(v);
+#endif
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+#if defined(RAJAPERF_HAVE_SIMD_INTRINSICS)
+        forallSimd<Vec>(ibegin, iend,
+          [=](Index_type i) { INIT_VIEW1D_SIMD_BODY; },
+          [=](Index_type i) { INIT_VIEW1D_BODY; });
+#else
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          INIT_VIEW1D_BODY;
+        }
+#endif
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Simd : {
+
+      INIT_VIEW1D_DATA_RAJA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          INIT_VIEW1D_BODY_RAJA;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_ThreadPool : {
+
+      INIT_VIEW1D_DATA;
+
+      ThreadPool& pool = getThreadPool();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        pool.forall(ibegin, iend, [=](Index_type i) {
+          INIT_VIEW1D_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
 #if defined(RAJA_ENABLE_OPENMP)
     case Base_OpenMP : {
 
@@ -251,6 +337,46 @@ void INIT_VIEW1D::runKernel(VariantID vid)
 #endif //RAJA_ENABLE_TARGET_OPENMP
 #endif //RAJA_ENABLE_OMP                             
 
+#if defined(RAJA_ENABLE_TBB)
+    case Base_TBB : {
+
+      INIT_VIEW1D_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(ibegin, iend),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            INIT_VIEW1D_BODY;
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_TBB : {
+
+      INIT_VIEW1D_DATA_RAJA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::tbb_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          INIT_VIEW1D_BODY_RAJA;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
     case Base_CUDA : {
 
@@ -301,16 +427,20 @@ void INIT_VIEW1D::runKernel(VariantID vid)
 
 }
 
-void INIT_VIEW1D::updateChecksum(VariantID vid)
+template <typename REAL, typename INDEX>
+void INIT_VIEW1D<REAL, INDEX>::updateChecksum(VariantID vid)
 {
   checksum[vid] += calcChecksum(m_a, getRunSize());
 }
 
-void INIT_VIEW1D::tearDown(VariantID vid)
+template <typename REAL, typename INDEX>
+void INIT_VIEW1D<REAL, INDEX>::tearDown(VariantID vid)
 {
   (void) vid;
   deallocData(m_a);
 }
 
+RAJAPERF_INSTANTIATE_KERNEL(INIT_VIEW1D);
+
 } // end namespace basic
 } // end namespace rajaperf
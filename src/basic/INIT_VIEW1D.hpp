@@ -26,14 +26,20 @@ class RunParams;
 namespace basic
 {
 
+template <typename REAL, typename INDEX>
 class INIT_VIEW1D : public KernelBase
 {
 public:
+  RAJAPERF_REAL_TYPES(REAL);
+  RAJAPERF_INDEX_TYPES(INDEX);
 
   INIT_VIEW1D(const RunParams& params);
 
   ~INIT_VIEW1D();
 
+  double getBytesPerRep() const;
+  double getFLOPsPerRep() const;
+
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
   void updateChecksum(VariantID vid);
@@ -29,6 +29,7 @@
 #include "INIT_VIEW1D_OFFSET.hpp"
 
 #include "common/DataUtils.hpp"
+#include "common/SimdIntrinsics.hpp"
 
 #include "RAJA/RAJA.hpp"
 
@@ -53,6 +54,9 @@ namespace basic
 #define INIT_VIEW1D_OFFSET_BODY  \
   a[i-ibegin] = v;
 
+#define INIT_VIEW1D_OFFSET_SIMD_BODY  \
+  vv.store(a+i-ibegin);
+
 #define INIT_VIEW1D_OFFSET_BODY_RAJA  \
   view(i) = v;
 
@@ -98,26 +102,42 @@ __global__ void initview1d(Real_ptr a,
 #endif // if defined(RAJA_ENABLE_CUDA)
 
 
-INIT_VIEW1D_OFFSET::INIT_VIEW1D_OFFSET(const RunParams& params)
+template <typename REAL, typename INDEX>
+INIT_VIEW1D_OFFSET<REAL, INDEX>::INIT_VIEW1D_OFFSET(const RunParams& params)
   : KernelBase(rajaperf::Basic_INIT_VIEW1D_OFFSET, params)
 {
    setDefaultSize(500000);
    setDefaultReps(5000);
 }
 
-INIT_VIEW1D_OFFSET::~INIT_VIEW1D_OFFSET() 
+template <typename REAL, typename INDEX>
+INIT_VIEW1D_OFFSET<REAL, INDEX>::~INIT_VIEW1D_OFFSET() 
+{
+}
+
+template <typename REAL, typename INDEX>
+double INIT_VIEW1D_OFFSET<REAL, INDEX>::getBytesPerRep() const
+{
+  return 1.0 * sizeof(Real_type) * getRunSize();
+}
+
+template <typename REAL, typename INDEX>
+double INIT_VIEW1D_OFFSET<REAL, INDEX>::getFLOPsPerRep() const
 {
+  return 0.0;
 }
 
-void INIT_VIEW1D_OFFSET::setUp(VariantID vid)
+template <typename REAL, typename INDEX>
+void INIT_VIEW1D_OFFSET<REAL, INDEX>::setUp(VariantID vid)
 {
   allocAndInitData(m_a, getRunSize(), vid);
   m_val = 0.123;  
 }
 
-void INIT_VIEW1D_OFFSET::runKernel(VariantID vid)
+template <typename REAL, typename INDEX>
+void INIT_VIEW1D_OFFSET<REAL, INDEX>::runKernel(VariantID vid)
 {
-  const Index_type run_reps = getRunReps();
+  const Index_type run_reps = getBatchReps();
   const Index_type ibegin = 1;
   const Index_type iend = getRunSize()+1;
 
@@ -160,6 +180,72 @@ void INIT_VIEW1D_OFFSET::runKernel(VariantID vid)
       break;
     }
 
+    case Base_Simd : {
+
+      INIT_VIEW1D_OFFSET_DATA;
+
+#if defined(RAJAPERF_HAVE_SIMD_INTRINSICS)
+      typedef SimdVec<Real_type> Vec;
+      const Vec vv = Vec::set1(v);
+#endif
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+#if defined(RAJAPERF_HAVE_SIMD_INTRINSICS)
+        forallSimd<Vec>(ibegin, iend,
+          [=](Index_type i) { INIT_VIEW1D_OFFSET_SIMD_BODY; },
+          [=](Index_type i) { INIT_VIEW1D_OFFSET_BODY; });
+#else
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          INIT_VIEW1D_OFFSET_BODY;
+        }
+#endif
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Simd : {
+
+      INIT_VIEW1D_OFFSET_DATA_RAJA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          INIT_VIEW1D_OFFSET_BODY_RAJA;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_ThreadPool : {
+
+      INIT_VIEW1D_OFFSET_DATA;
+
+      ThreadPool& pool = getThreadPool();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        pool.forall(ibegin, iend, [=](Index_type i) {
+          INIT_VIEW1D_OFFSET_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
 #if defined(RAJA_ENABLE_OPENMP)
     case Base_OpenMP : {
 
@@ -252,6 +338,46 @@ void INIT_VIEW1D_OFFSET::runKernel(VariantID vid)
 #endif //RAJA_ENABLE_OMP                             
 
 
+#if defined(RAJA_ENABLE_TBB)
+    case Base_TBB : {
+
+      INIT_VIEW1D_OFFSET_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(ibegin, iend),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            INIT_VIEW1D_OFFSET_BODY;
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_TBB : {
+
+      INIT_VIEW1D_OFFSET_DATA_RAJA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::tbb_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          INIT_VIEW1D_OFFSET_BODY_RAJA;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
     case Base_CUDA : {
 
@@ -302,16 +428,20 @@ void INIT_VIEW1D_OFFSET::runKernel(VariantID vid)
 
 }
 
-void INIT_VIEW1D_OFFSET::updateChecksum(VariantID vid)
+template <typename REAL, typename INDEX>
+void INIT_VIEW1D_OFFSET<REAL, INDEX>::updateChecksum(VariantID vid)
 {
   checksum[vid] += calcChecksum(m_a, getRunSize());
 }
 
-void INIT_VIEW1D_OFFSET::tearDown(VariantID vid)
+template <typename REAL, typename INDEX>
+void INIT_VIEW1D_OFFSET<REAL, INDEX>::tearDown(VariantID vid)
 {
   (void) vid;
   deallocData(m_a);
 }
 
+RAJAPERF_INSTANTIATE_KERNEL(INIT_VIEW1D_OFFSET);
+
 } // end namespace basic
 } // end namespace rajaperf
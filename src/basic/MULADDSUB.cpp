@@ -26,6 +26,8 @@
 #include "MULADDSUB.hpp"
 
 #include "common/DataUtils.hpp"
+#include "common/StdPar.hpp"
+#include "common/SimdIntrinsics.hpp"
 
 #include "RAJA/RAJA.hpp"
 
@@ -48,6 +50,13 @@ namespace basic
   out2[i] = in1[i] + in2[i] ; \
   out3[i] = in1[i] - in2[i] ;
 
+#define MULADDSUB_SIMD_BODY  \
+  const Vec vin1 = Vec::load(in1+i); \
+  const Vec vin2 = Vec::load(in2+i); \
+  ( vin1 * vin2 ).store(out1+i); \
+  ( vin1 + vin2 ).store(out2+i); \
+  ( vin1 - vin2 ).store(out3+i);
+
 
 #if defined(RAJA_ENABLE_CUDA)
 
@@ -93,18 +102,37 @@ __global__ void muladdsub(Real_ptr out1, Real_ptr out2, Real_ptr out3,
 #endif // if defined(RAJA_ENABLE_CUDA)
 
 
-MULADDSUB::MULADDSUB(const RunParams& params)
+template <typename REAL, typename INDEX>
+MULADDSUB<REAL, INDEX>::MULADDSUB(const RunParams& params)
   : KernelBase(rajaperf::Basic_MULADDSUB, params)
 {
    setDefaultSize(100000);
    setDefaultReps(3500);
+
+#if defined(RAJAPERF_ENABLE_STDPAR)
+   setVariantDefined(Base_StdPar);
+#endif
+}
+
+template <typename REAL, typename INDEX>
+MULADDSUB<REAL, INDEX>::~MULADDSUB() 
+{
+}
+
+template <typename REAL, typename INDEX>
+double MULADDSUB<REAL, INDEX>::getBytesPerRep() const
+{
+  return 5.0 * sizeof(Real_type) * getRunSize();
 }
 
-MULADDSUB::~MULADDSUB() 
+template <typename REAL, typename INDEX>
+double MULADDSUB<REAL, INDEX>::getFLOPsPerRep() const
 {
+  return 3.0 * getRunSize();
 }
 
-void MULADDSUB::setUp(VariantID vid)
+template <typename REAL, typename INDEX>
+void MULADDSUB<REAL, INDEX>::setUp(VariantID vid)
 {
   allocAndInitData(m_out1, getRunSize(), vid);
   allocAndInitData(m_out2, getRunSize(), vid);
@@ -113,9 +141,10 @@ void MULADDSUB::setUp(VariantID vid)
   allocAndInitData(m_in2, getRunSize(), vid);
 }
 
-void MULADDSUB::runKernel(VariantID vid)
+template <typename REAL, typename INDEX>
+void MULADDSUB<REAL, INDEX>::runKernel(VariantID vid)
 {
-  const Index_type run_reps = getRunReps();
+  const Index_type run_reps = getBatchReps();
   const Index_type ibegin = 0;
   const Index_type iend = getRunSize();
 
@@ -156,6 +185,94 @@ void MULADDSUB::runKernel(VariantID vid)
       break;
     }
 
+    case Base_Simd : {
+
+      MULADDSUB_DATA;
+
+#if defined(RAJAPERF_HAVE_SIMD_INTRINSICS)
+      typedef SimdVec<Real_type> Vec;
+#endif
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+#if defined(RAJAPERF_HAVE_SIMD_INTRINSICS)
+        forallSimd<Vec>(ibegin, iend,
+          [=](Index_type i) { MULADDSUB_SIMD_BODY; },
+          [=](Index_type i) { MULADDSUB_BODY; });
+#else
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          MULADDSUB_BODY;
+        }
+#endif
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Simd : {
+
+      MULADDSUB_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          MULADDSUB_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_ThreadPool : {
+
+      MULADDSUB_DATA;
+
+      ThreadPool& pool = getThreadPool();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        pool.forall(ibegin, iend, [=](Index_type i) {
+          MULADDSUB_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RAJAPERF_ENABLE_STDPAR)
+    case Base_StdPar : {
+
+      MULADDSUB_DATA;
+
+      typedef IndexIterator<Index_type> Iter;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        std::for_each(std::execution::par_unseq,
+                      Iter(ibegin), Iter(iend),
+                      [=](Index_type i) {
+          MULADDSUB_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_OPENMP)
     case Base_OpenMP : {
 
@@ -201,7 +318,7 @@ void MULADDSUB::runKernel(VariantID vid)
 
       MULADDSUB_DATA;
 
-      int n = getRunSize();
+      Index_type n = getRunSize();
       #pragma omp target enter data map(to:in1[0:n],in2[0:n],out1[0:n],out2[0:n],out3[0:n])
 
       startTimer();
@@ -224,7 +341,7 @@ void MULADDSUB::runKernel(VariantID vid)
 
       MULADDSUB_DATA;
 
-      int n = getRunSize();
+      Index_type n = getRunSize();
       #pragma omp target enter data map(to:in1[0:n],in2[0:n],out1[0:n],out2[0:n],out3[0:n])
 
       startTimer();
@@ -246,6 +363,46 @@ void MULADDSUB::runKernel(VariantID vid)
 #endif //RAJA_ENABLE_TARGET_OPENMP
 #endif //RAJA_ENABLE_OMP
 
+#if defined(RAJA_ENABLE_TBB)
+    case Base_TBB : {
+
+      MULADDSUB_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(ibegin, iend),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            MULADDSUB_BODY;
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_TBB : {
+
+      MULADDSUB_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::tbb_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          MULADDSUB_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
     case Base_CUDA : {
 
@@ -296,14 +453,16 @@ void MULADDSUB::runKernel(VariantID vid)
 
 }
 
-void MULADDSUB::updateChecksum(VariantID vid)
+template <typename REAL, typename INDEX>
+void MULADDSUB<REAL, INDEX>::updateChecksum(VariantID vid)
 {
   checksum[vid] += calcChecksum(m_out1, getRunSize());
   checksum[vid] += calcChecksum(m_out2, getRunSize());
   checksum[vid] += calcChecksum(m_out3, getRunSize());
 }
 
-void MULADDSUB::tearDown(VariantID vid)
+template <typename REAL, typename INDEX>
+void MULADDSUB<REAL, INDEX>::tearDown(VariantID vid)
 {
   (void) vid;
   deallocData(m_out1);
@@ -313,5 +472,7 @@ void MULADDSUB::tearDown(VariantID vid)
   deallocData(m_in2);
 }
 
+RAJAPERF_INSTANTIATE_KERNEL(MULADDSUB);
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -26,14 +26,20 @@ class RunParams;
 namespace basic
 {
 
+template <typename REAL, typename INDEX>
 class MULADDSUB : public KernelBase
 {
 public:
+  RAJAPERF_REAL_TYPES(REAL);
+  RAJAPERF_INDEX_TYPES(INDEX);
 
   MULADDSUB(const RunParams& params);
 
   ~MULADDSUB();
 
+  double getBytesPerRep() const;
+  double getFLOPsPerRep() const;
+
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
   void updateChecksum(VariantID vid);
@@ -41,21 +41,21 @@ namespace basic
 
 #define NESTED_INIT_DATA \
   ResReal_ptr array = m_array; \
-  Int_type ni = m_ni; \
-  Int_type nj = m_nj; \
-  Int_type nk = m_nk;
+  Index_type ni = m_ni; \
+  Index_type nj = m_nj; \
+  Index_type nk = m_nk;
 
 #define NESTED_INIT_BODY  \
-  array[i+ni*(j+nj*k)] = 0.00000001 * i * j * k ;
+  array[i+ni*(j+nj*k)] = Real_type(0.00000001) * i * j * k ;
 
 
 #if defined(RAJA_ENABLE_CUDA)
 
 #define NESTED_INIT_DATA_SETUP_CUDA \
   Real_ptr array; \
-  Int_type ni = m_ni; \
-  Int_type nj = m_nj; \
-  Int_type nk = m_nk; \
+  Index_type ni = m_ni; \
+  Index_type nj = m_nj; \
+  Index_type nk = m_nk; \
 \
   allocAndInitCudaDeviceData(array, m_array, ni * nj * nk);
 
@@ -64,7 +64,7 @@ namespace basic
   deallocCudaDeviceData(array);
 
 __global__ void nested_init(Real_ptr array,
-                            Int_type ni, Int_type nj)
+                            Index_type ni, Index_type nj)
 {
    Index_type i = threadIdx.x;
    Index_type j = blockIdx.y;
@@ -76,7 +76,8 @@ __global__ void nested_init(Real_ptr array,
 #endif // if defined(RAJA_ENABLE_CUDA)
 
 
-NESTED_INIT::NESTED_INIT(const RunParams& params)
+template <typename REAL, typename INDEX>
+NESTED_INIT<REAL, INDEX>::NESTED_INIT(const RunParams& params)
   : KernelBase(rajaperf::Basic_NESTED_INIT, params)
 {
   m_ni = 500;
@@ -87,24 +88,39 @@ NESTED_INIT::NESTED_INIT(const RunParams& params)
   setDefaultReps(100);
 }
 
-NESTED_INIT::~NESTED_INIT() 
+template <typename REAL, typename INDEX>
+NESTED_INIT<REAL, INDEX>::~NESTED_INIT() 
 {
 }
 
-void NESTED_INIT::setUp(VariantID vid)
+template <typename REAL, typename INDEX>
+double NESTED_INIT<REAL, INDEX>::getBytesPerRep() const
+{
+  return 1.0 * sizeof(Real_type) * getRunSize();
+}
+
+template <typename REAL, typename INDEX>
+double NESTED_INIT<REAL, INDEX>::getFLOPsPerRep() const
+{
+  return 3.0 * getRunSize();
+}
+
+template <typename REAL, typename INDEX>
+void NESTED_INIT<REAL, INDEX>::setUp(VariantID vid)
 {
   (void) vid;
 
-  m_nk = m_nk_init * static_cast<Real_type>( getRunSize() ) / getDefaultSize();
+  m_nk = m_nk_init * static_cast<double>( getRunSize() ) / getDefaultSize();
 
-  int len = m_ni * m_nj * m_nk;
+  Index_type len = m_ni * m_nj * m_nk;
   m_array = RAJA::allocate_aligned_type<Real_type>(RAJA::DATA_ALIGN,
                                                    len*sizeof(Real_type)); 
 }
 
-void NESTED_INIT::runKernel(VariantID vid)
+template <typename REAL, typename INDEX>
+void NESTED_INIT<REAL, INDEX>::runKernel(VariantID vid)
 {
-  const Index_type run_reps = getRunReps();
+  const Index_type run_reps = getBatchReps();
 
   switch ( vid ) {
 
@@ -178,6 +194,100 @@ void NESTED_INIT::runKernel(VariantID vid)
       break;
     }
 
+    case Base_Simd : {
+
+      NESTED_INIT_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type k = 0; k < nk; ++k ) {
+          for (Index_type j = 0; j < nj; ++j ) {
+            RAJAPERF_SIMD
+            for (Index_type i = 0; i < ni; ++i ) {
+              NESTED_INIT_BODY;
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Simd : {
+
+#if defined(USE_FORALLN_FOR_SEQ)
+
+      NESTED_INIT_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forallN< RAJA::NestedPolicy< 
+                       RAJA::ExecList< RAJA::seq_exec,
+                                       RAJA::seq_exec,
+                                       RAJA::simd_exec > > > (
+              RAJA::RangeSegment(0, nk),
+              RAJA::RangeSegment(0, nj),
+              RAJA::RangeSegment(0, ni),
+          [=](Index_type k, Index_type j, Index_type i) {     
+          NESTED_INIT_BODY;
+        });
+
+      }
+      stopTimer();
+
+#else // use RAJA::nested
+
+      NESTED_INIT_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::nested::forall(RAJA::nested::Policy< 
+                             RAJA::nested::For<2, RAJA::seq_exec>,      // k
+                             RAJA::nested::For<1, RAJA::seq_exec>,      // j
+                             RAJA::nested::For<0, RAJA::simd_exec> >{}, // i
+                             camp::make_tuple(RAJA::RangeSegment(0, ni),
+                                              RAJA::RangeSegment(0, nj),
+                                              RAJA::RangeSegment(0, nk)),
+             [=](Index_type i, Index_type j, Index_type k) {     
+             NESTED_INIT_BODY;
+        });
+
+      }
+      stopTimer();
+
+#endif
+
+      break;
+    }
+
+    case Base_ThreadPool : {
+
+      NESTED_INIT_DATA;
+
+      ThreadPool& pool = getThreadPool();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        pool.forall(0, nk, [=](Index_type k) {
+          for (Index_type j = 0; j < nj; ++j ) {
+            for (Index_type i = 0; i < ni; ++i ) {
+              NESTED_INIT_BODY;
+            }
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
 #if defined(RAJA_ENABLE_OPENMP)
     case Base_OpenMP : {
 
@@ -315,6 +425,81 @@ void NESTED_INIT::runKernel(VariantID vid)
 #endif //RAJA_ENABLE_TARGET_OPENMP
 #endif //RAJA_ENABLE_OMP   
 
+#if defined(RAJA_ENABLE_TBB)
+    case Base_TBB : {
+
+      NESTED_INIT_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(0, nk),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type k = r.begin(); k < r.end(); ++k ) {
+            for (Index_type j = 0; j < nj; ++j ) {
+              for (Index_type i = 0; i < ni; ++i ) {
+                NESTED_INIT_BODY;
+              }
+            }
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_TBB : {
+
+#if defined(USE_FORALLN_FOR_TBB)
+
+      NESTED_INIT_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forallN< RAJA::NestedPolicy< 
+                       RAJA::ExecList< RAJA::tbb_for_exec,
+                                       RAJA::seq_exec,
+                                       RAJA::simd_exec > > > (
+              RAJA::RangeSegment(0, nk),
+              RAJA::RangeSegment(0, nj),
+              RAJA::RangeSegment(0, ni),
+          [=](Index_type k, Index_type j, Index_type i) {     
+          NESTED_INIT_BODY;
+        });
+
+      }
+      stopTimer();
+
+#else // use RAJA::nested
+
+      NESTED_INIT_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::nested::forall(RAJA::nested::Policy< 
+                             RAJA::nested::For<2, RAJA::tbb_for_exec>,      // k
+                             RAJA::nested::For<1, RAJA::seq_exec>,      // j
+                             RAJA::nested::For<0, RAJA::simd_exec> >{}, // i
+                             camp::make_tuple(RAJA::RangeSegment(0, ni),
+                                              RAJA::RangeSegment(0, nj),
+                                              RAJA::RangeSegment(0, nk)),
+             [=](Index_type i, Index_type j, Index_type k) {     
+             NESTED_INIT_BODY;
+        });
+
+      }
+      stopTimer();
+
+#endif
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
     case Base_CUDA : {
 
@@ -399,17 +584,21 @@ void NESTED_INIT::runKernel(VariantID vid)
 
 }
 
-void NESTED_INIT::updateChecksum(VariantID vid)
+template <typename REAL, typename INDEX>
+void NESTED_INIT<REAL, INDEX>::updateChecksum(VariantID vid)
 {
   checksum[vid] += calcChecksum(m_array, m_ni * m_nj * m_nk);
 }
 
-void NESTED_INIT::tearDown(VariantID vid)
+template <typename REAL, typename INDEX>
+void NESTED_INIT<REAL, INDEX>::tearDown(VariantID vid)
 {
   (void) vid;
   RAJA::free_aligned(m_array);
   m_array = 0; 
 }
 
+RAJAPERF_INSTANTIATE_KERNEL(NESTED_INIT);
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -26,14 +26,20 @@ class RunParams;
 namespace basic
 {
 
+template <typename REAL, typename INDEX>
 class NESTED_INIT : public KernelBase
 {
 public:
+  RAJAPERF_REAL_TYPES(REAL);
+  RAJAPERF_INDEX_TYPES(INDEX);
 
   NESTED_INIT(const RunParams& params);
 
   ~NESTED_INIT();
 
+  double getBytesPerRep() const;
+  double getFLOPsPerRep() const;
+
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
   void updateChecksum(VariantID vid);
@@ -41,10 +47,10 @@ public:
 
 private:
   Real_ptr m_array;
-  Int_type m_ni;
-  Int_type m_nj;
-  Int_type m_nk;
-  Int_type m_nk_init;
+  Index_type m_ni;
+  Index_type m_nj;
+  Index_type m_nk;
+  Index_type m_nk_init;
 };
 
 } // end namespace basic
@@ -34,11 +34,14 @@
 #include "REDUCE3_INT.hpp"
 
 #include "common/DataUtils.hpp"
+#include "common/StdPar.hpp"
 
 #include "RAJA/RAJA.hpp"
 
 #include <limits>
+#include <algorithm>
 #include <iostream>
+#include <vector>
 
 namespace rajaperf 
 {
@@ -125,18 +128,39 @@ __global__ void reduce3int(Int_ptr vec,
 #endif // if defined(RAJA_ENABLE_CUDA)
 
 
-REDUCE3_INT::REDUCE3_INT(const RunParams& params)
+template <typename REAL, typename INDEX>
+REDUCE3_INT<REAL, INDEX>::REDUCE3_INT(const RunParams& params)
   : KernelBase(rajaperf::Basic_REDUCE3_INT, params)
 {
    setDefaultSize(1000000);
-   setDefaultReps(5000);
+// setDefaultReps(5000);
+// artificially limit until we reconcile raja omp-target reducer performance
+   setDefaultReps(100);
+
+#if defined(RAJAPERF_ENABLE_STDPAR)
+   setVariantDefined(Base_StdPar);
+#endif
+}
+
+template <typename REAL, typename INDEX>
+REDUCE3_INT<REAL, INDEX>::~REDUCE3_INT() 
+{
 }
 
-REDUCE3_INT::~REDUCE3_INT() 
+template <typename REAL, typename INDEX>
+double REDUCE3_INT<REAL, INDEX>::getBytesPerRep() const
 {
+  return 1.0 * sizeof(Int_type) * getRunSize();
 }
 
-void REDUCE3_INT::setUp(VariantID vid)
+template <typename REAL, typename INDEX>
+double REDUCE3_INT<REAL, INDEX>::getFLOPsPerRep() const
+{
+  return 0.0;
+}
+
+template <typename REAL, typename INDEX>
+void REDUCE3_INT<REAL, INDEX>::setUp(VariantID vid)
 {
   allocAndInitData(m_vec, getRunSize(), vid);
 
@@ -148,10 +172,10 @@ void REDUCE3_INT::setUp(VariantID vid)
   m_vmax_init = std::numeric_limits<Int_type>::min();
 }
 
-void REDUCE3_INT::runKernel(VariantID vid)
+template <typename REAL, typename INDEX>
+void REDUCE3_INT<REAL, INDEX>::runKernel(VariantID vid)
 {
-  //const Index_type run_reps = getRunReps();
-  const Index_type run_reps = 100; //artificially limit until we reconcile raja omp-target reducer performance
+  const Index_type run_reps = getBatchReps();
   const Index_type ibegin = 0;
   const Index_type iend = getRunSize();
 
@@ -208,6 +232,150 @@ void REDUCE3_INT::runKernel(VariantID vid)
       break;
     }
 
+    case Base_Simd : {
+
+      REDUCE3_INT_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Int_type vsum = m_vsum_init;
+        Int_type vmin = m_vmin_init;
+        Int_type vmax = m_vmax_init;
+
+        RAJAPERF_SIMD_REDUCE(reduction(+:vsum) reduction(min:vmin)
+                             reduction(max:vmax))
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          REDUCE3_INT_BODY;
+        }
+
+        m_vsum += vsum;
+        m_vmin = RAJA_MIN(m_vmin, vmin);
+        m_vmax = RAJA_MAX(m_vmax, vmax);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Simd : {
+
+      REDUCE3_INT_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::ReduceSum<RAJA::seq_reduce, Int_type> vsum(m_vsum_init);
+        RAJA::ReduceMin<RAJA::seq_reduce, Int_type> vmin(m_vmin_init);
+        RAJA::ReduceMax<RAJA::seq_reduce, Int_type> vmax(m_vmax_init);
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          REDUCE3_INT_BODY_RAJA;
+        });
+
+        m_vsum += static_cast<Int_type>(vsum.get());
+        m_vmin = RAJA_MIN(m_vmin, static_cast<Int_type>(vmin.get()));
+        m_vmax = RAJA_MAX(m_vmax, static_cast<Int_type>(vmax.get()));
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_ThreadPool : {
+
+      REDUCE3_INT_DATA;
+
+      ThreadPool& pool = getThreadPool();
+      std::vector<Int_type> vsum_part(pool.getNumThreads());
+      std::vector<Int_type> vmin_part(pool.getNumThreads());
+      std::vector<Int_type> vmax_part(pool.getNumThreads());
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        std::fill(vsum_part.begin(), vsum_part.end(), 0);
+        std::fill(vmin_part.begin(), vmin_part.end(), m_vmin_init);
+        std::fill(vmax_part.begin(), vmax_part.end(), m_vmax_init);
+        Int_type* vsum_thread = &vsum_part[0];
+        Int_type* vmin_thread = &vmin_part[0];
+        Int_type* vmax_thread = &vmax_part[0];
+
+        pool.forallChunks(ibegin, iend,
+          [=](Index_type cbegin, Index_type cend, int tid) {
+          Int_type vsum = vsum_thread[tid];
+          Int_type vmin = vmin_thread[tid];
+          Int_type vmax = vmax_thread[tid];
+          for (Index_type i = cbegin; i < cend; ++i ) {
+            REDUCE3_INT_BODY;
+          }
+          vsum_thread[tid] = vsum;
+          vmin_thread[tid] = vmin;
+          vmax_thread[tid] = vmax;
+        });
+
+        Int_type vsum = m_vsum_init;
+        Int_type vmin = m_vmin_init;
+        Int_type vmax = m_vmax_init;
+        for (size_t t = 0; t < vsum_part.size(); ++t) {
+          vsum += vsum_part[t];
+          vmin = RAJA_MIN(vmin, vmin_part[t]);
+          vmax = RAJA_MAX(vmax, vmax_part[t]);
+        }
+
+        m_vsum += vsum;
+        m_vmin = RAJA_MIN(m_vmin, vmin);
+        m_vmax = RAJA_MAX(m_vmax, vmax);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RAJAPERF_ENABLE_STDPAR)
+    case Base_StdPar : {
+
+      REDUCE3_INT_DATA;
+
+      struct Reduce3 {
+        Int_type vsum;
+        Int_type vmin;
+        Int_type vmax;
+      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        const Reduce3 init = { m_vsum_init, m_vmin_init, m_vmax_init };
+
+        Reduce3 vred = std::transform_reduce(std::execution::par_unseq,
+                                             vec + ibegin, vec + iend, init,
+          [=](const Reduce3& r1, const Reduce3& r2) {
+            Reduce3 r = { r1.vsum + r2.vsum,
+                          RAJA_MIN(r1.vmin, r2.vmin),
+                          RAJA_MAX(r1.vmax, r2.vmax) };
+            return r;
+          },
+          [=](Int_type v) {
+            Reduce3 r = { v, v, v };
+            return r;
+          });
+
+        m_vsum += vred.vsum;
+        m_vmin = RAJA_MIN(m_vmin, vred.vmin);
+        m_vmax = RAJA_MAX(m_vmax, vred.vmax);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_OPENMP)
     case Base_OpenMP : {
 
@@ -271,7 +439,7 @@ void REDUCE3_INT::runKernel(VariantID vid)
 
       REDUCE3_INT_DATA;
 
-      int n = getRunSize();
+      Index_type n = getRunSize();
       #pragma omp target enter data map(to:vec[0:n])
 
       startTimer();
@@ -306,7 +474,7 @@ void REDUCE3_INT::runKernel(VariantID vid)
     case RAJA_OpenMPTarget : {
 
       REDUCE3_INT_DATA;
-      int n = getRunSize();
+      Index_type n = getRunSize();
 
       #pragma omp target enter data map(to:vec[0:n])
 
@@ -338,6 +506,78 @@ void REDUCE3_INT::runKernel(VariantID vid)
 #endif //RAJA_ENABLE_TARGET_OPENMP
 #endif //RAJA_ENABLE_OMP                             
 
+#if defined(RAJA_ENABLE_TBB)
+    case Base_TBB : {
+
+      REDUCE3_INT_DATA;
+
+      struct Reduce3 {
+        Int_type vsum;
+        Int_type vmin;
+        Int_type vmax;
+      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        const Reduce3 init = { 0, m_vmin_init, m_vmax_init };
+
+        Reduce3 vred = tbb::parallel_reduce(
+          tbb::blocked_range<Index_type>(ibegin, iend), init,
+          [=](const tbb::blocked_range<Index_type>& r, Reduce3 red) {
+          Int_type vsum = red.vsum;
+          Int_type vmin = red.vmin;
+          Int_type vmax = red.vmax;
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            REDUCE3_INT_BODY;
+          }
+          Reduce3 res = { vsum, vmin, vmax };
+          return res;
+        },
+        [=](const Reduce3& r1, const Reduce3& r2) {
+          Reduce3 r = { r1.vsum + r2.vsum,
+                        RAJA_MIN(r1.vmin, r2.vmin),
+                        RAJA_MAX(r1.vmax, r2.vmax) };
+          return r;
+        });
+
+        m_vsum += m_vsum_init + vred.vsum;
+        m_vmin = RAJA_MIN(m_vmin, vred.vmin);
+        m_vmax = RAJA_MAX(m_vmax, vred.vmax);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_TBB : {
+
+      REDUCE3_INT_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::ReduceSum<RAJA::tbb_reduce, Int_type> vsum(m_vsum_init);
+        RAJA::ReduceMin<RAJA::tbb_reduce, Int_type> vmin(m_vmin_init);
+        RAJA::ReduceMax<RAJA::tbb_reduce, Int_type> vmax(m_vmax_init);
+
+        RAJA::forall<RAJA::tbb_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          REDUCE3_INT_BODY_RAJA;
+        });
+
+        m_vsum += static_cast<Int_type>(vsum.get());
+        m_vmin = RAJA_MIN(m_vmin, static_cast<Int_type>(vmin.get()));
+        m_vmax = RAJA_MAX(m_vmax, static_cast<Int_type>(vmax.get()));
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
     case Base_CUDA : {
 
@@ -423,18 +663,22 @@ void REDUCE3_INT::runKernel(VariantID vid)
 
 }
 
-void REDUCE3_INT::updateChecksum(VariantID vid)
+template <typename REAL, typename INDEX>
+void REDUCE3_INT<REAL, INDEX>::updateChecksum(VariantID vid)
 {
   checksum[vid] += m_vsum;
   checksum[vid] += m_vmin;
   checksum[vid] += m_vmax;
 }
 
-void REDUCE3_INT::tearDown(VariantID vid)
+template <typename REAL, typename INDEX>
+void REDUCE3_INT<REAL, INDEX>::tearDown(VariantID vid)
 {
   (void) vid;
   deallocData(m_vec);
 }
 
+RAJAPERF_INSTANTIATE_KERNEL(REDUCE3_INT);
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -35,11 +35,16 @@
 #include "TRAP_INT.hpp"
 
 #include "common/DataUtils.hpp"
+#include "common/StdPar.hpp"
+#include "common/SimdIntrinsics.hpp"
 
 #include "RAJA/RAJA.hpp"
 #include "RAJA/policy/cuda.hpp"
 
+#include <algorithm>
+#include <functional>
 #include <iostream>
+#include <vector>
 
 namespace rajaperf 
 {
@@ -49,15 +54,16 @@ namespace basic
 //
 // Function used in TRAP_INT loop.
 //
+template <typename T>
 RAJA_INLINE
 RAJA_HOST_DEVICE
-Real_type trap_int_func(Real_type x,
-                        Real_type y,
-                        Real_type xp,
-                        Real_type yp)
+T trap_int_func(T x,
+                T y,
+                T xp,
+                T yp)
 {
-   Real_type denom = (x - xp)*(x - xp) + (y - yp)*(y - yp);
-   denom = 1.0/sqrt(denom);
+   T denom = (x - xp)*(x - xp) + (y - yp)*(y - yp);
+   denom = T(1.0)/sqrt(denom);
    return denom;
 }
 
@@ -73,6 +79,11 @@ Real_type trap_int_func(Real_type x,
   Real_type x = x0 + i*h; \
   sumx += trap_int_func(x, y, xp, yp);
 
+#define TRAP_INT_SIMD_BODY \
+  const Vec vx = vx0 + simdIndex<Vec>(i) * vh; \
+  const Vec vdx = vx - vxp; \
+  vsumx = vsumx + vone / Vec::sqrt(vdx*vdx + vdy2);
+
 
 #if defined(RAJA_ENABLE_CUDA)
 
@@ -126,18 +137,37 @@ __global__ void trapint(Real_type x0, Real_type xp,
 #endif // if defined(RAJA_ENABLE_CUDA)
 
 
-TRAP_INT::TRAP_INT(const RunParams& params)
+template <typename REAL, typename INDEX>
+TRAP_INT<REAL, INDEX>::TRAP_INT(const RunParams& params)
   : KernelBase(rajaperf::Basic_TRAP_INT, params)
 {
    setDefaultSize(100000);
    setDefaultReps(2000);
+
+#if defined(RAJAPERF_ENABLE_STDPAR)
+   setVariantDefined(Base_StdPar);
+#endif
+}
+
+template <typename REAL, typename INDEX>
+TRAP_INT<REAL, INDEX>::~TRAP_INT() 
+{
+}
+
+template <typename REAL, typename INDEX>
+double TRAP_INT<REAL, INDEX>::getBytesPerRep() const
+{
+  return 0.0;
 }
 
-TRAP_INT::~TRAP_INT() 
+template <typename REAL, typename INDEX>
+double TRAP_INT<REAL, INDEX>::getFLOPsPerRep() const
 {
+  return 12.0 * getRunSize();
 }
 
-void TRAP_INT::setUp(VariantID vid)
+template <typename REAL, typename INDEX>
+void TRAP_INT<REAL, INDEX>::setUp(VariantID vid)
 {
   Real_type xn; 
   initData(xn, vid);
@@ -155,9 +185,10 @@ void TRAP_INT::setUp(VariantID vid)
   m_sumx = 0;
 }
 
-void TRAP_INT::runKernel(VariantID vid)
+template <typename REAL, typename INDEX>
+void TRAP_INT<REAL, INDEX>::runKernel(VariantID vid)
 {
-  const Index_type run_reps = getRunReps();
+  const Index_type run_reps = getBatchReps();
   const Index_type ibegin = 0;
   const Index_type iend = getRunSize();
 
@@ -194,7 +225,7 @@ void TRAP_INT::runKernel(VariantID vid)
         RAJA::ReduceSum<RAJA::seq_reduce, Real_type> sumx(m_sumx_init);
 
         RAJA::forall<RAJA::seq_exec>(
-          RAJA::RangeSegment(ibegin, iend), [=](int i) {
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           TRAP_INT_BODY;
         });
 
@@ -206,6 +237,132 @@ void TRAP_INT::runKernel(VariantID vid)
       break;
     }
 
+    case Base_Simd : {
+
+      TRAP_INT_DATA;
+
+#if defined(RAJAPERF_HAVE_SIMD_INTRINSICS)
+      typedef SimdVec<Real_type> Vec;
+      const Vec vone = Vec::set1(1.0);
+      const Vec vx0 = Vec::set1(x0);
+      const Vec vxp = Vec::set1(xp);
+      const Vec vh = Vec::set1(h);
+      const Vec vdy2 = Vec::set1((y - yp)*(y - yp));
+#endif
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type sumx = m_sumx_init;
+
+#if defined(RAJAPERF_HAVE_SIMD_INTRINSICS)
+        Vec vsumx = Vec::zero();
+        forallSimd<Vec>(ibegin, iend,
+          [&](Index_type i) { TRAP_INT_SIMD_BODY; },
+          [&](Index_type i) { TRAP_INT_BODY; });
+        sumx += simdSum(vsumx);
+#else
+        RAJAPERF_SIMD_REDUCE(reduction(+:sumx))
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          TRAP_INT_BODY;
+        }
+#endif
+
+        m_sumx += sumx * h;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Simd : {
+
+      TRAP_INT_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::ReduceSum<RAJA::seq_reduce, Real_type> sumx(m_sumx_init);
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          TRAP_INT_BODY;
+        });
+
+        m_sumx += static_cast<Real_type>(sumx.get()) * h;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_ThreadPool : {
+
+      TRAP_INT_DATA;
+
+      ThreadPool& pool = getThreadPool();
+      std::vector<Real_type> sumx_part(pool.getNumThreads());
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        std::fill(sumx_part.begin(), sumx_part.end(), 0.0);
+        Real_type* sumx_thread = &sumx_part[0];
+
+        pool.forallChunks(ibegin, iend,
+          [=](Index_type cbegin, Index_type cend, int tid) {
+          Real_type sumx = 0.0;
+          for (Index_type i = cbegin; i < cend; ++i ) {
+            TRAP_INT_BODY;
+          }
+          sumx_thread[tid] += sumx;
+        });
+
+        Real_type sumx = m_sumx_init;
+        for (size_t t = 0; t < sumx_part.size(); ++t) {
+          sumx += sumx_part[t];
+        }
+
+        m_sumx += sumx * h;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RAJAPERF_ENABLE_STDPAR)
+    case Base_StdPar : {
+
+      TRAP_INT_DATA;
+
+      typedef IndexIterator<Index_type> Iter;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type sumx = m_sumx_init;
+
+        sumx += std::transform_reduce(std::execution::par_unseq,
+                                      Iter(ibegin), Iter(iend),
+                                      Real_type(0.0), std::plus<Real_type>(),
+                                      [=](Index_type i) {
+          Real_type sumx = 0.0;
+          TRAP_INT_BODY;
+          return sumx;
+        });
+
+        m_sumx += sumx * h;
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_OPENMP)
     case Base_OpenMP : {
 
@@ -312,6 +469,56 @@ void TRAP_INT::runKernel(VariantID vid)
 #endif //RAJA_ENABLE_TARGET_OPENMP
 #endif //RAJA_ENABLE_OMP       
 
+#if defined(RAJA_ENABLE_TBB)
+    case Base_TBB : {
+
+      TRAP_INT_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type sumx = m_sumx_init;
+
+        sumx += tbb::parallel_reduce(
+          tbb::blocked_range<Index_type>(ibegin, iend), Real_type(0.0),
+          [=](const tbb::blocked_range<Index_type>& r, Real_type sumx) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            TRAP_INT_BODY;
+          }
+          return sumx;
+        }, std::plus<Real_type>());
+
+        m_sumx += sumx * h;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_TBB : {
+
+      TRAP_INT_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::ReduceSum<RAJA::tbb_reduce, Real_type> sumx(m_sumx_init);
+
+        RAJA::forall<RAJA::tbb_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          TRAP_INT_BODY;
+        });
+
+        m_sumx += static_cast<Real_type>(sumx.get()) * h;
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
     case Base_CUDA : {
 
@@ -378,15 +585,19 @@ void TRAP_INT::runKernel(VariantID vid)
 
 }
 
-void TRAP_INT::updateChecksum(VariantID vid)
+template <typename REAL, typename INDEX>
+void TRAP_INT<REAL, INDEX>::updateChecksum(VariantID vid)
 {
   checksum[vid] += (m_sumx + 0.00123) / (m_sumx - 0.00123);
 }
 
-void TRAP_INT::tearDown(VariantID vid)
+template <typename REAL, typename INDEX>
+void TRAP_INT<REAL, INDEX>::tearDown(VariantID vid)
 {
   (void) vid;
 }
 
+RAJAPERF_INSTANTIATE_KERNEL(TRAP_INT);
+
 } // end namespace basic
 } // end namespace rajaperf
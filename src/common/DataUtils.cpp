@@ -15,16 +15,600 @@
 
 
 #include "DataUtils.hpp"
+#include "ThreadPool.hpp"
 
 #include "RAJA/internal/MemUtils_CPU.hpp"
 
+#if defined(RAJA_ENABLE_TBB)
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+#endif
+
+#include <cstdio>
 #include <cstdlib>
+#include <fstream>
+#include <map>
+
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
 
 namespace rajaperf
 {
 
 static int data_init_count = 0;
 
+static DataPlacement data_placement = DefaultPlacement;
+static int data_placement_node = 0;
+
+static bool sample_data_pages = false;
+static std::vector<long> data_page_counts;
+
+static DataPageMode data_page_mode = DefaultPages;
+static DataPageStats data_page_stats;
+static bool sample_huge_pages = false;
+
+static const size_t huge_page_size = 2*1024*1024;
+
+//
+// Arrays allocated with mmap, mapped to length of their mapping.
+//
+static std::map<void*, size_t> mapped_data;
+
+//
+// Data pool: blocks handed out while pool is on are kept in 
+// pooled_data_blocks; those not in use are also in free_data_blocks, 
+// keyed by size and whether they were first touched in parallel.
+//
+enum DataBlockKind {
+  RegularBlock = 0,
+  TransparentHugeBlock,
+  ExplicitHugeBlock
+};
+
+struct DataBlock {
+  size_t nbytes;
+  bool parallel_touch;
+  DataBlockKind kind;
+  size_t page_bytes;
+};
+
+typedef std::pair<size_t, bool> DataBlockKey;
+
+static bool use_data_pool = false;
+static std::map<void*, DataBlock> pooled_data_blocks;
+static std::multimap<DataBlockKey, void*> free_data_blocks;
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Array of names for each DataPlacement policy.
+ *
+ * IMPORTANT: IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ENUM OF PLACEMENT POLICIES IN HEADER FILE!!!
+ *
+ *******************************************************************************
+ */
+static const std::string DataPlacementNames [] =
+{
+
+  std::string("default"),
+  std::string("first-touch"),
+  std::string("serial"),
+  std::string("interleave"),
+  std::string("bind"),
+
+  std::string("Unknown Placement")  // Keep this at the end and DO NOT remove....
+
+}; // END DataPlacementNames
+
+
+const std::string& getDataPlacementName(DataPlacement placement)
+{
+  return DataPlacementNames[placement];
+}
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Array of names for each DataPageMode.
+ *
+ * IMPORTANT: IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ENUM OF PAGE MODES IN HEADER FILE!!!
+ *
+ *******************************************************************************
+ */
+static const std::string DataPageModeNames [] =
+{
+
+  std::string("default"),
+  std::string("thp"),
+  std::string("explicit"),
+
+  std::string("Unknown Page Mode")  // Keep this at the end and DO NOT remove....
+
+}; // END DataPageModeNames
+
+
+const std::string& getDataPageModeName(DataPageMode mode)
+{
+  return DataPageModeNames[mode];
+}
+
+#if defined(__linux__)
+/*
+ * Return mask of online NUMA nodes (at most 64 nodes supported).
+ */
+static unsigned long getOnlineNodeMask()
+{
+  unsigned long mask = 0;
+
+  std::ifstream online("/sys/devices/system/node/online");
+  std::string list;
+  if ( !(online >> list) ) {
+    return 1;  // assume single node
+  }
+
+  // List has form "0-1,3,5-7"
+  size_t pos = 0;
+  while ( pos < list.size() ) {
+    size_t end = list.find(',', pos);
+    if ( end == std::string::npos ) end = list.size();
+    std::string range = list.substr(pos, end - pos);
+    size_t dash = range.find('-');
+    int lo = ::atoi( range.substr(0, dash).c_str() );
+    int hi = ( dash == std::string::npos ? 
+               lo : ::atoi( range.substr(dash + 1).c_str() ) );
+    for (int n = lo; n <= hi && n < 64; ++n) {
+      mask |= 1UL << n;
+    }
+    pos = end + 1;
+  }
+
+  return ( mask ? mask : 1 );
+}
+#endif
+
+/*
+ * Set data placement policy.
+ */
+bool setDataPlacement(DataPlacement placement, int node)
+{
+  data_placement = DefaultPlacement;
+  data_placement_node = 0;
+
+  if ( placement == DefaultPlacement ) {
+    return true;
+  }
+
+#if defined(__linux__)
+  if ( ( placement == InterleavePlacement || placement == BindPlacement ) &&
+       ( node < 0 || node >= 64 || 
+         !( getOnlineNodeMask() & (1UL << node) ) ) ) {
+    return false;
+  }
+#else
+  if ( placement == InterleavePlacement || placement == BindPlacement ) {
+    return false;
+  }
+#endif
+
+  //
+  // Large arrays must get fresh pages from the OS so placement happens 
+  // when they are initialized. Setting the mmap threshold explicitly 
+  // disables glibc's dynamic threshold, which otherwise grows when 
+  // arrays are freed so later allocations reuse pages already placed.
+  //
+#if defined(__GLIBC__)
+  mallopt(M_MMAP_THRESHOLD, 128*1024);
+#endif
+
+  data_placement = placement;
+  data_placement_node = node;
+
+  return true;
+}
+
+DataPlacement getDataPlacement()
+{
+  return data_placement;
+}
+
+/*
+ * Return true if given variant runs with TBB.
+ */
+static bool isTBBVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_TBB)
+  return ( vid == Base_TBB || vid == RAJA_TBB );
+#else
+  (void) vid;
+  return false;
+#endif
+}
+
+/*
+ * Return true if data for given variant is first touched in parallel.
+ */
+static bool parallelFirstTouch(VariantID vid)
+{
+  return ( data_placement != SerialPlacement && 
+           ( isOpenMPVariant(vid) || isTBBVariant(vid) ||
+             vid == Base_ThreadPool ) );
+}
+
+/*
+ * First touch data array with the threads that run the given variant 
+ * (if it is touched in parallel) so its pages are placed near them.
+ */
+template <typename T>
+static void firstTouchData(T* ptr, Index_type len, VariantID vid)
+{
+  if ( !parallelFirstTouch(vid) ) {
+    return;
+  }
+
+#if defined(RAJA_ENABLE_OPENMP)
+  if ( isOpenMPVariant(vid) ) {
+    #pragma omp parallel for schedule(static)
+    for (Index_type i = 0; i < len; ++i) {
+      ptr[i] = T();
+    };
+    return;
+  }
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+  if ( isTBBVariant(vid) ) {
+    tbb::parallel_for(tbb::blocked_range<Index_type>(0, len),
+      [=](const tbb::blocked_range<Index_type>& r) {
+      for (Index_type i = r.begin(); i < r.end(); ++i) {
+        ptr[i] = T();
+      }
+    });
+    return;
+  }
+#endif
+
+  getThreadPool().forall(0, len, [=](Index_type i) {
+    ptr[i] = T();
+  });
+}
+
+/*
+ * Apply NUMA memory policy for interleave or bind placement to pages of 
+ * array that has not been touched yet. Only whole pages in the range 
+ * are affected.
+ */
+static void placeData(void* ptr, size_t nbytes)
+{
+#if defined(__linux__)
+  if ( data_placement != InterleavePlacement &&
+       data_placement != BindPlacement ) {
+    return;
+  }
+
+  const unsigned long page_size = sysconf(_SC_PAGESIZE);
+  unsigned long beg = reinterpret_cast<unsigned long>(ptr);
+  unsigned long end = beg + nbytes;
+  beg = (beg + page_size - 1) & ~(page_size - 1);
+  end = end & ~(page_size - 1);
+  if ( end <= beg ) {
+    return;
+  }
+
+  unsigned long nodemask = 0;
+  int mode = MPOL_BIND;
+  if ( data_placement == InterleavePlacement ) {
+    nodemask = getOnlineNodeMask();
+    mode = MPOL_INTERLEAVE;
+  } else {
+    nodemask = 1UL << data_placement_node;
+  }
+
+  // maxnode is # bits in mask plus one (kernel discards last bit)
+  syscall(SYS_mbind, beg, end - beg, mode, &nodemask, 
+          8*sizeof(nodemask) + 1, 0);
+#else
+  (void) ptr;
+  (void) nbytes;
+#endif
+}
+
+/*
+ * Sample NUMA node of pages of initialized array and add to page counts.
+ */
+static void countDataPages(void* ptr, size_t nbytes)
+{
+#if defined(__linux__)
+  if ( !sample_data_pages || nbytes == 0 ) {
+    return;
+  }
+
+  const int max_samples = 64;
+  const unsigned long page_size = sysconf(_SC_PAGESIZE);
+  const unsigned long beg = reinterpret_cast<unsigned long>(ptr);
+  const unsigned long npages = (nbytes + page_size - 1) / page_size;
+  const int nsamples = 
+    static_cast<int>( npages < max_samples ? npages : max_samples );
+
+  void* pages[max_samples];
+  int status[max_samples];
+  for (int is = 0; is < nsamples; ++is) {
+    unsigned long offset = (npages * is / nsamples) * page_size;
+    pages[is] = reinterpret_cast<void*>( (beg + offset) & ~(page_size - 1) );
+    status[is] = -1;
+  }
+
+  // With null node array, move_pages returns node of each page in status
+  if ( syscall(SYS_move_pages, 0, nsamples, pages, 0, status, 0) != 0 ) {
+    return;
+  }
+
+  for (int is = 0; is < nsamples; ++is) {
+    int node = status[is];
+    if ( node >= 0 ) {
+      if ( static_cast<size_t>(node) >= data_page_counts.size() ) {
+        data_page_counts.resize(node + 1, 0);
+      }
+      data_page_counts[node]++;
+    }
+  }
+#else
+  (void) ptr;
+  (void) nbytes;
+#endif
+}
+
+/*
+ * Set page mode for data arrays.
+ */
+bool setDataPageMode(DataPageMode mode)
+{
+#if defined(__linux__)
+  data_page_mode = mode;
+  return true;
+#else
+  data_page_mode = DefaultPages;
+  return ( mode == DefaultPages );
+#endif
+}
+
+DataPageMode getDataPageMode()
+{
+  return data_page_mode;
+}
+
+void setHugePageSampling(bool sample)
+{
+  sample_huge_pages = sample;
+}
+
+void resetDataPageStats()
+{
+  data_page_stats = DataPageStats();
+}
+
+const DataPageStats& getDataPageStats()
+{
+  return data_page_stats;
+}
+
+/*
+ * Allocate nbytes of data array memory according to page mode and
+ * describe it in block. Explicit huge pages fall back to transparent 
+ * huge pages, which fall back to regular aligned allocation, if they 
+ * can't be obtained.
+ */
+static void* newDataBytes(size_t nbytes, DataBlock& block)
+{
+  block.nbytes = nbytes;
+
+#if defined(__linux__)
+  if ( data_page_mode != DefaultPages && nbytes > 0 ) {
+
+    const size_t len = (nbytes + huge_page_size - 1) & ~(huge_page_size - 1);
+
+#if defined(MAP_HUGETLB)
+    if ( data_page_mode == ExplicitHugePages ) {
+      int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+#if defined(MAP_HUGE_2MB)
+      flags |= MAP_HUGE_2MB;
+#endif
+      void* ptr = mmap(0, len, PROT_READ | PROT_WRITE, flags, -1, 0);
+      if ( ptr != MAP_FAILED ) {
+        mapped_data[ptr] = len;
+        block.kind = ExplicitHugeBlock;
+        block.page_bytes = len;
+        return ptr;
+      }
+    }
+#endif
+
+    //
+    // Map an extra huge page so array can start on a huge page boundary. 
+    // Space before array is unmapped; space after it is made inaccessible 
+    // so kernel can't merge array mapping with its neighbors, which would
+    // spoil the huge page counts read from /proc/self/smaps.
+    //
+    char* base = static_cast<char*>( 
+      mmap(0, len + huge_page_size, PROT_READ | PROT_WRITE, 
+           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0) );
+    if ( base != MAP_FAILED ) {
+      const unsigned long ubase = reinterpret_cast<unsigned long>(base);
+      const size_t head = 
+        ( (ubase + huge_page_size - 1) & ~(huge_page_size - 1) ) - ubase;
+      char* ptr = base + head;
+      if ( head > 0 ) {
+        munmap(base, head);
+      }
+      mprotect(ptr + len, huge_page_size - head, PROT_NONE);
+#if defined(MADV_HUGEPAGE)
+      madvise(ptr, len, MADV_HUGEPAGE);
+#endif
+      mapped_data[ptr] = len + huge_page_size - head;
+      block.kind = TransparentHugeBlock;
+      block.page_bytes = len;
+      return ptr;
+    }
+
+  }
+#endif
+
+  block.kind = RegularBlock;
+  block.page_bytes = nbytes;
+  return RAJA::allocate_aligned_type<char>(RAJA::DATA_ALIGN, nbytes);
+}
+
+/*
+ * Return data array memory allocated with newDataBytes to the system.
+ */
+static void deleteDataBytes(void* ptr)
+{
+#if defined(__linux__)
+  std::map<void*, size_t>::iterator it = mapped_data.find(ptr);
+  if ( it != mapped_data.end() ) {
+    munmap(it->first, it->second);
+    mapped_data.erase(it);
+    return;
+  }
+#endif
+  RAJA::free_aligned(ptr);
+}
+
+/*
+ * Allocate nbytes of data array memory for given variant, reusing a 
+ * pooled block of the same size if data pool is on.
+ *
+ * Pooled blocks keep the pages placed when they were first touched, so 
+ * a block is reused only by variants that first touch data the same way;
+ * otherwise, e.g., OpenMP variants would run on pages that a sequential
+ * variant placed on one NUMA node.
+ */
+static void* allocDataBytes(size_t nbytes, VariantID vid)
+{
+  DataBlock block;
+  block.nbytes = nbytes;
+  block.parallel_touch = parallelFirstTouch(vid);
+
+  void* ptr = 0;
+
+  const DataBlockKey key(block.nbytes, block.parallel_touch);
+  std::multimap<DataBlockKey, void*>::iterator it = free_data_blocks.find(key);
+  if ( it != free_data_blocks.end() ) {
+    ptr = it->second;
+    free_data_blocks.erase(it);
+    block = pooled_data_blocks[ptr];
+  } else {
+    ptr = newDataBytes(nbytes, block);
+    if ( use_data_pool ) {
+      pooled_data_blocks[ptr] = block;
+    }
+  }
+
+  data_page_stats.num_arrays++;
+  data_page_stats.bytes += nbytes;
+  if ( block.kind == ExplicitHugeBlock ) {
+    data_page_stats.explicit_bytes += block.page_bytes;
+  } else if ( block.kind == TransparentHugeBlock ) {
+    data_page_stats.thp_bytes += block.page_bytes;
+  } else {
+    data_page_stats.regular_bytes += block.page_bytes;
+  }
+
+  return ptr;
+}
+
+/*
+ * Free data array memory allocated with allocDataBytes, or return it to
+ * data pool if it came from there.
+ */
+static void freeDataBytes(void* ptr)
+{
+  std::map<void*, DataBlock>::iterator it = pooled_data_blocks.find(ptr);
+  if ( it != pooled_data_blocks.end() ) {
+    const DataBlockKey key(it->second.nbytes, it->second.parallel_touch);
+    free_data_blocks.insert( std::make_pair(key, ptr) );
+  } else {
+    deleteDataBytes(ptr);
+  }
+}
+
+void setDataPool(bool use_pool)
+{
+  use_data_pool = use_pool;
+}
+
+/*
+ * Return free blocks in data pool to the system.
+ */
+void releaseDataPool()
+{
+  std::multimap<DataBlockKey, void*>::iterator it = free_data_blocks.begin();
+  for ( ; it != free_data_blocks.end(); ++it) {
+    pooled_data_blocks.erase(it->second);
+    deleteDataBytes(it->second);
+  }
+  free_data_blocks.clear();
+}
+
+/*
+ * Add bytes of transparent huge pages backing initialized array, read
+ * from AnonHugePages entry of its mapping in /proc/self/smaps, if huge
+ * page sampling is on (reading smaps is costly with many mappings).
+ */
+static void countHugePages(void* ptr)
+{
+#if defined(__linux__)
+  if ( !sample_huge_pages || data_page_mode == DefaultPages || 
+       mapped_data.find(ptr) == mapped_data.end() ) {
+    return;
+  }
+
+  const unsigned long addr = reinterpret_cast<unsigned long>(ptr);
+
+  std::ifstream smaps("/proc/self/smaps");
+  std::string line;
+  bool in_mapping = false;
+  while ( std::getline(smaps, line) ) {
+    unsigned long beg = 0;
+    unsigned long end = 0;
+    if ( sscanf(line.c_str(), "%lx-%lx", &beg, &end) == 2 ) {
+      in_mapping = ( addr >= beg && addr < end );
+    } else if ( in_mapping && 
+                line.compare(0, 14, "AnonHugePages:") == 0 ) {
+      data_page_stats.thp_obtained_bytes += 
+        static_cast<size_t>( ::atol(line.c_str() + 14) ) * 1024;
+      return;
+    }
+  }
+#else
+  (void) ptr;
+#endif
+}
+
+void setDataPageSampling(bool sample)
+{
+  sample_data_pages = sample;
+}
+
+void resetDataPageCounts()
+{
+  data_page_counts.assign(data_page_counts.size(), 0);
+}
+
+const std::vector<long>& getDataPageCounts()
+{
+  return data_page_counts;
+}
+
 /*
  * Reset counter for data initialization.
  */
@@ -45,64 +629,99 @@ void incDataInitCount()
 /*
  * Allocate and initialize aligned integer data arrays.
  */
-void allocAndInitData(Int_ptr& ptr, int len, VariantID vid)
+void allocAndInitData(Int_ptr& ptr, Index_type len, VariantID vid)
 {
-  // Should we do this differently for alignment?? If so, change dealloc()
-  ptr = new Int_type[len];
+  ptr = static_cast<Int_ptr>( allocDataBytes(len*sizeof(Int_type), vid) );
+  placeData(ptr, len*sizeof(Int_type));
   initData(ptr, len, vid);
+  countDataPages(ptr, len*sizeof(Int_type));
+  countHugePages(ptr);
 }
 
 /*
- * Allocate and initialize aligned data arrays.
+ * Allocate and initialize aligned real and complex data arrays.
  */
-void allocAndInitData(Real_ptr& ptr, int len, VariantID vid )
+template <typename T>
+static void allocAndInitDataArray(T*& ptr, Index_type len, VariantID vid)
 {
-  ptr = 
-    RAJA::allocate_aligned_type<Real_type>(RAJA::DATA_ALIGN, 
-                                           len*sizeof(Real_type));
+  ptr = static_cast<T*>( allocDataBytes(len*sizeof(T), vid) );
+  placeData(ptr, len*sizeof(T));
   initData(ptr, len, vid);
+  countDataPages(ptr, len*sizeof(T));
+  countHugePages(ptr);
 }
 
-void allocAndInitDataConst(Real_ptr& ptr, int len, Real_type val,
-                           VariantID vid)
+void allocAndInitData(double*& ptr, Index_type len, VariantID vid)
+{
+  allocAndInitDataArray(ptr, len, vid);
+}
+
+void allocAndInitData(float*& ptr, Index_type len, VariantID vid)
+{
+  allocAndInitDataArray(ptr, len, vid);
+}
+
+template <typename T>
+static void allocAndInitRealDataConst(T*& ptr, Index_type len, T val,
+                                      VariantID vid)
 {
   (void) vid;
 
-  ptr = 
-    RAJA::allocate_aligned_type<Real_type>(RAJA::DATA_ALIGN, 
-                                           len*sizeof(Real_type));
+  ptr = static_cast<T*>( allocDataBytes(len*sizeof(T), vid) );
+  placeData(ptr, len*sizeof(T));
 
-// first touch...
-#if defined(RAJA_ENABLE_OPENMP)
-  if ( vid == Base_OpenMP || 
-       vid == RAJA_OpenMP ) {
-    #pragma omp parallel for
-    for (int i = 0; i < len; ++i) { 
-      ptr[i] = 0;
-    };
-  } 
-#endif
+  firstTouchData(ptr, len, vid);
 
-  for (int i = 0; i < len; ++i) { 
+  for (Index_type i = 0; i < len; ++i) { 
     ptr[i] = val;
   };
 
+  countDataPages(ptr, len*sizeof(T));
+  countHugePages(ptr);
+
   incDataInitCount();
 }
 
-void allocAndInitDataRandSign(Real_ptr& ptr, int len, VariantID vid)
+void allocAndInitDataConst(double*& ptr, Index_type len, double val,
+                           VariantID vid)
+{
+  allocAndInitRealDataConst(ptr, len, val, vid);
+}
+
+void allocAndInitDataConst(float*& ptr, Index_type len, float val,
+                           VariantID vid)
 {
-  ptr =
-    RAJA::allocate_aligned_type<Real_type>(RAJA::DATA_ALIGN,
-                                           len*sizeof(Real_type));
+  allocAndInitRealDataConst(ptr, len, val, vid);
+}
+
+template <typename T>
+static void allocAndInitRealDataRandSign(T*& ptr, Index_type len, VariantID vid)
+{
+  ptr = static_cast<T*>( allocDataBytes(len*sizeof(T), vid) );
+  placeData(ptr, len*sizeof(T));
   initDataRandSign(ptr, len, vid);
+  countDataPages(ptr, len*sizeof(T));
+  countHugePages(ptr);
 }
 
-void allocAndInitData(Complex_ptr& ptr, int len, VariantID vid)
+void allocAndInitDataRandSign(double*& ptr, Index_type len, VariantID vid)
 {
-  // Should we do this differently for alignment?? If so, change dealloc()
-  ptr = new Complex_type[len];
-  initData(ptr, len, vid);
+  allocAndInitRealDataRandSign(ptr, len, vid);
+}
+
+void allocAndInitDataRandSign(float*& ptr, Index_type len, VariantID vid)
+{
+  allocAndInitRealDataRandSign(ptr, len, vid);
+}
+
+void allocAndInitData(std::complex<double>*& ptr, Index_type len, VariantID vid)
+{
+  allocAndInitDataArray(ptr, len, vid);
+}
+
+void allocAndInitData(std::complex<float>*& ptr, Index_type len, VariantID vid)
+{
+  allocAndInitDataArray(ptr, len, vid);
 }
 
 
@@ -112,117 +731,115 @@ void allocAndInitData(Complex_ptr& ptr, int len, VariantID vid)
 void deallocData(Int_ptr& ptr)
 { 
   if (ptr) {
-    delete [] ptr;
+    freeDataBytes(ptr);
     ptr = 0;
   }
 }
 
-void deallocData(Real_ptr& ptr)
+template <typename T>
+static void deallocDataArray(T*& ptr)
 { 
   if (ptr) {
-    RAJA::free_aligned(ptr);
+    freeDataBytes(ptr);
     ptr = 0;
   }
 }
 
-void deallocData(Complex_ptr& ptr)
+void deallocData(double*& ptr)
+{ 
+  deallocDataArray(ptr);
+}
+
+void deallocData(float*& ptr)
+{ 
+  deallocDataArray(ptr);
+}
+
+void deallocData(std::complex<double>*& ptr)
 {
-  if (ptr) { 
-    delete [] ptr;
-    ptr = 0;
-  }
+  deallocDataArray(ptr);
+}
+
+void deallocData(std::complex<float>*& ptr)
+{
+  deallocDataArray(ptr);
 }
 
 
 /*
  * \brief Initialize Int_type data array.
  */
-void initData(Int_ptr& ptr, int len, VariantID vid)
+void initData(Int_ptr& ptr, Index_type len, VariantID vid)
 {
   (void) vid;
 
-// First touch...
-#if defined(RAJA_ENABLE_OPENMP)
-  if ( vid == Base_OpenMP ||
-       vid == RAJA_OpenMP ) {
-    #pragma omp parallel for
-    for (int i = 0; i < len; ++i) {
-      ptr[i] = 0;
-    };
-  } 
-#endif
+  firstTouchData(ptr, len, vid);
 
   srand(4793);
 
   Real_type signfact = 0.0;
 
-  for (int i = 0; i < len; ++i) {
+  for (Index_type i = 0; i < len; ++i) {
     signfact = Real_type(rand())/RAND_MAX;
     ptr[i] = ( signfact < 0.5 ? -1 : 1 );
   };
 
   signfact = Real_type(rand())/RAND_MAX; 
-  Int_type ilo = len * signfact;
+  Index_type ilo = len * signfact;
   ptr[ilo] = -58;
 
   signfact = Real_type(rand())/RAND_MAX; 
-  Int_type ihi = len * signfact;
+  Index_type ihi = len * signfact;
   ptr[ihi] = 19;
 
   incDataInitCount();
 }
 
 /*
- * Initialize Real_type data array.
+ * Initialize real data array.
  */
-void initData(Real_ptr& ptr, int len, VariantID vid) 
+template <typename T>
+static void initRealData(T*& ptr, Index_type len, VariantID vid) 
 {
   (void) vid;
 
-  Real_type factor = ( data_init_count % 2 ? 0.1 : 0.2 );
+  T factor = ( data_init_count % 2 ? 0.1 : 0.2 );
 
-// first touch...
-#if defined(RAJA_ENABLE_OPENMP)
-  if ( vid == Base_OpenMP || 
-       vid == RAJA_OpenMP ) {
-    #pragma omp parallel for
-    for (int i = 0; i < len; ++i) { 
-      ptr[i] = factor*(i + 1.1)/(i + 1.12345);
-    };
-  } 
-#endif
+  firstTouchData(ptr, len, vid);
 
-  for (int i = 0; i < len; ++i) {
+  for (Index_type i = 0; i < len; ++i) {
     ptr[i] = factor*(i + 1.1)/(i + 1.12345);
   } 
 
   incDataInitCount();
 }
 
+void initData(double*& ptr, Index_type len, VariantID vid) 
+{
+  initRealData(ptr, len, vid);
+}
+
+void initData(float*& ptr, Index_type len, VariantID vid) 
+{
+  initRealData(ptr, len, vid);
+}
+
 /*
- * Initialize Real_type data array with random sign.
+ * Initialize real data array with random sign.
  */
-void initDataRandSign(Real_ptr& ptr, int len, VariantID vid)
+template <typename T>
+static void initRealDataRandSign(T*& ptr, Index_type len, VariantID vid)
 {
   (void) vid;
 
-// First touch...
-#if defined(RAJA_ENABLE_OPENMP)
-  if ( vid == Base_OpenMP ||
-       vid == RAJA_OpenMP ) {
-    #pragma omp parallel for
-    for (int i = 0; i < len; ++i) {
-      ptr[i] = 0.0;
-    };
-  }
-#endif
+  firstTouchData(ptr, len, vid);
 
-  Real_type factor = ( data_init_count % 2 ? 0.1 : 0.2 );
+  T factor = ( data_init_count % 2 ? 0.1 : 0.2 );
 
   srand(4793);
 
-  for (int i = 0; i < len; ++i) {
-    Real_type signfact = Real_type(rand())/RAND_MAX;
+  for (Index_type i = 0; i < len; ++i) {
+    T signfact = T(rand())/RAND_MAX;
     signfact = ( signfact < 0.5 ? -1.0 : 1.0 );
     ptr[i] = signfact*factor*(i + 1.1)/(i + 1.12345);
   };
@@ -230,56 +847,83 @@ void initDataRandSign(Real_ptr& ptr, int len, VariantID vid)
   incDataInitCount();
 }
 
+void initDataRandSign(double*& ptr, Index_type len, VariantID vid)
+{
+  initRealDataRandSign(ptr, len, vid);
+}
+
+void initDataRandSign(float*& ptr, Index_type len, VariantID vid)
+{
+  initRealDataRandSign(ptr, len, vid);
+}
+
 /*
- * Initialize Complex_type data array.
+ * Initialize complex data array.
  */
-void initData(Complex_ptr& ptr, int len, VariantID vid)
+template <typename T>
+static void initComplexData(std::complex<T>*& ptr, Index_type len, VariantID vid)
 {
   (void) vid;
 
-  Complex_type factor = ( data_init_count % 2 ?  Complex_type(0.1,0.2) :
-                                                 Complex_type(0.2,0.3) );
+  typedef std::complex<T> Complex;
 
-#if defined(RAJA_ENABLE_OPENMP)
-  if ( vid == Base_OpenMP ||
-       vid == RAJA_OpenMP ) {
-    #pragma omp parallel for
-    for (int i = 0; i < len; ++i) { 
-      ptr[i] = factor*(i + 1.1)/(i + 1.12345);
-    };
-  }
-#endif
+  Complex factor = ( data_init_count % 2 ?  Complex(0.1,0.2) :
+                                            Complex(0.2,0.3) );
 
-  for (int i = 0; i < len; ++i) {
-    ptr[i] = factor*(i + 1.1)/(i + 1.12345);
+  firstTouchData(ptr, len, vid);
+
+  for (Index_type i = 0; i < len; ++i) {
+    ptr[i] = factor*T(i + 1.1)/T(i + 1.12345);
   }
 
   incDataInitCount();
 }
 
+void initData(std::complex<double>*& ptr, Index_type len, VariantID vid)
+{
+  initComplexData(ptr, len, vid);
+}
+
+void initData(std::complex<float>*& ptr, Index_type len, VariantID vid)
+{
+  initComplexData(ptr, len, vid);
+}
+
 /*
  * Initialize scalar data.
  */
-void initData(Real_type& d, VariantID vid)
+template <typename T>
+static void initRealScalar(T& d, VariantID vid)
 {
   (void) vid;
 
-  Real_type factor = ( data_init_count % 2 ? 0.1 : 0.2 );
+  T factor = ( data_init_count % 2 ? 0.1 : 0.2 );
   d = factor*1.1/1.12345;
 
   incDataInitCount();
 }
 
+void initData(double& d, VariantID vid)
+{
+  initRealScalar(d, vid);
+}
+
+void initData(float& d, VariantID vid)
+{
+  initRealScalar(d, vid);
+}
+
 
 /*
  * Calculate and return checksum for data arrays.
  */
-long double calcChecksum(const Real_ptr ptr, int len, 
-                         Real_type scale_factor)
+template <typename T>
+static long double calcRealChecksum(const T* ptr, Index_type len, 
+                                    T scale_factor)
 {
   long double tchk = 0.0;
   for (Index_type j = 0; j < len; ++j) {
-    tchk += (j+1)*ptr[j]*scale_factor;
+    tchk += (j+1)*static_cast<double>(ptr[j])*scale_factor;
 #if 0 // RDH DEBUG
     if ( (j % 100) == 0 ) {
       std::cout << "j : tchk = " << j << " : " << tchk << std::endl;
@@ -289,12 +933,26 @@ long double calcChecksum(const Real_ptr ptr, int len,
   return tchk;
 }
 
-long double calcChecksum(const Complex_ptr ptr, int len,
-                         Real_type scale_factor)
+long double calcChecksum(double* ptr, Index_type len, 
+                         double scale_factor)
+{
+  return calcRealChecksum(ptr, len, scale_factor);
+}
+
+long double calcChecksum(float* ptr, Index_type len, 
+                         float scale_factor)
+{
+  return calcRealChecksum(ptr, len, scale_factor);
+}
+
+template <typename T>
+static long double calcComplexChecksum(const std::complex<T>* ptr, Index_type len,
+                                       T scale_factor)
 {
   long double tchk = 0.0;
   for (Index_type j = 0; j < len; ++j) {
-    tchk += (j+1)*(real(ptr[j])+imag(ptr[j]))*scale_factor;
+    tchk += (j+1)*(static_cast<double>(real(ptr[j])) + 
+                   static_cast<double>(imag(ptr[j])))*scale_factor;
 #if 0 // RDH DEBUG
     if ( (j % 100) == 0 ) {
       std::cout << "j : tchk = " << j << " : " << tchk << std::endl;
@@ -304,6 +962,18 @@ long double calcChecksum(const Complex_ptr ptr, int len,
   return tchk;
 }
 
+long double calcChecksum(std::complex<double>* ptr, Index_type len,
+                         double scale_factor)
+{
+  return calcComplexChecksum(ptr, len, scale_factor);
+}
+
+long double calcChecksum(std::complex<float>* ptr, Index_type len,
+                         float scale_factor)
+{
+  return calcComplexChecksum(ptr, len, scale_factor);
+}
+
 
 
 }  // closing brace for rajaperf namespace
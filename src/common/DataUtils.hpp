@@ -26,9 +26,157 @@
 
 #include "RAJA/policy/cuda/raja_cudaerrchk.hpp"
 
+#include <complex>
+#include <string>
+#include <vector>
+
 namespace rajaperf
 {
 
+/*!
+ * \brief Enumeration of policies for placing pages of data arrays on 
+ *        NUMA nodes when they are allocated.
+ *
+ * IMPORTANT: IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ARRAY OF PLACEMENT NAMES IN IMPLEMENTATION FILE!!! 
+ */
+enum DataPlacement {
+  DefaultPlacement = 0,  /*!< parallel first touch for OpenMP and thread 
+                              pool variants; allocator may reuse pages
+                              touched earlier */
+  FirstTouchPlacement,   /*!< fresh pages; parallel first touch, with same
+                              schedule as kernels, for OpenMP and thread 
+                              pool variants */
+  SerialPlacement,       /*!< fresh pages; serial first touch for all 
+                              variants */
+  InterleavePlacement,   /*!< fresh pages interleaved over all NUMA nodes */
+  BindPlacement,         /*!< fresh pages bound to one NUMA node */
+
+  NumDataPlacements // Keep this one last and NEVER comment out (!!)
+};
+
+/*!
+ * \brief Return name of data placement policy.
+ */
+const std::string& getDataPlacementName(DataPlacement placement);
+
+/*!
+ * \brief Set data placement policy (node is used by BindPlacement only).
+ *
+ * Returns false, and default placement is used, if policy is not 
+ * supported on this system.
+ */
+bool setDataPlacement(DataPlacement placement, int node = 0);
+
+/*!
+ * \brief Return current data placement policy.
+ */
+DataPlacement getDataPlacement();
+
+/*!
+ * \brief Enumeration of modes for backing data arrays with pages.
+ *
+ * IMPORTANT: IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ARRAY OF PAGE MODE NAMES IN IMPLEMENTATION FILE!!! 
+ */
+enum DataPageMode {
+  DefaultPages = 0,      /*!< regular aligned allocation */
+  TransparentHugePages,  /*!< 2MB aligned mmap advised to use transparent 
+                              huge pages */
+  ExplicitHugePages,     /*!< 2MB pages from hugetlbfs pool; falls back to 
+                              transparent huge pages if pool is exhausted */
+
+  NumDataPageModes // Keep this one last and NEVER comment out (!!)
+};
+
+/*!
+ * \brief Bytes of data arrays allocated, by kind of pages backing them.
+ *
+ * Huge page byte counts are whole huge pages. 
+ */
+struct DataPageStats {
+  DataPageStats() 
+    : num_arrays(0), bytes(0), explicit_bytes(0), thp_bytes(0),
+      thp_obtained_bytes(0), regular_bytes(0) { }
+
+  long num_arrays;
+  size_t bytes;               /*!< bytes requested */
+  size_t explicit_bytes;      /*!< bytes backed by explicit huge pages */
+  size_t thp_bytes;           /*!< bytes advised to use transparent huge pages */
+  size_t thp_obtained_bytes;  /*!< bytes backed by transparent huge pages 
+                                   after initialization */
+  size_t regular_bytes;       /*!< bytes from regular allocation */
+};
+
+/*!
+ * \brief Return name of data page mode.
+ */
+const std::string& getDataPageModeName(DataPageMode mode);
+
+/*!
+ * \brief Set page mode for data arrays allocated by allocAndInitData* 
+ *        routines.
+ *
+ * Returns false, and default mode is used, if mode is not supported on 
+ * this system (huge pages are Linux only).
+ */
+bool setDataPageMode(DataPageMode mode);
+
+/*!
+ * \brief Return current data page mode.
+ */
+DataPageMode getDataPageMode();
+
+/*!
+ * \brief Turn on/off sampling of transparent huge pages obtained for
+ *        arrays allocated by allocAndInitData* routines (Linux only); 
+ *        when off, DataPageStats::thp_obtained_bytes stays zero.
+ */
+void setHugePageSampling(bool sample);
+
+/*!
+ * \brief Reset data page statistics.
+ */
+void resetDataPageStats();
+
+/*!
+ * \brief Return data page statistics for arrays allocated since last reset.
+ */
+const DataPageStats& getDataPageStats();
+
+/*!
+ * \brief Turn on/off data pool.
+ *
+ * When on, arrays freed by deallocData are kept and handed out again by
+ * allocAndInitData* routines for arrays of the same size (their contents
+ * are reset by the init routines), instead of being returned to the system
+ * and allocated again for each kernel variant execution.
+ */
+void setDataPool(bool use_pool);
+
+/*!
+ * \brief Return arrays in data pool that are not in use to the system.
+ */
+void releaseDataPool();
+
+/*!
+ * \brief Turn on/off sampling of NUMA node of pages of arrays allocated 
+ *        by allocAndInitData* routines (Linux only).
+ */
+void setDataPageSampling(bool sample);
+
+/*!
+ * \brief Reset sampled page counts.
+ */
+void resetDataPageCounts();
+
+/*!
+ * \brief Return # sampled pages on each NUMA node since last reset,
+ *        indexed by node number.
+ */
+const std::vector<long>& getDataPageCounts();
+
+  
   
 /*!
  * Reset counter for data initialization.
@@ -44,31 +192,46 @@ void incDataInitCount();
 /*!
  * \brief Allocate and initialize Int_type data array.
  */
-void allocAndInitData(Int_ptr& ptr, int len,
+void allocAndInitData(Int_ptr& ptr, Index_type len,
                       VariantID vid = NumVariants);
 
 /*!
- * \brief Allocate and initialize aligned Real_type data array.
+ * \brief Allocate and initialize aligned real data array.
+ *
+ * Routines for real and complex data are overloaded for float and double,
+ * so they serve kernels instantiated with either precision.
  */
-void allocAndInitData(Real_ptr& ptr, int len,
+void allocAndInitData(double*& ptr, Index_type len,
+                      VariantID vid = NumVariants);
+///
+void allocAndInitData(float*& ptr, Index_type len,
                       VariantID vid = NumVariants);
 
 /*!
- * \brief Allocate and initialize aligned Real_type data array.
+ * \brief Allocate and initialize aligned real data array to a constant.
  */
-void allocAndInitDataConst(Real_ptr& ptr, int len, Real_type val,
+void allocAndInitDataConst(double*& ptr, Index_type len, double val,
+                           VariantID vid = NumVariants);
+///
+void allocAndInitDataConst(float*& ptr, Index_type len, float val,
                            VariantID vid = NumVariants);
 
 /*!
- * \brief Allocate and initialize aligned Real_type data array with random sign.
+ * \brief Allocate and initialize aligned real data array with random sign.
  */
-void allocAndInitDataRandSign(Real_ptr& ptr, int len,
+void allocAndInitDataRandSign(double*& ptr, Index_type len,
+                              VariantID vid = NumVariants);
+///
+void allocAndInitDataRandSign(float*& ptr, Index_type len,
                               VariantID vid = NumVariants);
 
 /*!
- * \brief Allocate and initialize aligned Complex_type data array.
+ * \brief Allocate and initialize aligned complex data array.
  */
-void allocAndInitData(Complex_ptr& ptr, int len,
+void allocAndInitData(std::complex<double>*& ptr, Index_type len,
+                      VariantID vid = NumVariants);
+///
+void allocAndInitData(std::complex<float>*& ptr, Index_type len,
                       VariantID vid = NumVariants);
 
 
@@ -77,46 +240,62 @@ void allocAndInitData(Complex_ptr& ptr, int len,
  */
 void deallocData(Int_ptr& ptr);
 ///
-void deallocData(Real_ptr& ptr);
+void deallocData(double*& ptr);
+///
+void deallocData(float*& ptr);
 ///
-void deallocData(Complex_ptr& ptr);
+void deallocData(std::complex<double>*& ptr);
+///
+void deallocData(std::complex<float>*& ptr);
 
 
 /*!
  * \brief Initialize Int_type data array.
  */
-void initData(Int_ptr& ptr, int len,
+void initData(Int_ptr& ptr, Index_type len,
               VariantID vid = NumVariants);
 
 /*!
- * \brief Initialize Real_type data array.
+ * \brief Initialize real data array.
  */
-void initData(Real_ptr& ptr, int len,
+void initData(double*& ptr, Index_type len,
+              VariantID vid = NumVariants);
+///
+void initData(float*& ptr, Index_type len,
               VariantID vid = NumVariants);
 
 /*!
- * \brief Initialize Real_type data array with random sign.
+ * \brief Initialize real data array with random sign.
  */
-void initDataRandSign(Real_ptr& ptr, int len,
+void initDataRandSign(double*& ptr, Index_type len,
+                      VariantID vid = NumVariants);
+///
+void initDataRandSign(float*& ptr, Index_type len,
                       VariantID vid = NumVariants);
 
 /*!
- * \brief Initialize Complex_type data array.
+ * \brief Initialize complex data array.
  */
-void initData(Complex_ptr& ptr, int len,
+void initData(std::complex<double>*& ptr, Index_type len,
+              VariantID vid = NumVariants);
+///
+void initData(std::complex<float>*& ptr, Index_type len,
               VariantID vid = NumVariants);
 
 /*!
- * \brief Initialize Real_type scalar data.
+ * \brief Initialize real scalar data.
  */
-void initData(Real_type& d,
+void initData(double& d,
+              VariantID vid = NumVariants);
+///
+void initData(float& d,
               VariantID vid = NumVariants);
 
 
 #if defined(RAJA_ENABLE_CUDA)
 
 template <typename T>
-void initCudaDeviceData(T& dptr, const T hptr, int len)
+void initCudaDeviceData(T& dptr, const T hptr, Index_type len)
 {
   cudaErrchk( cudaMemcpy( dptr, hptr, 
                           len * sizeof(typename std::remove_pointer<T>::type),
@@ -126,7 +305,7 @@ void initCudaDeviceData(T& dptr, const T hptr, int len)
 }
 
 template <typename T>
-void allocAndInitCudaDeviceData(T& dptr, const T hptr, int len)
+void allocAndInitCudaDeviceData(T& dptr, const T hptr, Index_type len)
 {
   cudaErrchk( cudaMalloc( (void**)&dptr,
               len * sizeof(typename std::remove_pointer<T>::type) ) );
@@ -135,7 +314,7 @@ void allocAndInitCudaDeviceData(T& dptr, const T hptr, int len)
 }
 
 template <typename T>
-void getCudaDeviceData(T& hptr, const T dptr, int len)
+void getCudaDeviceData(T& hptr, const T dptr, Index_type len)
 {
   cudaErrchk( cudaMemcpy( hptr, dptr, 
               len * sizeof(typename std::remove_pointer<T>::type),
@@ -154,12 +333,21 @@ void deallocCudaDeviceData(T& dptr)
 
 /*!
  * \brief Calculate and return checksum for data arrays.
+ *
+ * Float data is summed in double precision, so checksums of float and 
+ * double kernel instances differ only by differences in their data.
  */
-long double calcChecksum(Real_ptr d, int len, 
-                         Real_type scale_factor = 1.0);
+long double calcChecksum(double* d, Index_type len, 
+                         double scale_factor = 1.0);
+///
+long double calcChecksum(float* d, Index_type len, 
+                         float scale_factor = 1.0);
+///
+long double calcChecksum(std::complex<double>* d, Index_type len, 
+                         double scale_factor = 1.0);
 ///
-long double calcChecksum(Complex_ptr d, int len, 
-                         Real_type scale_factor = 1.0);
+long double calcChecksum(std::complex<float>* d, Index_type len, 
+                         float scale_factor = 1.0);
 
 
 }  // closing brace for rajaperf namespace
@@ -18,6 +18,7 @@
 
 #include "common/KernelBase.hpp"
 #include "common/OutputUtils.hpp"
+#include "common/ThreadPool.hpp"
 
 #include <list>
 #include <vector>
@@ -28,17 +29,369 @@
 #include <sstream>
 #include <fstream>
 #include <cmath>
+#include <algorithm>
+#include <limits>
+#include <thread>
 
 #include <unistd.h>
 
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
 
 namespace rajaperf {
 
 using namespace std;
 
+//
+// Number of threads in pool used by Base_ThreadPool variants; default is
+// one per hardware thread.
+//
+static int getPoolThreadCount(const RunParams& params)
+{
+  int nthreads = params.getPoolThreads();
+  if ( nthreads <= 0 ) {
+    nthreads = static_cast<int>( thread::hardware_concurrency() );
+  }
+  return ( nthreads > 0 ? nthreads : 1 );
+}
+
+//
+// True if loops and data arrays of kernel can be indexed with 32-bit 
+// indices; array length is estimated from the kernel bytes model.
+//
+static bool fitsIndex32(const KernelBase* kern)
+{
+  const double max_index = numeric_limits<Index32_type>::max();
+  return ( kern->getRunSize() <= max_index &&
+           kern->getItsPerRep() <= max_index &&
+           kern->getBytesPerRep() / sizeof(Real_type) <= max_index );
+}
+
+//
+// Untiled counterpart of tiled variant; NumVariants if variant is not tiled.
+//
+static VariantID getUntiledVariant(VariantID vid)
+{
+  switch ( vid ) {
+    case Base_Seq_Tiled : return Base_Seq;
+    case RAJA_Seq_Tiled : return RAJA_Seq;
+#if defined(RAJA_ENABLE_OPENMP)
+    case Base_OpenMP_Tiled : return Base_OpenMP;
+    case RAJA_OpenMP_Tiled : return RAJA_OpenMP;
+#endif
+    default : return NumVariants;
+  }
+}
+
+//
+// Tile sizes (i x j x k) that a variant runs with and where they come 
+// from: Base tiled variants take them from run parameters ('--tile-sizes'),
+// RAJA tiled variants from tile policies fixed at compile time 
+// (RAJAPERF_RAJA_TILE_SIZE). Sizes are "none" if variant is not tiled.
+//
+static void getVariantTileSizes(VariantID vid, const RunParams& params,
+                                string& sizes, string& source)
+{
+  ostringstream str;
+  switch ( vid ) {
+    case Base_Seq_Tiled :
+#if defined(RAJA_ENABLE_OPENMP)
+    case Base_OpenMP_Tiled :
+#endif
+      str << params.getTileSize(0) << "x" << params.getTileSize(1) << "x"
+          << params.getTileSize(2);
+      source = "--tile-sizes";
+      break;
+    case RAJA_Seq_Tiled :
+#if defined(RAJA_ENABLE_OPENMP)
+    case RAJA_OpenMP_Tiled :
+#endif
+      str << RAJAPERF_RAJA_TILE_SIZE << "x" << RAJAPERF_RAJA_TILE_SIZE << "x"
+          << RAJAPERF_RAJA_TILE_SIZE;
+      source = "RAJAPERF_RAJA_TILE_SIZE";
+      break;
+    default :
+      str << "none";
+      source = "n/a";
+  }
+  sizes = str.str();
+}
+
+//
+// Unfused counterpart of fused variant; NumVariants if variant is not fused.
+//
+static VariantID getUnfusedVariant(VariantID vid)
+{
+  switch ( vid ) {
+    case Base_Seq_Fused : return Base_Seq;
+    case RAJA_Seq_Fused : return RAJA_Seq;
+#if defined(RAJA_ENABLE_OPENMP)
+    case Base_OpenMP_Fused : return Base_OpenMP;
+    case RAJA_OpenMP_Fused : return RAJA_OpenMP;
+#endif
+    default : return NumVariants;
+  }
+}
+
+//
+// Counterpart of persistent parallel region variant that starts a parallel 
+// region for each loop; NumVariants if variant is not a region variant.
+//
+static VariantID getUnregionedVariant(VariantID vid)
+{
+  switch ( vid ) {
+#if defined(RAJA_ENABLE_OPENMP)
+    case Base_OpenMP_Region : return Base_OpenMP;
+    case RAJA_OpenMP_Region : return RAJA_OpenMP;
+#endif
+    default : return NumVariants;
+  }
+}
+
+//
+// Counterpart of software prefetch variant without prefetches; 
+// NumVariants if variant does not prefetch.
+//
+static VariantID getNoPrefetchVariant(VariantID vid)
+{
+  switch ( vid ) {
+    case Base_Seq_Prefetch : return Base_Seq;
+    case RAJA_Seq_Prefetch : return RAJA_Seq;
+#if defined(RAJA_ENABLE_OPENMP)
+    case Base_OpenMP_Prefetch : return Base_OpenMP;
+    case RAJA_OpenMP_Prefetch : return RAJA_OpenMP;
+#endif
+    default : return NumVariants;
+  }
+}
+
+//
+// Counterpart of register-blocked variant that computes one output at a 
+// time; NumVariants if variant is not blocked.
+//
+static VariantID getUnblockedVariant(VariantID vid)
+{
+  switch ( vid ) {
+    case Base_Seq_Blocked : return Base_Seq;
+    case RAJA_Seq_Blocked : return RAJA_Seq;
+#if defined(RAJA_ENABLE_OPENMP)
+    case Base_OpenMP_Blocked : return Base_OpenMP;
+    case RAJA_OpenMP_Blocked : return RAJA_OpenMP;
+#endif
+    default : return NumVariants;
+  }
+}
+
+//
+// Counterpart of streaming store variant that uses regular stores; 
+// NumVariants if variant does not use streaming stores.
+//
+static VariantID getRegularStoreVariant(VariantID vid)
+{
+  switch ( vid ) {
+    case Base_Seq_NTStore : return Base_Seq;
+    case RAJA_Seq_NTStore : return RAJA_Seq;
+#if defined(RAJA_ENABLE_OPENMP)
+    case Base_OpenMP_NTStore : return Base_OpenMP;
+    case RAJA_OpenMP_NTStore : return RAJA_OpenMP;
+#endif
+    default : return NumVariants;
+  }
+}
+
+//
+// Layout of the variant comparison report tables: kernel and variant 
+// columns sized to fit the names run, followed by the columns each 
+// report adds. Data cells are right-aligned, key cells (e.g., a sweep 
+// parameter) left-aligned.
+//
+class ReportTable
+{
+public:
+  ReportTable(const vector<KernelBase*>& kernels,
+              const vector<VariantID>& variant_ids)
+    : sepchr(" , "),
+      not_avail("n/a"),
+      prec(4),
+      datacol_width(prec + 12),
+      kernel_col_name("Kernel  "),
+      variant_col_name("Variant  ")
+  {
+    kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size()); 
+    }
+    kercol_width++;
+
+    varcol_width = variant_col_name.size();
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size()); 
+    }
+    varcol_width++;
+  }
+
+  //
+  // Add column; width of zero means data column width.
+  //
+  void addColumn(const string& name, size_t width = 0)
+  {
+    col_names.push_back(name);
+    col_widths.push_back( width > 0 ? width : datacol_width );
+  }
+
+  //
+  // Print title line and column title line.
+  //
+  void writeHeader(ostream& file, const string& title) const
+  {
+    file << title;
+    for (size_t ic = 0; ic < col_names.size() + 1; ++ic) {
+      file << sepchr;
+    }
+    file << endl;
+
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name;
+    for (size_t ic = 0; ic < col_names.size(); ++ic) {
+      file << sepchr <<left<< setw(col_widths[ic]) << col_names[ic];
+    }
+    file << endl;
+  }
+
+  void writeRowStart(ostream& file, 
+                     const string& kernel_name, VariantID vid) const
+  {
+    file <<left<< setw(kercol_width) << kernel_name
+         << sepchr <<left<< setw(varcol_width) << getVariantName(vid);
+  }
+
+  ostream& cell(ostream& file) const
+  {
+    return file << sepchr <<right<< setw(datacol_width);
+  }
+
+  ostream& keyCell(ostream& file, size_t ic) const
+  {
+    return file << sepchr <<left<< setw(col_widths[ic]);
+  }
+
+  void notAvail(ostream& file) const
+  {
+    cell(file) << not_avail;
+  }
+
+  const string sepchr;
+  const string not_avail;
+  const size_t prec;
+  const size_t datacol_width;
+
+private:
+  const string kernel_col_name;
+  const string variant_col_name;
+  size_t kercol_width;
+  size_t varcol_width;
+  vector<string> col_names;
+  vector<size_t> col_widths;
+};
+
+#if defined(RAJA_ENABLE_OPENMP)
+//
+// Measure mean cost (sec) of an empty OpenMP parallel region (fork/join) 
+// and of an OpenMP barrier with the current number of threads, in the 
+// manner of the EPCC OpenMP microbenchmarks. Best of 3 trials.
+//
+static void measureOpenMPOverheads(double& forkjoin_time, double& barrier_time)
+{
+  const int nreps = 10000;
+
+  //
+  // Start thread team so startup is not timed.
+  //
+  #pragma omp parallel
+  { }
+
+  RAJA::Timer timer;
+  forkjoin_time = numeric_limits<double>::max();
+  barrier_time = numeric_limits<double>::max();
+  for (int itrial = 0; itrial < 3; ++itrial) {
+
+    timer.reset();
+    timer.start();
+    for (int ir = 0; ir < nreps; ++ir) {
+      #pragma omp parallel
+      { }
+    }
+    timer.stop();
+    forkjoin_time = min(forkjoin_time, 
+                        static_cast<double>(timer.elapsed()) / nreps);
+
+    timer.reset();
+    timer.start();
+    #pragma omp parallel
+    {
+      for (int ir = 0; ir < nreps; ++ir) {
+        #pragma omp barrier
+      }
+    }
+    timer.stop();
+    barrier_time = min(barrier_time, 
+                       static_cast<double>(timer.elapsed()) / nreps);
+  }
+}
+#endif
+
+//
+// Estimate peak GFLOP/s of one thread by timing multiply-adds on a small 
+// array of independent values, which the compiler keeps in registers and 
+// vectorizes. Like the kernels compared against it, the estimate depends 
+// on compiler flags (e.g., whether FMA instructions are used).
+//
+static double estimatePeakGFLOPs()
+{
+  const int nvals = 64;
+  const long nreps = 1L << 20;
+
+  Real_type vals[nvals];
+  for (int iv = 0; iv < nvals; ++iv) {
+    vals[iv] = 1.0 + iv * 1.0e-3;
+  }
+  const Real_type a = 0.999999;
+  const Real_type b = 1.0e-7;
+
+  RAJA::Timer timer;
+  double min_time = numeric_limits<double>::max();
+  for (int itrial = 0; itrial < 3; ++itrial) {
+    timer.reset();
+    timer.start();
+    for (long ir = 0; ir < nreps; ++ir) {
+      RAJAPERF_SIMD
+      for (int iv = 0; iv < nvals; ++iv) {
+        vals[iv] = vals[iv] * a + b;
+      }
+    }
+    timer.stop();
+    min_time = min(min_time, static_cast<double>(timer.elapsed()));
+  }
+
+  //
+  // Use results so loop is not optimized away.
+  //
+  volatile Real_type sum = 0.0;
+  for (int iv = 0; iv < nvals; ++iv) {
+    sum = sum + vals[iv];
+  }
+
+  return ( min_time > 0.0 ? 2.0 * nvals * nreps / min_time / 1.0e9 : 0.0 );
+}
+
 Executor::Executor(int argc, char** argv)
   : run_params(argc, argv),
-    reference_vid(NumVariants)
+    reference_vid(NumVariants),
+    compare_pid( getDefaultPrecision() == DoublePrecision ? FloatPrecision 
+                                                          : DoublePrecision ),
+    compare_iwid( getDefaultIndexWidth() == Index32 ? Index64 : Index32 )
 {
   cout << "\n\nReading command line input..." << endl;
 }
@@ -261,6 +614,50 @@ void Executor::setupSuite()
         run_params.setInputState(RunParams::PerfRun);
       }
 
+      //
+      // Data placement policy applies to all data allocated while suite
+      // runs.
+      //
+      if ( run_params.getInputState() != RunParams::DryRun ) {
+        if ( !setDataPlacement(run_params.getDataPlacement(),
+                               run_params.getDataPlacementNode()) ) {
+          cout << "\nWARNING: data placement '" 
+               << getDataPlacementName(run_params.getDataPlacement())
+               << "' not supported; using default placement" << endl;
+        }
+        setDataPageSampling( run_params.reportDataPlacement() );
+        setHugePageSampling( run_params.reportDataPages() );
+        if ( !setDataPageMode(run_params.getDataPageMode()) ) {
+          cout << "\nWARNING: huge page mode '" 
+               << getDataPageModeName(run_params.getDataPageMode())
+               << "' not supported; using default pages" << endl;
+        }
+        setDataPool( run_params.useDataPool() );
+      }
+
+      //
+      // Counters must be opened before any kernel runs so that they
+      // cover threads created for parallel variants.
+      //
+      if ( run_params.useHWCounters() &&
+           run_params.getInputState() != RunParams::DryRun ) {
+        if ( hw_counters.open(run_params.getCounterFPEvent()) ) {
+          for (size_t ik = 0; ik < kernels.size(); ++ik) {
+            kernels[ik]->setHWCounters(&hw_counters);
+          }
+        }
+      }
+
+      //
+      // Pool threads persist for the whole run, so they are created once
+      // here, after counters are opened so that they cover pool threads.
+      //
+      if ( run_params.getInputState() != RunParams::DryRun &&
+           find(variant_ids.begin(), variant_ids.end(), Base_ThreadPool) !=
+             variant_ids.end() ) {
+        getThreadPool().start( getPoolThreadCount(run_params) );
+      }
+
     } // kernel and variant input both look good
 
   } // if kernel input looks good
@@ -318,6 +715,82 @@ void Executor::reportRunSummary(ostream& str) const
     str << "\t # passes = " << run_params.getNumPasses() << endl;
     str << "\t Kernel size factor = " << run_params.getSizeFactor() << endl;
     str << "\t Kernel rep factor = " << run_params.getRepFactor() << endl;
+    if ( run_params.getTargetTime() > 0.0 ) {
+      str << "\t Target time per kernel variant = " 
+          << run_params.getTargetTime() << " sec. (reps calibrated "
+          << "when run, to " << run_params.getTargetRelErr() 
+          << " relative error)" << endl;
+    }
+    const vector<int>& thread_counts = run_params.getThreadCounts();
+    if ( !thread_counts.empty() ) {
+      str << "\t OpenMP variant thread counts =";
+      for (size_t it = 0; it < thread_counts.size(); ++it) {
+        str << " " << thread_counts[it];
+      }
+      str << endl;
+    }
+    const vector<OpenMPSchedule>& omp_scheds = run_params.getOpenMPSchedules();
+    if ( !omp_scheds.empty() ) {
+      str << "\t OpenMP schedules =";
+      for (size_t is = 0; is < omp_scheds.size(); ++is) {
+        str << " " << getOpenMPScheduleName(omp_scheds[is]);
+      }
+      str << endl;
+    }
+    const vector<int>& prefetch_dists = run_params.getPrefetchDistances();
+    if ( !prefetch_dists.empty() ) {
+      str << "\t Prefetch distances =";
+      for (size_t id = 0; id < prefetch_dists.size(); ++id) {
+        str << " " << prefetch_dists[id];
+      }
+      str << endl;
+    }
+    const vector<int>& fir_lens = run_params.getFIRCoeffLens();
+    if ( !fir_lens.empty() ) {
+      str << "\t FIR coefficient lengths =";
+      for (size_t il = 0; il < fir_lens.size(); ++il) {
+        str << " " << fir_lens[il];
+      }
+      str << endl;
+    }
+    if ( find(variant_ids.begin(), variant_ids.end(), Base_ThreadPool) !=
+         variant_ids.end() ) {
+      str << "\t Thread pool threads = " 
+          << getPoolThreadCount(run_params) << endl;
+    }
+    if ( run_params.reportDataPlacement() ) {
+      str << "\t Data placement = " 
+          << getDataPlacementName(run_params.getDataPlacement());
+      if ( run_params.getDataPlacement() == BindPlacement ) {
+        str << " (node " << run_params.getDataPlacementNode() << ")";
+      }
+      str << endl;
+    }
+    if ( run_params.reportDataPages() ) {
+      str << "\t Huge pages = " 
+          << getDataPageModeName(run_params.getDataPageMode()) << endl;
+    }
+    if ( run_params.useDataPool() ) {
+      str << "\t Data arrays reused from data pool" << endl;
+    }
+    if ( run_params.comparePrecision() ) {
+      str << "\t Precision comparison = " 
+          << getPrecisionName(getDefaultPrecision()) << " vs. " 
+          << getPrecisionName(compare_pid);
+      if ( !isPrecisionAvailable(compare_pid) ) {
+        str << " (not available in this build)";
+      }
+      str << endl;
+    }
+    if ( run_params.compareIndexWidth() ) {
+      str << "\t Index width comparison = " 
+          << getIndexWidthName(getDefaultIndexWidth()) << " vs. " 
+          << getIndexWidthName(compare_iwid);
+      if ( !isIndexWidthAvailable(compare_iwid) ) {
+        str << " (not available in this build)";
+      }
+      str << endl;
+    }
     str << "\t Output files will be named " << ofiles << endl;
 
     str << "\nThe following kernels and variants will be run:\n"; 
@@ -352,6 +825,33 @@ void Executor::runSuite()
 
   cout << "\n\nRunning specified kernels and variants...\n";
 
+  data_page_counts.assign( kernels.size(), 
+    vector< vector<long> >( variant_ids.size(), vector<long>() ) );
+  data_page_stats.assign( kernels.size(), 
+    vector<DataPageStats>( variant_ids.size() ) );
+
+  const vector<int>& thread_counts = run_params.getThreadCounts();
+  thread_sweep_time.assign( kernels.size(), 
+    vector< vector<double> >( variant_ids.size(), 
+                              vector<double>(thread_counts.size(), 0.0) ) );
+
+  const vector<OpenMPSchedule>& omp_scheds = run_params.getOpenMPSchedules();
+  sched_sweep_time.assign( kernels.size(), 
+    vector< vector<double> >( variant_ids.size(), 
+                              vector<double>(omp_scheds.size(), 0.0) ) );
+
+  const vector<int>& prefetch_dists = run_params.getPrefetchDistances();
+  prefetch_sweep_time.assign( kernels.size(), 
+    vector< vector<double> >( variant_ids.size(), 
+                              vector<double>(prefetch_dists.size(), 0.0) ) );
+
+  const vector<int>& fir_lens = run_params.getFIRCoeffLens();
+  fir_sweep_time.assign( kernels.size(), 
+    vector< vector<double> >( variant_ids.size(), 
+                              vector<double>(fir_lens.size(), 0.0) ) );
+  fir_sweep_flops.assign( kernels.size(), 
+                          vector<double>(fir_lens.size(), 0.0) );
+
   const int npasses = run_params.getNumPasses();
   for (int ip = 0; ip < npasses; ++ip) {
     if ( run_params.showProgress() ) {
@@ -369,111 +869,515 @@ void Executor::runSuite()
          if ( run_params.showProgress() ) {
            cout << kern->getName() << " " <<  getVariantName(variant_ids[iv]) << endl;
          }  
+         resetDataPageCounts();
+         resetDataPageStats();
+
          kernels[ik]->execute( variant_ids[iv] );
+
+         data_page_stats[ik][iv] = getDataPageStats();
+
+         if ( run_params.reportDataPlacement() ) {
+           const vector<long>& counts = getDataPageCounts();
+           vector<long>& tot_counts = data_page_counts[ik][iv];
+           tot_counts.resize( max(tot_counts.size(), counts.size()), 0 );
+           for (size_t in = 0; in < counts.size(); ++in) {
+             tot_counts[in] += counts[in];
+           }
+         }
+
+         if ( !thread_counts.empty() && isOpenMPVariant(variant_ids[iv]) ) {
+           runThreadSweep(ik, iv);
+         }
+
+#if defined(RAJA_ENABLE_OPENMP)
+         if ( !omp_scheds.empty() && variant_ids[iv] == Base_OpenMP_Sched ) {
+           runScheduleSweep(ik, iv);
+         }
+#endif
+
+         if ( !prefetch_dists.empty() && 
+              getNoPrefetchVariant(variant_ids[iv]) != NumVariants ) {
+           runPrefetchSweep(ik, iv);
+         }
+
+         if ( !fir_lens.empty() && kern->getKernelID() == Apps_FIR ) {
+           runFIRSweep(ik, iv);
+         }
       } // loop over variants 
 
     } // loop over kernels
 
   } // loop over passes through suite
 
-}
+  releaseDataPool();
 
-void Executor::outputRunData()
-{
-  RunParams::InputOpt in_state = run_params.getInputState();
-  if ( in_state != RunParams::PerfRun && 
-       in_state != RunParams::CheckRun ) {
-    return;
+  if ( !run_params.getSizeSweepFactors().empty() ) {
+    runSizeSweep();
   }
 
-  cout << "\n\nGenerate run report files...\n";
+  if ( run_params.comparePrecision() ) {
+    runPrecisionCompare();
+  }
 
-  //
-  // Generate output file prefix (including directory path). 
-  //
-  string out_fprefix;
-  string outdir = recursiveMkdir(run_params.getOutputDirName()); 
-  if ( !outdir.empty() ) {
-    out_fprefix = outdir + "/" + run_params.getOutputFilePrefix();
-    chdir(outdir.c_str());
-  } else {
-    out_fprefix = "./" + run_params.getOutputFilePrefix();
+  if ( run_params.compareIndexWidth() ) {
+    runIndexWidthCompare();
   }
 
-  string filename = out_fprefix + "-timing.csv";
-  writeCSVReport(filename, CSVRepMode::Timing, 6 /* prec */);
+}
 
-  if ( haveReferenceVariant() ) { 
-    filename = out_fprefix + "-speedup.csv";
-    writeCSVReport(filename, CSVRepMode::Speedup, 3 /* prec */);
-  }
+void Executor::runThreadSweep(size_t ik, size_t iv)
+{
+#if defined(RAJA_ENABLE_OPENMP)
+  const vector<int>& thread_counts = run_params.getThreadCounts();
+  const int max_threads = omp_get_max_threads();
 
-  filename = out_fprefix + "-checksum.txt";
-  writeChecksumReport(filename);
+  for (size_t it = 0; it < thread_counts.size(); ++it) {
+    if ( run_params.showProgress() ) {
+      cout << "   " << thread_counts[it] << " threads" << endl;
+    }
+    omp_set_num_threads(thread_counts[it]);
+    thread_sweep_time[ik][iv][it] += 
+      kernels[ik]->executeSweep( variant_ids[iv] );
+  }
 
-  filename = out_fprefix + "-fom.csv";
-  writeFOMReport(filename);
+  omp_set_num_threads(max_threads);
+#else
+  (void) ik;
+  (void) iv;
+#endif
 }
 
-
-void Executor::writeCSVReport(const string& filename, CSVRepMode mode,
-                              size_t prec)
+void Executor::runScheduleSweep(size_t ik, size_t iv)
 {
-  ofstream file(filename.c_str(), ios::out | ios::trunc);
-  if ( !file ) {
-    cout << " ERROR: Can't open output file " << filename << endl;
+#if defined(RAJA_ENABLE_OPENMP)
+  const vector<OpenMPSchedule>& omp_scheds = run_params.getOpenMPSchedules();
+
+  for (size_t is = 0; is < omp_scheds.size(); ++is) {
+    if ( run_params.showProgress() ) {
+      cout << "   schedule " << getOpenMPScheduleName(omp_scheds[is]) << endl;
+    }
+    kernels[ik]->setOpenMPSchedule(omp_scheds[is]);
+    sched_sweep_time[ik][iv][is] += 
+      kernels[ik]->executeSweep( variant_ids[iv] );
   }
 
-  if ( file ) {
+  kernels[ik]->setOpenMPSchedule(omp_scheds[0]);
+#else
+  (void) ik;
+  (void) iv;
+#endif
+}
 
-    //
-    // Set basic table formatting parameters.
-    //
-    const string kernel_col_name("Kernel  ");
-    const string sepchr(" , ");
+void Executor::runPrefetchSweep(size_t ik, size_t iv)
+{
+  const vector<int>& prefetch_dists = run_params.getPrefetchDistances();
 
-    size_t kercol_width = kernel_col_name.size();
-    for (size_t ik = 0; ik < kernels.size(); ++ik) {
-      kercol_width = max(kercol_width, kernels[ik]->getName().size()); 
+  for (size_t id = 0; id < prefetch_dists.size(); ++id) {
+    if ( run_params.showProgress() ) {
+      cout << "   prefetch distance " << prefetch_dists[id] << endl;
     }
-    kercol_width++;
-
-    vector<size_t> varcol_width(variant_ids.size());
-    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-      varcol_width[iv] = max(prec+2, getVariantName(variant_ids[iv]).size()); 
-    } 
+    kernels[ik]->setPrefetchDistance(prefetch_dists[id]);
+    prefetch_sweep_time[ik][iv][id] += 
+      kernels[ik]->executeSweep( variant_ids[iv] );
+  }
 
-    //
-    // Print title line.
-    //
-    file << getReportTitle(mode);
+  kernels[ik]->setPrefetchDistance( run_params.getPrefetchDistance() );
+}
 
-    //
-    // Wrtie CSV file contents for report.
-    // 
+void Executor::runFIRSweep(size_t ik, size_t iv)
+{
+  const vector<int>& fir_lens = run_params.getFIRCoeffLens();
 
-    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-      file << sepchr;
+  for (size_t il = 0; il < fir_lens.size(); ++il) {
+    if ( run_params.showProgress() ) {
+      cout << "   FIR coefficient length " << fir_lens[il] << endl;
     }
-    file << endl;
 
     //
-    // Print column title line.
+    // Coefficient length sets FIR iteration count, so kernel object for
+    // each length is created with its own copy of run params.
     //
-    file <<left<< setw(kercol_width) << kernel_col_name;
-    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-      file << sepchr <<left<< setw(varcol_width[iv])
-           << getVariantName(variant_ids[iv]);
-    }
-    file << endl;
+    RunParams len_params(run_params);
+    len_params.setFIRCoeffLen(fir_lens[il]);
 
-    //
-    // Print row of data for variants of each kernel.
-    //
-    for (size_t ik = 0; ik < kernels.size(); ++ik) {
-      KernelBase* kern = kernels[ik];
-      file <<left<< setw(kercol_width) << kern->getName();
-      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+    KernelBase* kern = getKernelObject(kernels[ik]->getKernelID(), 
+                                       len_params);
+
+    fir_sweep_time[ik][iv][il] += kern->executeSweep( variant_ids[iv] );
+    fir_sweep_flops[ik][il] = kern->getFLOPsPerRep();
+
+    delete kern;
+  }
+}
+
+void Executor::runSizeSweep()
+{
+  cout << "\n\nRunning kernel size sweep...\n";
+
+  const vector<double>& size_facts = run_params.getSizeSweepFactors();
+  const int npasses = run_params.getNumPasses();
+
+  size_sweep.assign( kernels.size(), vector<SizeSweepPoint>() );
+
+  for (size_t ik = 0; ik < kernels.size(); ++ik) {
+    const KernelID kid = kernels[ik]->getKernelID();
+    const double base_its = kernels[ik]->getItsPerRep();
+
+    for (size_t ip = 0; ip < size_facts.size(); ++ip) {
+
+      //
+      // Kernel object for each sweep point is created with its own copy 
+      // of run params, which sets run size and reps for the point.
+      //
+      RunParams point_params(run_params);
+      point_params.setSizeFactor(size_facts[ip]);
+
+      KernelBase* kern = getKernelObject(kid, point_params);
+
+      SizeSweepPoint point;
+      point.size_fact = size_facts[ip];
+      point.its_per_rep = kern->getItsPerRep();
+      point.bytes_per_rep = kern->getBytesPerRep();
+      point.time.assign(variant_ids.size(), 0.0);
+
+      if ( point.its_per_rep > 0 && kern->getDefaultReps() > 0 ) {
+
+        //
+        // Scale reps so work at each point is about the same as at the 
+        // suite run size, but run at least one rep.
+        //
+        double rep_fact = 
+          run_params.getRepFactor() * base_its / point.its_per_rep;
+        rep_fact = max( rep_fact, 1.5 / kern->getDefaultReps() );
+        point_params.setRepFactor(rep_fact);
+
+        if ( run_params.showProgress() ) {
+          cout << "\n   Running kernel -- " << kern->getName() 
+               << " at size factor " << point.size_fact 
+               << " (" << point.its_per_rep << " , " 
+               << kern->getRunReps() << ")" << endl;
+        }
+
+        for (int ipass = 0; ipass < npasses; ++ipass) {
+          for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+            kern->execute( variant_ids[iv] );
+          }
+        }
+
+        const double run_reps = kern->getRunReps();
+        for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+          VariantID vid = variant_ids[iv];
+          if ( kern->wasVariantRun(vid) && run_reps > 0 ) {
+            point.time[iv] = kern->getTotTime(vid) / npasses / run_reps;
+          }
+        }
+
+      }
+
+      size_sweep[ik].push_back(point);
+
+      delete kern;
+
+      //
+      // Arrays for this size won't be used again.
+      //
+      releaseDataPool();
+
+    }  // loop over size factors
+
+  }  // loop over kernels
+}
+
+void Executor::runPrecisionCompare()
+{
+  if ( !isPrecisionAvailable(compare_pid) ) {
+    cout << "\n\nWARNING: kernels not built in " 
+         << getPrecisionName(compare_pid) 
+         << " precision, skipping precision comparison...\n";
+    return;
+  }
+
+  cout << "\n\nRunning kernels in " << getPrecisionName(compare_pid) 
+       << " precision...\n";
+
+  const int npasses = run_params.getNumPasses();
+
+  prec_time.assign( kernels.size(), 
+                    vector<double>(variant_ids.size(), 0.0) );
+  prec_checksum.assign( kernels.size(), 
+                        vector<Checksum_type>(variant_ids.size(), 0.0) );
+
+  for (size_t ik = 0; ik < kernels.size(); ++ik) {
+    const KernelID kid = kernels[ik]->getKernelID();
+
+    KernelBase* kern = getKernelObject(kid, run_params, compare_pid);
+
+    if ( run_params.showProgress() ) {
+      cout << "\n   Running kernel -- " << kern->getName() 
+           << " in " << getPrecisionName(compare_pid) << endl;
+    }
+
+    for (int ipass = 0; ipass < npasses; ++ipass) {
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        kern->execute( variant_ids[iv] );
+      }
+    }
+
+    const double run_reps = kern->getRunReps();
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      VariantID vid = variant_ids[iv];
+      if ( kern->wasVariantRun(vid) && run_reps > 0 ) {
+        prec_time[ik][iv] = kern->getTotTime(vid) / npasses / run_reps;
+        prec_checksum[ik][iv] = kern->getChecksum(vid);
+      }
+    }
+
+    delete kern;
+
+    //
+    // Arrays of this element type won't be used again.
+    //
+    releaseDataPool();
+
+  }  // loop over kernels
+}
+
+void Executor::runIndexWidthCompare()
+{
+  if ( !isIndexWidthAvailable(compare_iwid) ) {
+    cout << "\n\nWARNING: kernels not built with " 
+         << getIndexWidthName(compare_iwid) 
+         << " indices, skipping index width comparison...\n";
+    return;
+  }
+
+  cout << "\n\nRunning kernels with " << getIndexWidthName(compare_iwid) 
+       << " indices...\n";
+
+  const int npasses = run_params.getNumPasses();
+
+  index_time.assign( kernels.size(), 
+                     vector<double>(variant_ids.size(), 0.0) );
+  index_checksum.assign( kernels.size(), 
+                         vector<Checksum_type>(variant_ids.size(), 0.0) );
+
+  for (size_t ik = 0; ik < kernels.size(); ++ik) {
+    const KernelID kid = kernels[ik]->getKernelID();
+
+    if ( compare_iwid == Index32 && !fitsIndex32(kernels[ik]) ) {
+      cout << "\n   Skipping kernel -- " << kernels[ik]->getName() 
+           << " (too large for " << getIndexWidthName(compare_iwid) 
+           << " indices)" << endl;
+      continue;
+    }
+
+    KernelBase* kern = getKernelObject(kid, run_params, compare_iwid);
+
+    if ( run_params.showProgress() ) {
+      cout << "\n   Running kernel -- " << kern->getName() 
+           << " with " << getIndexWidthName(compare_iwid) << " indices" 
+           << endl;
+    }
+
+    for (int ipass = 0; ipass < npasses; ++ipass) {
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        kern->execute( variant_ids[iv] );
+      }
+    }
+
+    const double run_reps = kern->getRunReps();
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      VariantID vid = variant_ids[iv];
+      if ( kern->wasVariantRun(vid) && run_reps > 0 ) {
+        index_time[ik][iv] = kern->getTotTime(vid) / npasses / run_reps;
+        index_checksum[ik][iv] = kern->getChecksum(vid);
+      }
+    }
+
+    delete kern;
+
+  }  // loop over kernels
+
+  releaseDataPool();
+}
+
+void Executor::outputRunData()
+{
+  RunParams::InputOpt in_state = run_params.getInputState();
+  if ( in_state != RunParams::PerfRun && 
+       in_state != RunParams::CheckRun ) {
+    return;
+  }
+
+  cout << "\n\nGenerate run report files...\n";
+
+  //
+  // Generate output file prefix (including directory path). 
+  //
+  string out_fprefix;
+  string outdir = recursiveMkdir(run_params.getOutputDirName()); 
+  if ( !outdir.empty() ) {
+    out_fprefix = outdir + "/" + run_params.getOutputFilePrefix();
+    chdir(outdir.c_str());
+  } else {
+    out_fprefix = "./" + run_params.getOutputFilePrefix();
+  }
+
+  string filename = out_fprefix + "-timing.csv";
+  writeCSVReport(filename, CSVRepMode::Timing, 6 /* prec */);
+
+  if ( haveReferenceVariant() ) { 
+    filename = out_fprefix + "-speedup.csv";
+    writeCSVReport(filename, CSVRepMode::Speedup, 3 /* prec */);
+  }
+
+  filename = out_fprefix + "-timing-stats.csv";
+  writeTimingStatsReport(filename);
+
+  filename = out_fprefix + "-checksum.txt";
+  writeChecksumReport(filename);
+
+  filename = out_fprefix + "-fom.csv";
+  writeFOMReport(filename);
+
+  filename = out_fprefix + "-roofline.csv";
+  writeRooflineReport(filename);
+
+  if ( haveTiledVariantRun() ) {
+    filename = out_fprefix + "-tiling.csv";
+    writeTilingReport(filename);
+  }
+
+  if ( haveFusedVariantRun() ) {
+    filename = out_fprefix + "-fusion.csv";
+    writeFusionReport(filename);
+  }
+
+  if ( haveRegionVariantRun() ) {
+    filename = out_fprefix + "-omp-region.csv";
+    writeRegionReport(filename);
+  }
+
+  if ( haveNTStoreVariantRun() ) {
+    filename = out_fprefix + "-ntstore.csv";
+    writeNTStoreReport(filename);
+  }
+
+  if ( run_params.getWarmupReps() > 0 ) {
+    filename = out_fprefix + "-warmup.csv";
+    writeWarmupReport(filename);
+  }
+
+  if ( run_params.reportDataPlacement() ) {
+    filename = out_fprefix + "-data-placement.csv";
+    writeDataPlacementReport(filename);
+  }
+
+  if ( run_params.reportDataPages() ) {
+    filename = out_fprefix + "-huge-pages.csv";
+    writeHugePageReport(filename);
+  }
+
+  if ( !run_params.getThreadCounts().empty() ) {
+    filename = out_fprefix + "-thread-scaling.csv";
+    writeThreadScalingReport(filename);
+  }
+
+  if ( !run_params.getOpenMPSchedules().empty() ) {
+    filename = out_fprefix + "-omp-schedules.csv";
+    writeScheduleReport(filename);
+  }
+
+  if ( !run_params.getPrefetchDistances().empty() ) {
+    filename = out_fprefix + "-prefetch.csv";
+    writePrefetchReport(filename);
+  }
+
+  if ( !run_params.getFIRCoeffLens().empty() ) {
+    filename = out_fprefix + "-fir-coefflen.csv";
+    writeFIRCoeffLenReport(filename);
+  }
+
+  if ( !size_sweep.empty() ) {
+    filename = out_fprefix + "-size-sweep.csv";
+    writeSizeSweepReport(filename);
+  }
+
+  if ( !prec_time.empty() ) {
+    filename = out_fprefix + "-precision.csv";
+    writePrecisionReport(filename);
+  }
+
+  if ( !index_time.empty() ) {
+    filename = out_fprefix + "-index-width.csv";
+    writeIndexWidthReport(filename);
+  }
+
+  if ( hw_counters.isOpen() ) {
+    filename = out_fprefix + "-counters.csv";
+    writeCountersReport(filename);
+  }
+}
+
+
+void Executor::writeCSVReport(const string& filename, CSVRepMode mode,
+                              size_t prec)
+{
+  ofstream file(filename.c_str(), ios::out | ios::trunc);
+  if ( !file ) {
+    cout << " ERROR: Can't open output file " << filename << endl;
+  }
+
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string sepchr(" , ");
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size()); 
+    }
+    kercol_width++;
+
+    vector<size_t> varcol_width(variant_ids.size());
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      varcol_width[iv] = max(prec+2, getVariantName(variant_ids[iv]).size()); 
+    } 
+
+    //
+    // Print title line.
+    //
+    file << getReportTitle(mode);
+
+    //
+    // Wrtie CSV file contents for report.
+    // 
+
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      file << sepchr;
+    }
+    file << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name;
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      file << sepchr <<left<< setw(varcol_width[iv])
+           << getVariantName(variant_ids[iv]);
+    }
+    file << endl;
+
+    //
+    // Print row of data for variants of each kernel.
+    //
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+      file <<left<< setw(kercol_width) << kern->getName();
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
         VariantID vid = variant_ids[iv];
         file << sepchr <<right<< setw(varcol_width[iv]) << setprecision(prec) 
              << std::fixed << getReportDataEntry(mode, kern, vid);
@@ -808,6 +1712,2053 @@ void Executor::writeChecksumReport(const string& filename)
 }
 
 
+void Executor::writeCountersReport(const string& filename)
+{
+  ofstream file(filename.c_str(), ios::out | ios::trunc);
+  if ( !file ) {
+    cout << " ERROR: Can't open output file " << filename << endl;
+  }
+
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string sepchr(" , ");
+    const string not_avail("n/a");
+    size_t prec = 4;
+
+    //
+    // Assume 64 byte cache lines to estimate memory traffic from 
+    // last level cache misses.
+    //
+    const double cache_line_bytes = 64.0;
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size()); 
+    }
+    kercol_width++;
+
+    size_t varcol_width = variant_col_name.size();
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size()); 
+    }
+    varcol_width++;
+
+    size_t datacol_width = prec + 12;
+
+    //
+    // Print title line.
+    //
+    file << "Hardware Counters Report (mean counts per pass; "
+         << "LLC miss GB/s assumes " << cache_line_bytes 
+         << " byte cache lines)";
+    for (size_t ie = 0; ie < HWCounters::NumEvents + 4; ++ie) {
+      file << sepchr;
+    }
+    file << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name;
+    for (int ie = 0; ie < HWCounters::NumEvents; ++ie) {
+      file << sepchr <<left<< setw(datacol_width) 
+           << HWCounters::getEventName(static_cast<HWCounters::EventID>(ie));
+    }
+    file << sepchr <<left<< setw(datacol_width) << "IPC"
+         << sepchr <<left<< setw(datacol_width) << "LLC Miss GB/s"
+         << sepchr <<left<< setw(datacol_width) << "FP GOps/s";
+    file << endl;
+
+    //
+    // Print row of counter data for each kernel variant run.
+    //
+    const double npasses = run_params.getNumPasses();
+
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+
+        if ( kern->wasVariantRun(vid) ) {
+
+          file <<left<< setw(kercol_width) << kern->getName()
+               << sepchr <<left<< setw(varcol_width) << getVariantName(vid);
+
+          double count[HWCounters::NumEvents];
+          for (int ie = 0; ie < HWCounters::NumEvents; ++ie) {
+            HWCounters::EventID eid = static_cast<HWCounters::EventID>(ie);
+            count[ie] = kern->getCounterTotal(vid, eid) / npasses;
+            if ( hw_counters.isEventAvailable(eid) ) {
+              file << sepchr <<right<< setw(datacol_width) 
+                   << setprecision(prec) << std::scientific << count[ie];
+            } else {
+              file << sepchr <<right<< setw(datacol_width) << not_avail;
+            }
+          }
+
+          double time = kern->getTotTime(vid) / npasses;
+
+          if ( hw_counters.isEventAvailable(HWCounters::Cycles) &&
+               hw_counters.isEventAvailable(HWCounters::Instructions) &&
+               count[HWCounters::Cycles] > 0.0 ) {
+            file << sepchr <<right<< setw(datacol_width) 
+                 << setprecision(prec) << std::fixed
+                 << count[HWCounters::Instructions] / 
+                    count[HWCounters::Cycles];
+          } else {
+            file << sepchr <<right<< setw(datacol_width) << not_avail;
+          }
+
+          if ( hw_counters.isEventAvailable(HWCounters::LLCMisses) &&
+               time > 0.0 ) {
+            file << sepchr <<right<< setw(datacol_width) 
+                 << setprecision(prec) << std::fixed
+                 << count[HWCounters::LLCMisses] * cache_line_bytes / 
+                    time / 1.0e9;
+          } else {
+            file << sepchr <<right<< setw(datacol_width) << not_avail;
+          }
+
+          if ( hw_counters.isEventAvailable(HWCounters::FPOps) &&
+               time > 0.0 ) {
+            file << sepchr <<right<< setw(datacol_width) 
+                 << setprecision(prec) << std::fixed
+                 << count[HWCounters::FPOps] / time / 1.0e9;
+          } else {
+            file << sepchr <<right<< setw(datacol_width) << not_avail;
+          }
+
+          file << endl;
+
+        }
+
+      }  // loop over variants
+
+    }  // loop over kernels
+
+    file.flush(); 
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+void Executor::writeRooflineReport(const string& filename)
+{
+  ofstream file(filename.c_str(), ios::out | ios::trunc);
+  if ( !file ) {
+    cout << " ERROR: Can't open output file " << filename << endl;
+  }
+
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string sepchr(" , ");
+    const string not_avail("n/a");
+    size_t prec = 4;
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size()); 
+    }
+    kercol_width++;
+
+    size_t varcol_width = variant_col_name.size();
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size()); 
+    }
+    varcol_width++;
+
+    size_t datacol_width = prec + 12;
+
+    const string col_names[] = { "Bytes/Rep", "FLOPs/Rep", "Time/Rep (sec)",
+                                 "GB/s", "GFLOP/s", "FLOPs/Byte" };
+    const size_t ncols = sizeof(col_names) / sizeof(col_names[0]); 
+
+    //
+    // Print title line.
+    //
+    file << "Roofline Report (analytic bytes and FLOPs per rep, "
+         << "mean time per rep)";
+    for (size_t ic = 0; ic < ncols + 1; ++ic) {
+      file << sepchr;
+    }
+    file << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name;
+    for (size_t ic = 0; ic < ncols; ++ic) {
+      file << sepchr <<left<< setw(datacol_width) << col_names[ic];
+    }
+    file << endl;
+
+    //
+    // Print row of roofline data for each kernel variant run.
+    // Kernels without a bytes/FLOPs model get "n/a" entries.
+    //
+    const double npasses = run_params.getNumPasses();
+
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      const double flops = kern->getFLOPsPerRep();
+
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+
+        if ( kern->wasVariantRun(vid) ) {
+
+          const double bytes = ( getUnfusedVariant(vid) != NumVariants ?
+                                 kern->getFusedBytesPerRep() :
+                                 kern->getBytesPerRep() );
+          const bool have_model = ( bytes > 0.0 || flops > 0.0 );
+
+          file <<left<< setw(kercol_width) << kern->getName()
+               << sepchr <<left<< setw(varcol_width) << getVariantName(vid);
+
+          const double nreps = kern->getRunReps();
+          const double time = 
+            ( nreps > 0.0 ? kern->getTotTime(vid) / npasses / nreps : 0.0 );
+
+          if ( have_model ) {
+            file << sepchr <<right<< setw(datacol_width) 
+                 << setprecision(prec) << std::scientific << bytes
+                 << sepchr <<right<< setw(datacol_width) 
+                 << setprecision(prec) << std::scientific << flops;
+          } else {
+            file << sepchr <<right<< setw(datacol_width) << not_avail
+                 << sepchr <<right<< setw(datacol_width) << not_avail;
+          }
+
+          file << sepchr <<right<< setw(datacol_width) 
+               << setprecision(prec) << std::scientific << time;
+
+          if ( have_model && time > 0.0 ) {
+            file << sepchr <<right<< setw(datacol_width) 
+                 << setprecision(prec) << std::fixed 
+                 << bytes / time / 1.0e9
+                 << sepchr <<right<< setw(datacol_width) 
+                 << setprecision(prec) << std::fixed 
+                 << flops / time / 1.0e9;
+          } else {
+            file << sepchr <<right<< setw(datacol_width) << not_avail
+                 << sepchr <<right<< setw(datacol_width) << not_avail;
+          }
+
+          if ( have_model && bytes > 0.0 ) {
+            file << sepchr <<right<< setw(datacol_width) 
+                 << setprecision(prec) << std::fixed << flops / bytes;
+          } else if ( have_model ) {
+            file << sepchr <<right<< setw(datacol_width) << "inf";
+          } else {
+            file << sepchr <<right<< setw(datacol_width) << not_avail;
+          }
+
+          file << endl;
+
+        }
+
+      }  // loop over variants
+
+    }  // loop over kernels
+
+    file.flush(); 
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+//
+// Rows comparing each variant of kernel that was run and has a counterpart
+// (given by counterpart function) with that counterpart: counterpart row,
+// if it was run, followed by variant row.
+//
+void Executor::getVariantPairRows(KernelBase* kern,
+                                  VariantID (*counterpart)(VariantID),
+                                  vector<VariantPairRow>& rows) const
+{
+  rows.clear();
+
+  const double npasses = run_params.getNumPasses();
+  const double nreps = kern->getRunReps();
+
+  for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+    VariantID vid = variant_ids[iv];
+    VariantID base_vid = counterpart(vid);
+
+    if ( base_vid == NumVariants || !kern->wasVariantRun(vid) ) {
+      continue;
+    }
+
+    const bool base_run = kern->wasVariantRun(base_vid);
+    const double base_time = 
+      ( nreps > 0.0 && base_run ? 
+        kern->getTotTime(base_vid) / npasses / nreps : 0.0 );
+    const double time = 
+      ( nreps > 0.0 ? kern->getTotTime(vid) / npasses / nreps : 0.0 );
+
+    VariantPairRow row;
+    row.base_time = base_time;
+    if ( base_run ) {
+      row.vid = base_vid;
+      row.is_base = true;
+      row.time = base_time;
+      rows.push_back(row);
+    }
+    row.vid = vid;
+    row.is_base = false;
+    row.time = time;
+    rows.push_back(row);
+  }
+}
+
+
+bool Executor::haveTiledVariantRun() const
+{
+  for (size_t ik = 0; ik < kernels.size(); ++ik) {
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      if ( getUntiledVariant(variant_ids[iv]) != NumVariants &&
+           kernels[ik]->wasVariantRun(variant_ids[iv]) ) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+
+void Executor::writeTilingReport(const string& filename)
+{
+  ofstream file(filename.c_str(), ios::out | ios::trunc);
+  if ( !file ) {
+    cout << " ERROR: Can't open output file " << filename << endl;
+  }
+
+  if ( file ) {
+
+    //
+    // Peak of one thread, given or estimated; OpenMP variants are 
+    // compared with peak times the number of threads they ran with.
+    //
+    const bool peak_given = ( run_params.getPeakGFLOPs() > 0.0 );
+    const double thread_peak = 
+      ( peak_given ? run_params.getPeakGFLOPs() : estimatePeakGFLOPs() );
+
+    int max_threads = 1;
+#if defined(RAJA_ENABLE_OPENMP)
+    max_threads = omp_get_max_threads();
+#endif
+
+    ReportTable table(kernels, variant_ids);
+    const size_t prec = table.prec;
+
+    table.addColumn("Tile Sizes");
+    table.addColumn("Tile Sizes From", 
+                    string("RAJAPERF_RAJA_TILE_SIZE").size() + 1);
+    table.addColumn("Threads");
+    table.addColumn("Time/Rep (sec)");
+    table.addColumn("GFLOP/s");
+    table.addColumn("Peak GFLOP/s");
+    table.addColumn("% of Peak");
+    table.addColumn("Tiling Speedup");
+
+    ostringstream title;
+    title << "Tiling Report (analytic FLOPs per rep, mean time per rep; peak "
+          << ( peak_given ? "given" : "estimated" ) << " as " 
+          << setprecision(prec) << std::fixed << thread_peak 
+          << " GFLOP/s per thread; tiling speedup relative to untiled variant)";
+    table.writeHeader(file, title.str());
+
+    //
+    // Print row for each tiled variant run and its untiled counterpart,
+    // for each kernel that ran a tiled variant.
+    //
+    vector<VariantPairRow> rows;
+
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      const double flops = kern->getFLOPsPerRep();
+
+      getVariantPairRows(kern, getUntiledVariant, rows);
+
+      for (size_t ir = 0; ir < rows.size(); ++ir) {
+        const VariantPairRow& row = rows[ir];
+        const bool tiled = !row.is_base;
+        const double time = row.time;
+        const int nthreads = ( isOpenMPVariant(row.vid) ? max_threads : 1 );
+        const double peak = thread_peak * nthreads;
+
+        string tiles;
+        string tiles_from;
+        getVariantTileSizes(row.vid, run_params, tiles, tiles_from);
+
+        table.writeRowStart(file, kern->getName(), row.vid);
+        table.keyCell(file, 0) << tiles;
+        table.keyCell(file, 1) << tiles_from;
+        table.cell(file) << nthreads;
+        table.cell(file) << setprecision(prec) << std::scientific << time;
+
+        if ( flops > 0.0 && time > 0.0 ) {
+          const double gflops = flops / time / 1.0e9;
+          table.cell(file) << setprecision(prec) << std::fixed << gflops;
+          table.cell(file) << setprecision(prec) << std::fixed << peak;
+          if ( peak > 0.0 ) {
+            table.cell(file) << setprecision(2) << std::fixed 
+                             << 100.0 * gflops / peak;
+          } else {
+            table.notAvail(file);
+          }
+        } else {
+          table.notAvail(file);
+          table.notAvail(file);
+          table.notAvail(file);
+        }
+
+        if ( tiled && row.base_time > 0.0 && time > 0.0 ) {
+          table.cell(file) << setprecision(prec) << std::fixed 
+                           << row.base_time / time;
+        } else {
+          table.notAvail(file);
+        }
+        file << endl;
+
+      }  // loop over rows
+
+    }  // loop over kernels
+
+    file.flush(); 
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+bool Executor::haveFusedVariantRun() const
+{
+  for (size_t ik = 0; ik < kernels.size(); ++ik) {
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      if ( getUnfusedVariant(variant_ids[iv]) != NumVariants &&
+           kernels[ik]->wasVariantRun(variant_ids[iv]) ) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+
+void Executor::writeFusionReport(const string& filename)
+{
+  ofstream file(filename.c_str(), ios::out | ios::trunc);
+  if ( !file ) {
+    cout << " ERROR: Can't open output file " << filename << endl;
+  }
+
+  if ( file ) {
+
+    ReportTable table(kernels, variant_ids);
+    const size_t prec = table.prec;
+
+    table.addColumn("Bytes/Rep");
+    table.addColumn("Bytes Saved (%)");
+    table.addColumn("Time/Rep (sec)");
+    table.addColumn("GB/s");
+    table.addColumn("Time Saved (%)");
+    table.addColumn("Fusion Speedup");
+
+    table.writeHeader(file, 
+      "Loop Fusion Report (analytic bytes per rep, mean time per rep; "
+      "savings and speedup relative to unfused variant)");
+
+    //
+    // Print row for each fused variant run and its unfused counterpart,
+    // for each kernel that ran a fused variant.
+    //
+    vector<VariantPairRow> rows;
+
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      const double unfused_bytes = kern->getBytesPerRep();
+      const double fused_bytes = kern->getFusedBytesPerRep();
+
+      getVariantPairRows(kern, getUnfusedVariant, rows);
+
+      for (size_t ir = 0; ir < rows.size(); ++ir) {
+        const VariantPairRow& row = rows[ir];
+        const bool fused = !row.is_base;
+        const double bytes = ( fused ? fused_bytes : unfused_bytes );
+        const double time = row.time;
+        const double unfused_time = row.base_time;
+
+        table.writeRowStart(file, kern->getName(), row.vid);
+
+        if ( bytes > 0.0 ) {
+          table.cell(file) << setprecision(prec) << std::scientific << bytes;
+          if ( fused && unfused_bytes > 0.0 ) {
+            table.cell(file) << setprecision(2) << std::fixed 
+                             << 100.0 * (unfused_bytes - bytes) / unfused_bytes;
+          } else {
+            table.notAvail(file);
+          }
+        } else {
+          table.notAvail(file);
+          table.notAvail(file);
+        }
+
+        table.cell(file) << setprecision(prec) << std::scientific << time;
+        if ( bytes > 0.0 && time > 0.0 ) {
+          table.cell(file) << setprecision(prec) << std::fixed 
+                           << bytes / time / 1.0e9;
+        } else {
+          table.notAvail(file);
+        }
+
+        if ( fused && unfused_time > 0.0 && time > 0.0 ) {
+          table.cell(file) << setprecision(2) << std::fixed 
+                           << 100.0 * (unfused_time - time) / unfused_time;
+          table.cell(file) << setprecision(prec) << std::fixed 
+                           << unfused_time / time;
+        } else {
+          table.notAvail(file);
+          table.notAvail(file);
+        }
+        file << endl;
+
+      }  // loop over rows
+
+    }  // loop over kernels
+
+    file.flush(); 
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+bool Executor::haveRegionVariantRun() const
+{
+  for (size_t ik = 0; ik < kernels.size(); ++ik) {
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      if ( getUnregionedVariant(variant_ids[iv]) != NumVariants &&
+           kernels[ik]->wasVariantRun(variant_ids[iv]) ) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+
+void Executor::writeRegionReport(const string& filename)
+{
+  ofstream file(filename.c_str(), ios::out | ios::trunc);
+  if ( !file ) {
+    cout << " ERROR: Can't open output file " << filename << endl;
+  }
+
+  if ( file ) {
+
+    double forkjoin_time = 0.0;
+    double barrier_time = 0.0;
+    int nthreads = 1;
+#if defined(RAJA_ENABLE_OPENMP)
+    measureOpenMPOverheads(forkjoin_time, barrier_time);
+    nthreads = omp_get_max_threads();
+#endif
+
+    ReportTable table(kernels, variant_ids);
+    const size_t prec = table.prec;
+
+    table.addColumn("Loops/Rep");
+    table.addColumn("Regions/Rep");
+    table.addColumn("Time/Rep (sec)");
+    table.addColumn("Time Saved/Rep");
+    table.addColumn("Fork/Join Model");
+    table.addColumn("Barrier Model");
+    table.addColumn("Region Speedup");
+
+    ostringstream title;
+    title << "OpenMP Parallel Region Report (mean time per rep with " 
+          << nthreads << " threads; measured fork/join " 
+          << setprecision(prec) << std::scientific << forkjoin_time 
+          << " sec, barrier " << barrier_time << " sec; fork/join model is "
+          << "cost of regions not started, barrier model is cost of barriers "
+          << "between loops removed with nowait)";
+    table.writeHeader(file, title.str());
+
+    //
+    // Print row for each region variant run and its counterpart with a 
+    // parallel region per loop, for each kernel that ran a region variant.
+    //
+    vector<VariantPairRow> rows;
+
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      const int nloops = kern->getLoopsPerRep();
+
+      getVariantPairRows(kern, getUnregionedVariant, rows);
+
+      for (size_t ir = 0; ir < rows.size(); ++ir) {
+        const VariantPairRow& row = rows[ir];
+        const bool region = !row.is_base;
+        const double time = row.time;
+        const double unregioned_time = row.base_time;
+
+        table.writeRowStart(file, kern->getName(), row.vid);
+        table.cell(file) << nloops;
+        table.cell(file) << ( region ? 1 : nloops );
+        table.cell(file) << setprecision(prec) << std::scientific << time;
+
+        if ( region ) {
+          if ( unregioned_time > 0.0 ) {
+            table.cell(file) << setprecision(prec) << std::scientific 
+                             << unregioned_time - time;
+          } else {
+            table.notAvail(file);
+          }
+          table.cell(file) << setprecision(prec) << std::scientific 
+                           << (nloops - 1) * forkjoin_time;
+          table.cell(file) << setprecision(prec) << std::scientific 
+                           << (nloops - 1) * barrier_time;
+          if ( unregioned_time > 0.0 && time > 0.0 ) {
+            table.cell(file) << setprecision(prec) << std::fixed 
+                             << unregioned_time / time;
+          } else {
+            table.notAvail(file);
+          }
+        } else {
+          for (int ic = 0; ic < 4; ++ic) {
+            table.notAvail(file);
+          }
+        }
+        file << endl;
+
+      }  // loop over rows
+
+    }  // loop over kernels
+
+    file.flush(); 
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+bool Executor::haveNTStoreVariantRun() const
+{
+  for (size_t ik = 0; ik < kernels.size(); ++ik) {
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      if ( getRegularStoreVariant(variant_ids[iv]) != NumVariants &&
+           kernels[ik]->wasVariantRun(variant_ids[iv]) ) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+
+void Executor::writeNTStoreReport(const string& filename)
+{
+  ofstream file(filename.c_str(), ios::out | ios::trunc);
+  if ( !file ) {
+    cout << " ERROR: Can't open output file " << filename << endl;
+  }
+
+  if ( file ) {
+
+    ReportTable table(kernels, variant_ids);
+    const size_t prec = table.prec;
+
+    table.addColumn("Bytes/Rep");
+    table.addColumn("RFO Bytes/Rep");
+    table.addColumn("Time/Rep (sec)");
+    table.addColumn("GB/s");
+    table.addColumn("GB/s with RFO");
+    table.addColumn("RFO Saved (%)");
+    table.addColumn("NT Store Speedup");
+
+    table.writeHeader(file, 
+      "Streaming Store Report (analytic bytes per rep, mean time per "
+      "rep; regular stores also read output arrays for ownership; "
+      "speedup relative to regular store variant)");
+
+    //
+    // Print row for each streaming store variant run and its regular store
+    // counterpart, for each kernel that ran a streaming store variant.
+    //
+    vector<VariantPairRow> rows;
+
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      const double bytes = kern->getBytesPerRep();
+      const double written_bytes = kern->getBytesWrittenPerRep();
+
+      getVariantPairRows(kern, getRegularStoreVariant, rows);
+
+      for (size_t ir = 0; ir < rows.size(); ++ir) {
+        const VariantPairRow& row = rows[ir];
+        const bool nt = !row.is_base;
+        const double time = row.time;
+        const double regular_time = row.base_time;
+        const double rfo_bytes = ( nt ? 0.0 : written_bytes );
+
+        table.writeRowStart(file, kern->getName(), row.vid);
+        table.cell(file) << setprecision(prec) << std::scientific << bytes;
+        if ( written_bytes > 0.0 ) {
+          table.cell(file) << setprecision(prec) << std::scientific 
+                           << rfo_bytes;
+        } else {
+          table.notAvail(file);
+        }
+        table.cell(file) << setprecision(prec) << std::scientific << time;
+
+        if ( bytes > 0.0 && time > 0.0 ) {
+          table.cell(file) << setprecision(prec) << std::fixed 
+                           << bytes / time / 1.0e9;
+          if ( written_bytes > 0.0 ) {
+            table.cell(file) << setprecision(prec) << std::fixed 
+                             << (bytes + rfo_bytes) / time / 1.0e9;
+          } else {
+            table.notAvail(file);
+          }
+        } else {
+          table.notAvail(file);
+          table.notAvail(file);
+        }
+
+        if ( nt ) {
+          if ( written_bytes > 0.0 ) {
+            table.cell(file) << setprecision(2) << std::fixed 
+                             << 100.0 * written_bytes / (bytes + written_bytes);
+          } else {
+            table.notAvail(file);
+          }
+          if ( regular_time > 0.0 && time > 0.0 ) {
+            table.cell(file) << setprecision(prec) << std::fixed 
+                             << regular_time / time;
+          } else {
+            table.notAvail(file);
+          }
+        } else {
+          table.notAvail(file);
+          table.notAvail(file);
+        }
+        file << endl;
+
+      }  // loop over rows
+
+    }  // loop over kernels
+
+    file.flush(); 
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+void Executor::writeThreadScalingReport(const string& filename)
+{
+  ofstream file(filename.c_str(), ios::out | ios::trunc);
+  if ( !file ) {
+    cout << " ERROR: Can't open output file " << filename << endl;
+  }
+
+  if ( file ) {
+
+    const vector<int>& thread_counts = run_params.getThreadCounts();
+
+    //
+    // Speedup and parallel efficiency are relative to smallest thread 
+    // count in sweep.
+    //
+    size_t base_it = 0;
+    for (size_t it = 1; it < thread_counts.size(); ++it) {
+      if ( thread_counts[it] < thread_counts[base_it] ) {
+        base_it = it;
+      }
+    }
+
+    //
+    // OpenMP thread binding can only be set when the program starts 
+    // (OMP_PROC_BIND, OMP_PLACES), so record the policy this run used.
+    //
+    string bind_name("n/a");
+    int num_places = 0;
+#if defined(RAJA_ENABLE_OPENMP)
+    switch ( omp_get_proc_bind() ) {
+      case omp_proc_bind_false : { bind_name = "false"; break; }
+      case omp_proc_bind_true : { bind_name = "true"; break; }
+      case omp_proc_bind_master : { bind_name = "master"; break; }
+      case omp_proc_bind_close : { bind_name = "close"; break; }
+      case omp_proc_bind_spread : { bind_name = "spread"; break; }
+      default : { bind_name = "unknown"; }
+    }
+    num_places = omp_get_num_places();
+#endif
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string threads_col_name("Threads  ");
+    const string sepchr(" , ");
+    size_t prec = 4;
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size()); 
+    }
+    kercol_width++;
+
+    size_t varcol_width = variant_col_name.size();
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size()); 
+    }
+    varcol_width++;
+
+    size_t thrcol_width = threads_col_name.size() + 1;
+
+    size_t datacol_width = prec + 12;
+
+    //
+    // Print title line.
+    //
+    file << "Thread Scaling Report (mean time per rep; speedup and "
+         << "efficiency relative to " << thread_counts[base_it] 
+         << " threads; proc_bind = " << bind_name 
+         << ", places = " << num_places << ")";
+    for (size_t ic = 0; ic < 5; ++ic) {
+      file << sepchr;
+    }
+    file << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(thrcol_width) << threads_col_name
+         << sepchr <<left<< setw(datacol_width) << "Time/Rep (sec)"
+         << sepchr <<left<< setw(datacol_width) << "Speedup"
+         << sepchr <<left<< setw(datacol_width) << "Parallel Eff";
+    file << endl;
+
+    //
+    // Print row of scaling data for each thread count of each 
+    // OpenMP kernel variant run.
+    //
+    const double npasses = run_params.getNumPasses();
+
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+
+        if ( kern->wasVariantRun(vid) && isOpenMPVariant(vid) ) {
+
+          const double base_time = thread_sweep_time[ik][iv][base_it] / npasses;
+
+          for (size_t it = 0; it < thread_counts.size(); ++it) {
+
+            const double time = thread_sweep_time[ik][iv][it] / npasses;
+            const double speedup = ( time > 0.0 ? base_time / time : 0.0 );
+            const double eff = speedup * thread_counts[base_it] / 
+                               thread_counts[it];
+
+            file <<left<< setw(kercol_width) << kern->getName()
+                 << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+                 << sepchr <<right<< setw(thrcol_width) << thread_counts[it]
+                 << sepchr <<right<< setw(datacol_width) 
+                 << setprecision(prec) << std::scientific << time
+                 << sepchr <<right<< setw(datacol_width) 
+                 << setprecision(prec) << std::fixed << speedup
+                 << sepchr <<right<< setw(datacol_width) 
+                 << setprecision(prec) << std::fixed << eff;
+            file << endl;
+
+          }
+
+        }
+
+      }  // loop over variants
+
+    }  // loop over kernels
+
+    file.flush(); 
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+void Executor::writeScheduleReport(const string& filename)
+{
+  ofstream file(filename.c_str(), ios::out | ios::trunc);
+  if ( !file ) {
+    cout << " ERROR: Can't open output file " << filename << endl;
+  }
+
+  if ( file ) {
+
+    const vector<OpenMPSchedule>& omp_scheds = run_params.getOpenMPSchedules();
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string sched_col_name("Schedule  ");
+    const string sepchr(" , ");
+    size_t prec = 4;
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size()); 
+    }
+    kercol_width++;
+
+    size_t varcol_width = variant_col_name.size();
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size()); 
+    }
+    varcol_width++;
+
+    size_t schedcol_width = sched_col_name.size();
+    for (size_t is = 0; is < omp_scheds.size(); ++is) {
+      schedcol_width = max(schedcol_width, 
+                           getOpenMPScheduleName(omp_scheds[is]).size()); 
+    }
+    schedcol_width++;
+
+    size_t datacol_width = prec + 12;
+
+    //
+    // Print title line.
+    //
+    file << "OpenMP Schedule Report (mean time per rep; speedup relative to "
+         << "Base_OpenMP variant, if run)";
+    for (size_t ic = 0; ic < 4; ++ic) {
+      file << sepchr;
+    }
+    file << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(schedcol_width) << sched_col_name
+         << sepchr <<left<< setw(datacol_width) << "Time/Rep (sec)"
+         << sepchr <<left<< setw(datacol_width) << "Speedup";
+    file << endl;
+
+    //
+    // Print row for each schedule of each Base_OpenMP_Sched variant run.
+    //
+#if defined(RAJA_ENABLE_OPENMP)
+    const double npasses = run_params.getNumPasses();
+
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      const double nreps = kern->getRunReps();
+      const double base_time = 
+        ( nreps > 0.0 && kern->wasVariantRun(Base_OpenMP) ? 
+          kern->getTotTime(Base_OpenMP) / npasses / nreps : 0.0 );
+
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+
+        if ( kern->wasVariantRun(vid) && vid == Base_OpenMP_Sched ) {
+
+          for (size_t is = 0; is < omp_scheds.size(); ++is) {
+
+            const double time = sched_sweep_time[ik][iv][is] / npasses;
+
+            file <<left<< setw(kercol_width) << kern->getName()
+                 << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+                 << sepchr <<left<< setw(schedcol_width) 
+                 << getOpenMPScheduleName(omp_scheds[is])
+                 << sepchr <<right<< setw(datacol_width) 
+                 << setprecision(prec) << std::scientific << time
+                 << sepchr <<right<< setw(datacol_width);
+            if ( base_time > 0.0 && time > 0.0 ) {
+              file << setprecision(prec) << std::fixed << base_time / time;
+            } else {
+              file << "Not run";
+            }
+            file << endl;
+
+          }
+
+        }
+
+      }  // loop over variants
+
+    }  // loop over kernels
+#endif
+
+    file.flush(); 
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+void Executor::writePrefetchReport(const string& filename)
+{
+  ofstream file(filename.c_str(), ios::out | ios::trunc);
+  if ( !file ) {
+    cout << " ERROR: Can't open output file " << filename << endl;
+  }
+
+  if ( file ) {
+
+    const vector<int>& prefetch_dists = run_params.getPrefetchDistances();
+
+    ReportTable table(kernels, variant_ids);
+    const size_t prec = table.prec;
+
+    table.addColumn("Distance");
+    table.addColumn("Time/Rep (sec)");
+    table.addColumn("Speedup");
+
+    table.writeHeader(file, 
+      "Software Prefetch Report (mean time per rep for each prefetch "
+      "distance in loop iterations; speedup relative to same variant "
+      "with distance 0, i.e., without prefetch; best distance is fastest)");
+
+    //
+    // Print row for each distance of each prefetch variant run, then a 
+    // row for the best distance.
+    //
+    const double npasses = run_params.getNumPasses();
+
+    //
+    // Sweep always includes distance 0 (see RunParams).
+    //
+    const size_t zero_id = find(prefetch_dists.begin(), prefetch_dists.end(), 
+                                0) - prefetch_dists.begin();
+
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+
+        if ( getNoPrefetchVariant(vid) == NumVariants || 
+             !kern->wasVariantRun(vid) ) {
+          continue;
+        }
+
+        const double base_time = 
+          ( zero_id < prefetch_dists.size() ? 
+            prefetch_sweep_time[ik][iv][zero_id] / npasses : 0.0 );
+
+        size_t best_id = 0;
+        for (size_t id = 0; id < prefetch_dists.size(); ++id) {
+          if ( prefetch_sweep_time[ik][iv][id] < 
+               prefetch_sweep_time[ik][iv][best_id] ) {
+            best_id = id;
+          }
+        }
+
+        for (size_t id = 0; id <= prefetch_dists.size(); ++id) {
+
+          const bool best_row = ( id == prefetch_dists.size() );
+          const size_t idist = ( best_row ? best_id : id );
+          const double time = prefetch_sweep_time[ik][iv][idist] / npasses;
+
+          ostringstream dist;
+          if ( best_row ) {
+            dist << "best " << prefetch_dists[idist];
+          } else {
+            dist << prefetch_dists[idist];
+          }
+
+          table.writeRowStart(file, kern->getName(), vid);
+          table.keyCell(file, 0) << dist.str();
+          table.cell(file) << setprecision(prec) << std::scientific << time;
+          if ( base_time > 0.0 && time > 0.0 ) {
+            table.cell(file) << setprecision(prec) << std::fixed 
+                             << base_time / time;
+          } else {
+            table.notAvail(file);
+          }
+          file << endl;
+
+        }
+
+      }  // loop over variants
+
+    }  // loop over kernels
+
+    file.flush(); 
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+void Executor::writeFIRCoeffLenReport(const string& filename)
+{
+  ofstream file(filename.c_str(), ios::out | ios::trunc);
+  if ( !file ) {
+    cout << " ERROR: Can't open output file " << filename << endl;
+  }
+
+  if ( file ) {
+
+    const vector<int>& fir_lens = run_params.getFIRCoeffLens();
+
+    ReportTable table(kernels, variant_ids);
+    const size_t prec = table.prec;
+
+    const string len_col_name("Coeff Len  ");
+    table.addColumn(len_col_name, len_col_name.size());
+    table.addColumn("Time/Rep (sec)");
+    table.addColumn("GFLOP/s");
+    table.addColumn("Blocked Speedup");
+
+    table.writeHeader(file, 
+      "FIR Coefficient Length Report (mean time per rep and GFLOP/s "
+      "for each coefficient length; speedup of register-blocked "
+      "variant relative to variant that computes one output at a "
+      "time, if run)");
+
+    //
+    // Print row for each coefficient length of each FIR variant run.
+    //
+    const double npasses = run_params.getNumPasses();
+
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      if ( kern->getKernelID() != Apps_FIR ) {
+        continue;
+      }
+
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+
+        if ( !kern->wasVariantRun(vid) ) {
+          continue;
+        }
+
+        VariantID unblocked_vid = getUnblockedVariant(vid);
+        size_t unblocked_iv = variant_ids.size();
+        if ( unblocked_vid != NumVariants && 
+             kern->wasVariantRun(unblocked_vid) ) {
+          unblocked_iv = find(variant_ids.begin(), variant_ids.end(), 
+                              unblocked_vid) - variant_ids.begin();
+        }
+
+        for (size_t il = 0; il < fir_lens.size(); ++il) {
+
+          const double time = fir_sweep_time[ik][iv][il] / npasses;
+          const double flops = fir_sweep_flops[ik][il];
+
+          table.writeRowStart(file, kern->getName(), vid);
+          table.keyCell(file, 0) << fir_lens[il];
+          table.cell(file) << setprecision(prec) << std::scientific << time;
+          if ( time > 0.0 ) {
+            table.cell(file) << setprecision(prec) << std::fixed 
+                             << flops / time / 1.0e9;
+          } else {
+            table.notAvail(file);
+          }
+          if ( unblocked_iv < variant_ids.size() && time > 0.0 ) {
+            const double unblocked_time = 
+              fir_sweep_time[ik][unblocked_iv][il] / npasses;
+            table.cell(file) << setprecision(prec) << std::fixed 
+                             << unblocked_time / time;
+          } else {
+            table.notAvail(file);
+          }
+          file << endl;
+
+        }
+
+      }  // loop over variants
+
+    }  // loop over kernels
+
+    file.flush(); 
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+void Executor::writeSizeSweepReport(const string& filename)
+{
+  ofstream file(filename.c_str(), ios::out | ios::trunc);
+  if ( !file ) {
+    cout << " ERROR: Can't open output file " << filename << endl;
+  }
+
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string sepchr(" , ");
+    const string not_avail("n/a");
+    size_t prec = 4;
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size()); 
+    }
+    kercol_width++;
+
+    size_t varcol_width = variant_col_name.size();
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size()); 
+    }
+    varcol_width++;
+
+    size_t datacol_width = prec + 12;
+
+    const string col_names[] = { "Size Factor", "Its/Rep", "Bytes/Rep", 
+                                 "Time/Rep (sec)", "GB/s", "MIts/s" };
+    const size_t ncols = sizeof(col_names) / sizeof(col_names[0]); 
+
+    //
+    // Print title line.
+    //
+    file << "Size Sweep Report (mean time per rep; bytes per rep from "
+         << "kernel model approximates working set)";
+    for (size_t ic = 0; ic < ncols + 1; ++ic) {
+      file << sepchr;
+    }
+    file << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name;
+    for (size_t ic = 0; ic < ncols; ++ic) {
+      file << sepchr <<left<< setw(datacol_width) << col_names[ic];
+    }
+    file << endl;
+
+    //
+    // Print row for each size point of each kernel variant run.
+    //
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+
+        if ( kern->wasVariantRun(vid) ) {
+
+          for (size_t ip = 0; ip < size_sweep[ik].size(); ++ip) {
+            const SizeSweepPoint& point = size_sweep[ik][ip];
+            const double time = point.time[iv];
+
+            if ( point.its_per_rep <= 0 ) {
+              continue;
+            }
+
+            file <<left<< setw(kercol_width) << kern->getName()
+                 << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+                 << sepchr <<right<< setw(datacol_width) 
+                 << setprecision(prec) << std::scientific << point.size_fact
+                 << sepchr <<right<< setw(datacol_width) << point.its_per_rep
+                 << sepchr <<right<< setw(datacol_width) 
+                 << setprecision(prec) << std::scientific 
+                 << point.bytes_per_rep
+                 << sepchr <<right<< setw(datacol_width) 
+                 << setprecision(prec) << std::scientific << time;
+
+            if ( point.bytes_per_rep > 0.0 && time > 0.0 ) {
+              file << sepchr <<right<< setw(datacol_width) 
+                   << setprecision(prec) << std::fixed 
+                   << point.bytes_per_rep / time / 1.0e9;
+            } else {
+              file << sepchr <<right<< setw(datacol_width) << not_avail;
+            }
+
+            if ( time > 0.0 ) {
+              file << sepchr <<right<< setw(datacol_width) 
+                   << setprecision(prec) << std::fixed 
+                   << point.its_per_rep / time / 1.0e6;
+            } else {
+              file << sepchr <<right<< setw(datacol_width) << not_avail;
+            }
+
+            file << endl;
+
+          }  // loop over size points
+
+        }
+
+      }  // loop over variants
+
+    }  // loop over kernels
+
+    file.flush(); 
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+void Executor::writePrecisionReport(const string& filename)
+{
+  ofstream file(filename.c_str(), ios::out | ios::trunc);
+  if ( !file ) {
+    cout << " ERROR: Can't open output file " << filename << endl;
+  }
+
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string sepchr(" , ");
+    const string not_avail("n/a");
+    size_t prec = 6;
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size()); 
+    }
+    kercol_width++;
+
+    size_t varcol_width = variant_col_name.size();
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size()); 
+    }
+    varcol_width++;
+
+    size_t datacol_width = prec + 14;
+
+    const string dname = getPrecisionName(DoublePrecision);
+    const string fname = getPrecisionName(FloatPrecision);
+    const string col_names[] = { dname + " Time/Rep", fname + " Time/Rep", 
+                                 "Speedup", 
+                                 dname + " Checksum", fname + " Checksum", 
+                                 "Rel Checksum Drift" };
+    const size_t ncols = sizeof(col_names) / sizeof(col_names[0]); 
+
+    //
+    // Print title line.
+    //
+    file << "Precision Report (mean time per rep in sec.; speedup is " 
+         << dname << " time / " << fname << " time; checksum drift is "
+         << "(" << fname << " - " << dname << ") / |" << dname << "|)";
+    for (size_t ic = 0; ic < ncols + 1; ++ic) {
+      file << sepchr;
+    }
+    file << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name;
+    for (size_t ic = 0; ic < ncols; ++ic) {
+      file << sepchr <<left<< setw(datacol_width) << col_names[ic];
+    }
+    file << endl;
+
+    //
+    // Print row for each kernel variant run in both precisions.
+    //
+    const int npasses = run_params.getNumPasses();
+    const bool default_is_double = ( getDefaultPrecision() == DoublePrecision );
+
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+
+        if ( !kern->wasVariantRun(vid) ) {
+          continue;
+        }
+
+        double suite_time = 0.0;
+        if ( kern->getRunReps() > 0 ) {
+          suite_time = kern->getTotTime(vid) / npasses / kern->getRunReps();
+        }
+        const Checksum_type suite_cksum = kern->getChecksum(vid);
+
+        const double dtime = 
+          ( default_is_double ? suite_time : prec_time[ik][iv] );
+        const double ftime = 
+          ( default_is_double ? prec_time[ik][iv] : suite_time );
+        const Checksum_type dcksum = 
+          ( default_is_double ? suite_cksum : prec_checksum[ik][iv] );
+        const Checksum_type fcksum = 
+          ( default_is_double ? prec_checksum[ik][iv] : suite_cksum );
+
+        file <<left<< setw(kercol_width) << kern->getName()
+             << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+             << sepchr <<right<< setw(datacol_width) 
+             << setprecision(prec) << std::scientific << dtime
+             << sepchr <<right<< setw(datacol_width) 
+             << setprecision(prec) << std::scientific << ftime;
+
+        if ( dtime > 0.0 && ftime > 0.0 ) {
+          file << sepchr <<right<< setw(datacol_width) 
+               << setprecision(3) << std::fixed << dtime / ftime;
+        } else {
+          file << sepchr <<right<< setw(datacol_width) << not_avail;
+        }
+
+        file << sepchr <<right<< setw(datacol_width) 
+             << setprecision(prec) << std::scientific << dcksum
+             << sepchr <<right<< setw(datacol_width) 
+             << setprecision(prec) << std::scientific << fcksum;
+
+        if ( dcksum != 0.0 ) {
+          file << sepchr <<right<< setw(datacol_width) 
+               << setprecision(prec) << std::scientific 
+               << (fcksum - dcksum) / std::abs(dcksum);
+        } else {
+          file << sepchr <<right<< setw(datacol_width) << not_avail;
+        }
+
+        file << endl;
+
+      }  // loop over variants
+
+    }  // loop over kernels
+
+    file.flush(); 
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+void Executor::writeIndexWidthReport(const string& filename)
+{
+  ofstream file(filename.c_str(), ios::out | ios::trunc);
+  if ( !file ) {
+    cout << " ERROR: Can't open output file " << filename << endl;
+  }
+
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string sepchr(" , ");
+    const string not_avail("n/a");
+    size_t prec = 6;
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size()); 
+    }
+    kercol_width++;
+
+    size_t varcol_width = variant_col_name.size();
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size()); 
+    }
+    varcol_width++;
+
+    size_t datacol_width = prec + 14;
+
+    const string name32 = getIndexWidthName(Index32);
+    const string name64 = getIndexWidthName(Index64);
+    const string col_names[] = { name32 + " Time/Rep", name64 + " Time/Rep", 
+                                 name64 + " Delta (%)", 
+                                 "Rel Checksum Diff" };
+    const size_t ncols = sizeof(col_names) / sizeof(col_names[0]); 
+
+    //
+    // Print title line.
+    //
+    file << "Index Width Report (mean time per rep in sec.; delta is (" 
+         << name64 << " time - " << name32 << " time) / " << name32 
+         << " time; checksum diff is relative to " 
+         << getIndexWidthName(getDefaultIndexWidth()) << ")";
+    for (size_t ic = 0; ic < ncols + 1; ++ic) {
+      file << sepchr;
+    }
+    file << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name;
+    for (size_t ic = 0; ic < ncols; ++ic) {
+      file << sepchr <<left<< setw(datacol_width) << col_names[ic];
+    }
+    file << endl;
+
+    //
+    // Print row for each kernel variant run; kernels too large for 
+    // 32-bit indices have no comparison run.
+    //
+    const int npasses = run_params.getNumPasses();
+    const bool default_is_32 = ( getDefaultIndexWidth() == Index32 );
+
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+
+        if ( !kern->wasVariantRun(vid) ) {
+          continue;
+        }
+
+        double suite_time = 0.0;
+        if ( kern->getRunReps() > 0 ) {
+          suite_time = kern->getTotTime(vid) / npasses / kern->getRunReps();
+        }
+        const double alt_time = index_time[ik][iv];
+
+        const double time32 = ( default_is_32 ? suite_time : alt_time );
+        const double time64 = ( default_is_32 ? alt_time : suite_time );
+
+        file <<left<< setw(kercol_width) << kern->getName()
+             << sepchr <<left<< setw(varcol_width) << getVariantName(vid);
+
+        if ( time32 > 0.0 ) {
+          file << sepchr <<right<< setw(datacol_width) 
+               << setprecision(prec) << std::scientific << time32;
+        } else {
+          file << sepchr <<right<< setw(datacol_width) << not_avail;
+        }
+
+        if ( time64 > 0.0 ) {
+          file << sepchr <<right<< setw(datacol_width) 
+               << setprecision(prec) << std::scientific << time64;
+        } else {
+          file << sepchr <<right<< setw(datacol_width) << not_avail;
+        }
+
+        if ( time32 > 0.0 && time64 > 0.0 ) {
+          file << sepchr <<right<< setw(datacol_width) 
+               << setprecision(2) << std::fixed 
+               << 100.0 * (time64 - time32) / time32;
+        } else {
+          file << sepchr <<right<< setw(datacol_width) << not_avail;
+        }
+
+        const Checksum_type suite_cksum = kern->getChecksum(vid);
+        if ( alt_time > 0.0 && suite_cksum != 0.0 ) {
+          file << sepchr <<right<< setw(datacol_width) 
+               << setprecision(prec) << std::scientific 
+               << (index_checksum[ik][iv] - suite_cksum) / 
+                  std::abs(suite_cksum);
+        } else {
+          file << sepchr <<right<< setw(datacol_width) << not_avail;
+        }
+
+        file << endl;
+
+      }  // loop over variants
+
+    }  // loop over kernels
+
+    file.flush(); 
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+void Executor::writeWarmupReport(const string& filename)
+{
+  ofstream file(filename.c_str(), ios::out | ios::trunc);
+  if ( !file ) {
+    cout << " ERROR: Can't open output file " << filename << endl;
+  }
+
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string sepchr(" , ");
+    const string not_avail("n/a");
+    size_t prec = 4;
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size()); 
+    }
+    kercol_width++;
+
+    size_t varcol_width = variant_col_name.size();
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size()); 
+    }
+    varcol_width++;
+
+    size_t datacol_width = prec + 12;
+
+    const string col_names[] = { "Warmup Reps", "Warmup Time/Rep", 
+                                 "Timed Time/Rep", "Warmup/Timed" };
+    const size_t ncols = sizeof(col_names) / sizeof(col_names[0]); 
+
+    //
+    // Print title line.
+    //
+    file << "Warmup Report (mean time per rep (sec.) of untimed warmup reps "
+         << "vs. timed reps)";
+    for (size_t ic = 0; ic < ncols + 1; ++ic) {
+      file << sepchr;
+    }
+    file << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name;
+    for (size_t ic = 0; ic < ncols; ++ic) {
+      file << sepchr <<left<< setw(datacol_width) << col_names[ic];
+    }
+    file << endl;
+
+    //
+    // Print row of warmup data for each kernel variant run.
+    //
+    const double npasses = run_params.getNumPasses();
+
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+
+        if ( kern->wasVariantRun(vid) ) {
+
+          const double nwarmup = kern->getWarmupReps(vid);
+          const double warmup_time = 
+            ( nwarmup > 0.0 ? kern->getWarmupTime(vid) / nwarmup : 0.0 );
+
+          const double nreps = kern->getRunReps();
+          const double time = 
+            ( nreps > 0.0 ? kern->getTotTime(vid) / npasses / nreps : 0.0 );
+
+          file <<left<< setw(kercol_width) << kern->getName()
+               << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+               << sepchr <<right<< setw(datacol_width) 
+               << kern->getWarmupReps(vid)
+               << sepchr <<right<< setw(datacol_width) 
+               << setprecision(prec) << std::scientific << warmup_time
+               << sepchr <<right<< setw(datacol_width) 
+               << setprecision(prec) << std::scientific << time;
+
+          if ( time > 0.0 ) {
+            file << sepchr <<right<< setw(datacol_width) 
+                 << setprecision(prec) << std::fixed << warmup_time / time;
+          } else {
+            file << sepchr <<right<< setw(datacol_width) << not_avail;
+          }
+
+          file << endl;
+
+        }
+
+      }  // loop over variants
+
+    }  // loop over kernels
+
+    file.flush(); 
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+void Executor::writeDataPlacementReport(const string& filename)
+{
+  ofstream file(filename.c_str(), ios::out | ios::trunc);
+  if ( !file ) {
+    cout << " ERROR: Can't open output file " << filename << endl;
+  }
+
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string sepchr(" , ");
+    size_t prec = 2;
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size()); 
+    }
+    kercol_width++;
+
+    size_t varcol_width = variant_col_name.size();
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size()); 
+    }
+    varcol_width++;
+
+    size_t datacol_width = 14;
+
+    size_t nnodes = 1;
+    for (size_t ik = 0; ik < data_page_counts.size(); ++ik) {
+      for (size_t iv = 0; iv < data_page_counts[ik].size(); ++iv) {
+        nnodes = max(nnodes, data_page_counts[ik][iv].size());
+      }
+    }
+
+    //
+    // Print title line.
+    //
+    file << "Data Placement Report (placement = " 
+         << getDataPlacementName( getDataPlacement() ) 
+         << "; pct of sampled data array pages on each NUMA node)";
+    for (size_t in = 0; in < nnodes + 2; ++in) {
+      file << sepchr;
+    }
+    file << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(datacol_width) << "Pages Sampled";
+    for (size_t in = 0; in < nnodes; ++in) {
+      file << sepchr <<left<< setw(datacol_width) 
+           << "Node " + std::to_string(in) + " %";
+    }
+    file << endl;
+
+    //
+    // Print row of page placement data for each kernel variant run.
+    //
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+
+        if ( kern->wasVariantRun(vid) ) {
+
+          const vector<long>& counts = data_page_counts[ik][iv];
+          long npages = 0;
+          for (size_t in = 0; in < counts.size(); ++in) {
+            npages += counts[in];
+          }
+
+          file <<left<< setw(kercol_width) << kern->getName()
+               << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+               << sepchr <<right<< setw(datacol_width) << npages;
+
+          for (size_t in = 0; in < nnodes; ++in) {
+            const double pct = ( npages > 0 && in < counts.size() ? 
+                                 100.0 * counts[in] / npages : 0.0 );
+            file << sepchr <<right<< setw(datacol_width) 
+                 << setprecision(prec) << std::fixed << pct;
+          }
+
+          file << endl;
+
+        }
+
+      }  // loop over variants
+
+    }  // loop over kernels
+
+    file.flush(); 
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+void Executor::writeHugePageReport(const string& filename)
+{
+  ofstream file(filename.c_str(), ios::out | ios::trunc);
+  if ( !file ) {
+    cout << " ERROR: Can't open output file " << filename << endl;
+  }
+
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string sepchr(" , ");
+    size_t prec = 2;
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size()); 
+    }
+    kercol_width++;
+
+    size_t varcol_width = variant_col_name.size();
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size()); 
+    }
+    varcol_width++;
+
+    const size_t ncols = 6;
+    const string data_col_names[ncols] = { "Arrays",
+                                           "MB Requested",
+                                           "MB Explicit",
+                                           "MB THP Advised",
+                                           "MB THP Obtained",
+                                           "MB Regular" };
+    size_t datacol_width = 0;
+    for (size_t ic = 0; ic < ncols; ++ic) {
+      datacol_width = max(datacol_width, data_col_names[ic].size());
+    }
+    datacol_width++;
+
+    const double mb = 1024.0 * 1024.0;
+
+    //
+    // Print title line.
+    //
+    file << "Huge Page Report (mode = " 
+         << getDataPageModeName( getDataPageMode() ) 
+         << "; data arrays allocated in one kernel execution)";
+    for (size_t ic = 0; ic < ncols + 1; ++ic) {
+      file << sepchr;
+    }
+    file << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name;
+    for (size_t ic = 0; ic < ncols; ++ic) {
+      file << sepchr <<left<< setw(datacol_width) << data_col_names[ic];
+    }
+    file << endl;
+
+    //
+    // Print row of page data for each kernel variant run.
+    //
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+
+        if ( kern->wasVariantRun(vid) ) {
+
+          const DataPageStats& stats = data_page_stats[ik][iv];
+
+          file <<left<< setw(kercol_width) << kern->getName()
+               << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+               << sepchr <<right<< setw(datacol_width) << stats.num_arrays
+               << setprecision(prec) << std::fixed
+               << sepchr <<right<< setw(datacol_width) 
+               << stats.bytes / mb
+               << sepchr <<right<< setw(datacol_width) 
+               << stats.explicit_bytes / mb
+               << sepchr <<right<< setw(datacol_width) 
+               << stats.thp_bytes / mb
+               << sepchr <<right<< setw(datacol_width) 
+               << stats.thp_obtained_bytes / mb
+               << sepchr <<right<< setw(datacol_width) 
+               << stats.regular_bytes / mb
+               << endl;
+
+        }
+
+      }  // loop over variants
+
+    }  // loop over kernels
+
+    file.flush(); 
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+void Executor::writeTimingStatsReport(const string& filename)
+{
+  ofstream file(filename.c_str(), ios::out | ios::trunc);
+  if ( !file ) {
+    cout << " ERROR: Can't open output file " << filename << endl;
+  }
+
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string sepchr(" , ");
+    size_t prec = 4;
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size()); 
+    }
+    kercol_width++;
+
+    size_t varcol_width = variant_col_name.size();
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size()); 
+    }
+    varcol_width++;
+
+    size_t datacol_width = prec + 8;
+
+    const char* stat_names[] = { "Samples", "Mean", "Std Dev", "Min", 
+                                 "P05", "P25", "Median", "P75", "P95", 
+                                 "Max", "CI95 Lo", "CI95 Hi" };
+    const size_t nstats = sizeof(stat_names) / sizeof(stat_names[0]); 
+
+    //
+    // Print title line.
+    //
+    file << "Timing Statistics Report (sec. per rep over timing samples; " 
+         << "CI95 is 95% confidence interval of mean)";
+    for (size_t is = 0; is < nstats + 1; ++is) {
+      file << sepchr;
+    }
+    file << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name;
+    for (size_t is = 0; is < nstats; ++is) {
+      file << sepchr <<left<< setw(datacol_width) << stat_names[is];
+    }
+    file << endl;
+
+    //
+    // Print row of statistics for each kernel variant run.
+    //
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+
+        if ( kern->wasVariantRun(vid) ) {
+
+          SampleStats stats;
+          getSampleStats(kern->getTimeSamples(vid), stats);
+
+          file <<left<< setw(kercol_width) << kern->getName()
+               << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+               << sepchr <<right<< setw(datacol_width) << stats.nsamples;
+
+          double vals[] = { stats.mean, stats.stddev, stats.min,
+                            stats.p05, stats.p25, stats.median, 
+                            stats.p75, stats.p95, stats.max,
+                            stats.ci95_lo, stats.ci95_hi };
+          for (size_t is = 0; is < nstats - 1; ++is) {
+            file << sepchr <<right<< setw(datacol_width) 
+                 << setprecision(prec) << std::scientific << vals[is];
+          }
+          file << endl;
+
+        }
+
+      }  // loop over variants
+
+    }  // loop over kernels
+
+    file.flush(); 
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+void Executor::getSampleStats(const vector<double>& samples, 
+                              SampleStats& stats)
+{
+  stats.nsamples = samples.size();
+  stats.mean = stats.stddev = stats.min = stats.max = 0.0;
+  stats.p05 = stats.p25 = stats.median = stats.p75 = stats.p95 = 0.0;
+  stats.ci95_lo = stats.ci95_hi = 0.0;
+
+  const size_t n = samples.size();
+  if ( n == 0 ) {
+    return;
+  }
+
+  vector<double> sorted(samples);
+  sort(sorted.begin(), sorted.end());
+
+  double sum = 0.0;
+  for (size_t i = 0; i < n; ++i) {
+    sum += sorted[i];
+  }
+  stats.mean = sum / n;
+
+  double sumsq = 0.0;
+  for (size_t i = 0; i < n; ++i) {
+    sumsq += (sorted[i] - stats.mean) * (sorted[i] - stats.mean);
+  }
+  stats.stddev = ( n > 1 ? sqrt( sumsq / (n - 1) ) : 0.0 );
+
+  //
+  // Percentiles use linear interpolation between closest ranks.
+  //
+  struct Pct {
+    static double get(const vector<double>& v, double pct) {
+      double pos = pct * (v.size() - 1);
+      size_t lo = static_cast<size_t>(pos);
+      size_t hi = min(lo + 1, v.size() - 1);
+      return v[lo] + (pos - lo) * (v[hi] - v[lo]);
+    }
+  };
+
+  stats.min    = sorted.front();
+  stats.p05    = Pct::get(sorted, 0.05);
+  stats.p25    = Pct::get(sorted, 0.25);
+  stats.median = Pct::get(sorted, 0.50);
+  stats.p75    = Pct::get(sorted, 0.75);
+  stats.p95    = Pct::get(sorted, 0.95);
+  stats.max    = sorted.back();
+
+  //
+  // Two-sided 95% Student-t critical value for n-1 degrees of freedom.
+  //
+  if ( n > 1 ) {
+    double tval = getStudentT95(n - 1);
+    double half_width = tval * stats.stddev / sqrt( static_cast<double>(n) );
+    stats.ci95_lo = stats.mean - half_width;
+    stats.ci95_hi = stats.mean + half_width;
+  } else {
+    stats.ci95_lo = stats.ci95_hi = stats.mean;
+  }
+}
+
+
 string Executor::getReportTitle(CSVRepMode mode)
 {
   string title;
@@ -875,7 +3826,8 @@ void Executor::getFOMGroups(vector<FOMGroup>& fom_groups)
 
       for (size_t ivs = iv+1; ivs < variant_ids.size(); ++ivs) {
         VariantID vids = variant_ids[ivs];
-        if ( getVariantName(vids).find(pm) != string::npos ) {
+        const string& vsname = getVariantName(vids);
+        if ( vsname.substr(vsname.find("_") + 1) == pm ) {
           group.variants.push_back(vids);
         }
       }
@@ -19,10 +19,12 @@
 
 #include "common/RAJAPerfSuite.hpp"
 #include "common/RunParams.hpp"
+#include "common/HWCounters.hpp"
 
 #include <iosfwd>
 #include <utility>
 #include <set>
+#include <vector>
 
 namespace rajaperf {
 
@@ -65,6 +67,37 @@ private:
     std::vector<VariantID> variants;
   }; 
 
+  struct SampleStats {
+    size_t nsamples;
+    double mean;
+    double stddev;
+    double min;
+    double p05;
+    double p25;
+    double median;
+    double p75;
+    double p95;
+    double max;
+    double ci95_lo;   /*!< 95% confidence interval of mean */
+    double ci95_hi;
+  };
+
+  struct SizeSweepPoint {
+    double size_fact;
+    Index_type its_per_rep;
+    double bytes_per_rep;
+    std::vector<double> time;   /*!< mean time per rep (sec.) of each 
+                                     variant; indexed as variant_ids */
+  };
+
+  struct VariantPairRow {
+    VariantID vid;
+    bool is_base;       /*!< true if vid is counterpart of variant compared */
+    double time;        /*!< mean time per rep (sec.) of vid */
+    double base_time;   /*!< mean time per rep (sec.) of counterpart;
+                             0 if counterpart was not run */
+  };
+
   bool haveReferenceVariant() { return reference_vid < NumVariants; }
 
   void writeCSVReport(const std::string& filename, CSVRepMode mode, 
@@ -75,6 +108,57 @@ private:
 
   void writeChecksumReport(const std::string& filename);  
 
+  void writeCountersReport(const std::string& filename);
+
+  void writeRooflineReport(const std::string& filename);
+
+  void getVariantPairRows(KernelBase* kern,
+                          VariantID (*counterpart)(VariantID),
+                          std::vector<VariantPairRow>& rows) const;
+
+  bool haveTiledVariantRun() const;
+  void writeTilingReport(const std::string& filename);
+
+  bool haveFusedVariantRun() const;
+  void writeFusionReport(const std::string& filename);
+
+  bool haveRegionVariantRun() const;
+  void writeRegionReport(const std::string& filename);
+
+  bool haveNTStoreVariantRun() const;
+  void writeNTStoreReport(const std::string& filename);
+
+  void writeWarmupReport(const std::string& filename);
+
+  void writeDataPlacementReport(const std::string& filename);
+
+  void writeHugePageReport(const std::string& filename);
+
+  void runThreadSweep(size_t ik, size_t iv);
+  void writeThreadScalingReport(const std::string& filename);
+
+  void runScheduleSweep(size_t ik, size_t iv);
+  void writeScheduleReport(const std::string& filename);
+
+  void runPrefetchSweep(size_t ik, size_t iv);
+  void writePrefetchReport(const std::string& filename);
+
+  void runFIRSweep(size_t ik, size_t iv);
+  void writeFIRCoeffLenReport(const std::string& filename);
+
+  void runSizeSweep();
+  void writeSizeSweepReport(const std::string& filename);
+
+  void runPrecisionCompare();
+  void writePrecisionReport(const std::string& filename);
+
+  void runIndexWidthCompare();
+  void writeIndexWidthReport(const std::string& filename);
+
+  void writeTimingStatsReport(const std::string& filename);
+  void getSampleStats(const std::vector<double>& samples, 
+                      SampleStats& stats);
+
   void writeFOMReport(const std::string& filename);
   void getFOMGroups(std::vector<FOMGroup>& fom_groups);
   
@@ -84,6 +168,73 @@ private:
 
   VariantID reference_vid;
 
+  HWCounters hw_counters;
+
+  //
+  // Time per rep (sec.) summed over passes for each OpenMP thread count 
+  // sweep point, indexed as [kernel][variant][thread count].
+  //
+  std::vector< std::vector< std::vector<double> > > thread_sweep_time;
+
+  //
+  // Time per rep (sec.) summed over passes for each OpenMP schedule 
+  // sweep point, indexed as [kernel][variant][schedule].
+  //
+  std::vector< std::vector< std::vector<double> > > sched_sweep_time;
+
+  //
+  // Time per rep (sec.) summed over passes for each prefetch distance 
+  // sweep point, indexed as [kernel][variant][distance].
+  //
+  std::vector< std::vector< std::vector<double> > > prefetch_sweep_time;
+
+  //
+  // Time per rep (sec.) summed over passes for each FIR coefficient length 
+  // sweep point, indexed as [kernel][variant][length].
+  //
+  std::vector< std::vector< std::vector<double> > > fir_sweep_time;
+
+  //
+  // FLOPs per rep of FIR at each coefficient length sweep point, indexed
+  // as [kernel][length].
+  //
+  std::vector< std::vector<double> > fir_sweep_flops;
+
+  //
+  // Sampled data array pages on each NUMA node, summed over passes and
+  // indexed as [kernel][variant][node].
+  //
+  std::vector< std::vector< std::vector<long> > > data_page_counts;
+
+  //
+  // Data array page statistics from last execution of each kernel
+  // variant, indexed as [kernel][variant].
+  //
+  std::vector< std::vector<DataPageStats> > data_page_stats;
+
+  //
+  // Size sweep results, indexed as [kernel][size factor].
+  //
+  std::vector< std::vector<SizeSweepPoint> > size_sweep;
+
+  //
+  // Precision the suite was not built for, and mean time per rep (sec.)
+  // and checksum of each kernel variant run in that precision, indexed 
+  // as [kernel][variant].
+  //
+  PrecisionID compare_pid;
+  std::vector< std::vector<double> > prec_time;
+  std::vector< std::vector<Checksum_type> > prec_checksum;
+
+  //
+  // Index width the suite was not built for, and mean time per rep (sec.)
+  // and checksum of each kernel variant run with that width, indexed 
+  // as [kernel][variant].
+  //
+  IndexWidthID compare_iwid;
+  std::vector< std::vector<double> > index_time;
+  std::vector< std::vector<Checksum_type> > index_checksum;
+
 };
 
 }  // closing brace for rajaperf namespace
@@ -0,0 +1,185 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-738930
+//
+// All rights reserved.
+//
+// This file is part of the RAJA Performance Suite.
+//
+// For details about use and distribution, please read raja-perfsuite/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+#include "HWCounters.hpp"
+
+#include <iostream>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+namespace rajaperf
+{
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Array of names for each EventID in suite.
+ *
+ * IMPORTANT: This is only modified when an event is added or removed.
+ *
+ *            IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ENUM OF EVENT IDS IN HEADER FILE!!!
+ *
+ *******************************************************************************
+ */
+static const std::string EventNames [] =
+{
+
+  std::string("Cycles"),
+  std::string("Instructions"),
+  std::string("LLC Misses"),
+  std::string("Branch Misses"),
+  std::string("FP Ops"),
+
+  std::string("Unknown Event")  // Keep this at the end and DO NOT remove....
+
+}; // END EventNames
+
+
+HWCounters::HWCounters()
+  : is_open(false)
+{
+  for (int ie = 0; ie < NumEvents; ++ie) {
+    fd[ie] = -1;
+  }
+}
+
+HWCounters::~HWCounters()
+{
+  close();
+}
+
+const std::string& HWCounters::getEventName(EventID eid)
+{
+  return EventNames[eid];
+}
+
+
+#if defined(__linux__)
+
+static int openPerfEvent(unsigned int type, unsigned long long config)
+{
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = type;
+  attr.config = config;
+  attr.disabled = 0;
+  attr.inherit = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | 
+                     PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+  return static_cast<int>( 
+    syscall(__NR_perf_event_open, &attr, 0 /*this process*/, -1 /*any cpu*/,
+            -1 /*no group*/, 0) );
+}
+
+bool HWCounters::open(unsigned long long fp_event)
+{
+  close();
+
+  fd[Cycles] = openPerfEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+  fd[Instructions] = 
+    openPerfEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+  fd[LLCMisses] = 
+    openPerfEvent(PERF_TYPE_HW_CACHE, 
+                  PERF_COUNT_HW_CACHE_LL |
+                  (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                  (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+  if ( fd[LLCMisses] < 0 ) {
+    fd[LLCMisses] = 
+      openPerfEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+  }
+  fd[BranchMisses] = 
+    openPerfEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+  if ( fp_event != 0 ) {
+    fd[FPOps] = openPerfEvent(PERF_TYPE_RAW, fp_event);
+  }
+
+  for (int ie = 0; ie < NumEvents; ++ie) {
+    is_open = is_open || ( fd[ie] >= 0 );
+    if ( fd[ie] < 0 && (ie != FPOps || fp_event != 0) ) {
+      std::cout << "\n HWCounters: can't open event " 
+                << getEventName(static_cast<EventID>(ie)) 
+                << " (check /proc/sys/kernel/perf_event_paranoid)" 
+                << std::endl;
+    }
+  }
+
+  return is_open;
+}
+
+void HWCounters::close()
+{
+  for (int ie = 0; ie < NumEvents; ++ie) {
+    if ( fd[ie] >= 0 ) {
+      ::close(fd[ie]);
+      fd[ie] = -1;
+    }
+  }
+  is_open = false;
+}
+
+void HWCounters::read(Count_type counts[NumEvents]) const
+{
+  for (int ie = 0; ie < NumEvents; ++ie) {
+    counts[ie] = 0;
+    if ( fd[ie] >= 0 ) {
+      // value, time enabled, time running
+      unsigned long long buf[3] = {0, 0, 0};
+      if ( ::read(fd[ie], buf, sizeof(buf)) == sizeof(buf) ) {
+        if ( buf[2] > 0 && buf[2] < buf[1] ) {
+          counts[ie] = static_cast<Count_type>( 
+            static_cast<double>(buf[0]) * buf[1] / buf[2] );
+        } else {
+          counts[ie] = static_cast<Count_type>(buf[0]);
+        }
+      }
+    }
+  }
+}
+
+#else  // no perf_event_open support...
+
+bool HWCounters::open(unsigned long long fp_event)
+{
+  (void) fp_event;
+  std::cout << "\n HWCounters: not supported on this platform" << std::endl;
+  return false;
+}
+
+void HWCounters::close()
+{
+  is_open = false;
+}
+
+void HWCounters::read(Count_type counts[NumEvents]) const
+{
+  for (int ie = 0; ie < NumEvents; ++ie) {
+    counts[ie] = 0;
+  }
+}
+
+#endif
+
+}  // closing brace for rajaperf namespace
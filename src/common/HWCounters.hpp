@@ -0,0 +1,104 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-738930
+//
+// All rights reserved.
+//
+// This file is part of the RAJA Performance Suite.
+//
+// For details about use and distribution, please read raja-perfsuite/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Hardware performance counter support for timing regions of Suite kernels.
+///
+
+#ifndef RAJAPerf_HWCounters_HPP
+#define RAJAPerf_HWCounters_HPP
+
+#include <string>
+
+namespace rajaperf
+{
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Simple class that manages a fixed set of hardware performance
+ *        counters for the process.
+ *
+ * Counters are read via the Linux perf_event_open interface; on other 
+ * platforms, or if the kernel refuses to open an event (e.g., due to 
+ * perf_event_paranoid settings), the event is reported as not available.
+ *
+ * Counters are opened once, before any kernel is run, and left enabled. 
+ * They count for the calling thread and all threads it creates afterward 
+ * (e.g., OpenMP thread pool), so they must be opened before the first 
+ * parallel region is entered. Kernel timing regions are measured by 
+ * taking differences of counter reads.
+ *
+ * FP operations have no generic perf event; a raw, CPU-specific event 
+ * code must be provided to count them.
+ *
+ *******************************************************************************
+ */
+class HWCounters
+{
+public:
+
+  /*!
+   * \brief Enumeration of counted events.
+   */
+  enum EventID {
+    Cycles = 0,
+    Instructions,
+    LLCMisses,
+    BranchMisses,
+    FPOps,
+
+    NumEvents // Keep this one last and DO NOT remove (!!)
+  };
+
+  typedef long long Count_type;
+
+  HWCounters();
+
+  ~HWCounters();
+
+  /*!
+   * \brief Open counters for all events. 
+   *
+   * fp_event is raw event code for FP operations; 0 -> don't count them.
+   *
+   * Return true if at least one event could be opened.
+   */
+  bool open(unsigned long long fp_event);
+
+  void close();
+
+  bool isOpen() const { return is_open; }
+
+  bool isEventAvailable(EventID eid) const { return fd[eid] >= 0; }
+
+  /*!
+   * \brief Read current value of each event counter into counts array.
+   *
+   * Values are scaled if the kernel multiplexed events. Unavailable 
+   * events read as zero.
+   */
+  void read(Count_type counts[NumEvents]) const;
+
+  static const std::string& getEventName(EventID eid);
+
+private:
+  bool is_open;
+  int fd[NumEvents];
+};
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
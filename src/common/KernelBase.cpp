@@ -18,8 +18,10 @@
 
 #include "RunParams.hpp"
 #include "DataUtils.hpp"
+#include "OutputUtils.hpp"
 
 #include <cmath>
+#include <algorithm>
 
 namespace rajaperf {
 
@@ -27,17 +29,81 @@ KernelBase::KernelBase(KernelID kid, const RunParams& params)
   : run_params(params),
     kernel_id(kid),
     name( getFullKernelName(kernel_id) ),
+    exec_time(0.0),
+    hw_counters(0),
+    prefetch_distance( params.getPrefetchDistance() ),
     default_size(0),
     default_reps(0),
-    running_variant(NumVariants)
+    running_variant(NumVariants),
+    batch_reps(0),
+    probing(false),
+    warming_up(false),
+    calibrated_reps(0),
+    calibrated_sample_reps(0)
 {
   for (size_t ivar = 0; ivar < NumVariants; ++ivar) {
      num_exec[ivar] = 0;
      min_time[ivar] = std::numeric_limits<double>::max();
      max_time[ivar] = -std::numeric_limits<double>::max();
      tot_time[ivar] = 0.0;
+     warmup_time[ivar] = 0.0;
+     warmup_reps[ivar] = 0;
      checksum[ivar] = 0.0;
+     for (int ie = 0; ie < HWCounters::NumEvents; ++ie) {
+       counter_tot[ivar][ie] = 0;
+     }
+     has_variant_defined[ivar] = true;
   }
+  for (int ie = 0; ie < HWCounters::NumEvents; ++ie) {
+    counter_start[ie] = 0;
+  }
+
+  const std::vector<OpenMPSchedule>& omp_scheds = 
+    run_params.getOpenMPSchedules();
+  omp_schedule.kind = StaticSchedule;
+  omp_schedule.chunk = 0;
+  if ( !omp_scheds.empty() ) {
+    omp_schedule = omp_scheds[0];
+  }
+
+  //
+  // Variants below are implemented only by some kernels, which turn them 
+  // on with setVariantDefined() in their constructors.
+  //
+  has_variant_defined[Base_Seq_AoS] = false;
+  has_variant_defined[RAJA_Seq_AoS] = false;
+  has_variant_defined[Base_Seq_AoSoA] = false;
+  has_variant_defined[RAJA_Seq_AoSoA] = false;
+  has_variant_defined[Base_Seq_Tiled] = false;
+  has_variant_defined[RAJA_Seq_Tiled] = false;
+  has_variant_defined[Base_Seq_Fused] = false;
+  has_variant_defined[RAJA_Seq_Fused] = false;
+  has_variant_defined[Base_Seq_NTStore] = false;
+  has_variant_defined[RAJA_Seq_NTStore] = false;
+  has_variant_defined[Base_Seq_Prefetch] = false;
+  has_variant_defined[RAJA_Seq_Prefetch] = false;
+  has_variant_defined[Base_Seq_Blocked] = false;
+  has_variant_defined[RAJA_Seq_Blocked] = false;
+#if defined(RAJA_ENABLE_OPENMP)
+  has_variant_defined[Base_OpenMP_Simd] = false;
+  has_variant_defined[RAJA_OpenMP_Simd] = false;
+  has_variant_defined[Base_OpenMP_Sched] = false;
+  has_variant_defined[Base_OpenMP_Tiled] = false;
+  has_variant_defined[RAJA_OpenMP_Tiled] = false;
+  has_variant_defined[Base_OpenMP_Fused] = false;
+  has_variant_defined[RAJA_OpenMP_Fused] = false;
+  has_variant_defined[Base_OpenMP_Region] = false;
+  has_variant_defined[RAJA_OpenMP_Region] = false;
+  has_variant_defined[Base_OpenMP_NTStore] = false;
+  has_variant_defined[RAJA_OpenMP_NTStore] = false;
+  has_variant_defined[Base_OpenMP_Prefetch] = false;
+  has_variant_defined[RAJA_OpenMP_Prefetch] = false;
+  has_variant_defined[Base_OpenMP_Blocked] = false;
+  has_variant_defined[RAJA_OpenMP_Blocked] = false;
+#endif
+#if defined(RAJAPERF_ENABLE_STDPAR)
+  has_variant_defined[Base_StdPar] = false;
+#endif
 }
 
  
@@ -55,6 +121,8 @@ Index_type KernelBase::getRunReps() const
 { 
   if (run_params.getInputState() == RunParams::CheckRun) {
     return static_cast<Index_type>(run_params.getCheckRunReps());
+  } else if (calibrated_reps > 0) {
+    return calibrated_reps;
   } else {
     return static_cast<Index_type>(default_reps*run_params.getRepFactor()); 
   } 
@@ -63,14 +131,104 @@ Index_type KernelBase::getRunReps() const
 
 void KernelBase::execute(VariantID vid) 
 {
+  if ( !has_variant_defined[vid] ) {
+    return;
+  }
+
   running_variant = vid;
 
-  resetTimer();
+  Index_type run_reps = getRunReps();
+  Index_type sample_reps = run_params.getRepsPerSample();
+
+  //
+  // With a target run time, first variant executed calibrates reps for
+  // the kernel: a probe estimates time per rep, which sets the max # reps
+  // and sample size, and the run stops early when the mean time per rep 
+  // converges. Later variants run the same reps and samples.
+  //
+  bool calibrate = false;
+  const double target_time = run_params.getTargetTime();
+  if ( target_time > 0.0 && 
+       run_params.getInputState() != RunParams::CheckRun ) {
+
+    if ( calibrated_reps == 0 ) {
+      const double rep_time = probeTimePerRep(vid);
+      const int target_nsamples = 20;
+
+      run_reps = static_cast<Index_type>( target_time / rep_time );
+      run_reps = std::max(run_reps, static_cast<Index_type>(1));
+      if ( sample_reps <= 0 ) {
+        sample_reps = std::max(run_reps / target_nsamples, 
+                               static_cast<Index_type>(1));
+      }
+      calibrate = true;
+    } else {
+      sample_reps = calibrated_sample_reps;
+    }
+
+  }
+
+  //
+  // Split reps into timing samples; runKernel() is called once per sample.
+  // Sample buffer is sized before any timing is done.
+  //
+  if ( sample_reps <= 0 || sample_reps > run_reps ) {
+    sample_reps = run_reps;
+  }
+  const Index_type nsamples = 
+    ( sample_reps > 0 ? (run_reps + sample_reps - 1) / sample_reps : 1 );
+  const size_t first_sample = time_samples[vid].size();
+  time_samples[vid].reserve( first_sample + nsamples );
 
   resetDataInitCount();
   this->setUp(vid);
-  
-  this->runKernel(vid); 
+
+  //
+  // Untimed warmup reps absorb cold caches, thread startup, etc. before
+  // timed reps are run; their time is recorded separately.
+  //
+  const Index_type nwarmup = run_params.getWarmupReps();
+  if ( nwarmup > 0 ) {
+    warming_up = true;
+    batch_reps = nwarmup;
+
+    resetTimer();
+    this->runKernel(vid);
+    warmup_reps[vid] += nwarmup;
+
+    batch_reps = 0;
+    warming_up = false;
+  }
+
+  exec_time = 0.0;
+
+  Index_type reps_done = 0;
+  for (Index_type is = 0; is < nsamples; ++is) {
+    batch_reps = std::min(sample_reps, run_reps - reps_done);
+
+    resetTimer();
+    this->runKernel(vid); 
+
+    reps_done += batch_reps;
+
+    if ( calibrate && timingConverged(vid, first_sample) ) {
+      break;
+    }
+  }
+  batch_reps = 0;
+
+  //
+  // Execution counts and min/max times are per execution of the variant, 
+  // not per timing sample.
+  //
+  num_exec[vid]++;
+  min_time[vid] = std::min(min_time[vid], exec_time);
+  max_time[vid] = std::max(max_time[vid], exec_time);
+
+  if ( calibrate ) {
+    calibrated_reps = reps_done;
+    calibrated_sample_reps = sample_reps;
+  }
 
   this->updateChecksum(vid); 
 
@@ -79,14 +237,139 @@ void KernelBase::execute(VariantID vid)
   running_variant = NumVariants; 
 }
 
+double KernelBase::executeSweep(VariantID vid)
+{
+  const int saved_num_exec = num_exec[vid];
+  const RAJA::Timer::ElapsedType saved_min_time = min_time[vid];
+  const RAJA::Timer::ElapsedType saved_max_time = max_time[vid];
+  const RAJA::Timer::ElapsedType saved_tot_time = tot_time[vid];
+  const size_t saved_nsamples = time_samples[vid].size();
+  const Checksum_type saved_checksum = checksum[vid];
+  const RAJA::Timer::ElapsedType saved_warmup_time = warmup_time[vid];
+  const Index_type saved_warmup_reps = warmup_reps[vid];
+  HWCounters::Count_type saved_counter_tot[HWCounters::NumEvents];
+  std::copy(counter_tot[vid], counter_tot[vid] + HWCounters::NumEvents,
+            saved_counter_tot);
+
+  execute(vid);
+
+  const Index_type run_reps = getRunReps();
+  const double time = ( run_reps > 0 ? 
+                        (tot_time[vid] - saved_tot_time) / run_reps : 0.0 );
+
+  num_exec[vid] = saved_num_exec;
+  min_time[vid] = saved_min_time;
+  max_time[vid] = saved_max_time;
+  tot_time[vid] = saved_tot_time;
+  time_samples[vid].resize(saved_nsamples);
+  checksum[vid] = saved_checksum;
+  warmup_time[vid] = saved_warmup_time;
+  warmup_reps[vid] = saved_warmup_reps;
+  std::copy(saved_counter_tot, saved_counter_tot + HWCounters::NumEvents,
+            counter_tot[vid]);
+
+  return time;
+}
+
+double KernelBase::probeTimePerRep(VariantID vid)
+{
+  //
+  // Double # reps in probe batch until it runs long enough to time 
+  // reliably (or exceeds target time). Probe runs are not recorded.
+  //
+  const double min_probe_time = 
+    std::min(1.0e-3, 0.1 * run_params.getTargetTime());
+  const Index_type max_probe_reps = 1 << 20;
+
+  resetDataInitCount();
+  this->setUp(vid);
+
+  probing = true;
+
+  Index_type probe_reps = 1;
+  double probe_time = 0.0;
+  while ( true ) {
+    batch_reps = probe_reps;
+
+    resetTimer();
+    this->runKernel(vid);
+    probe_time = timer.elapsed();
+
+    if ( probe_time >= min_probe_time || probe_reps >= max_probe_reps ) {
+      break;
+    }
+    probe_reps *= 2;
+  }
+  batch_reps = 0;
+
+  probing = false;
+
+  this->tearDown(vid);
+
+  return std::max(probe_time / probe_reps, 1.0e-9);
+}
+
+bool KernelBase::timingConverged(VariantID vid, size_t first_sample) const
+{
+  const size_t min_nsamples = 5;
+
+  const std::vector<double>& samples = time_samples[vid];
+  if ( samples.size() < first_sample + min_nsamples ) {
+    return false;
+  }
+  const size_t n = samples.size() - first_sample;
+
+  double sum = 0.0;
+  for (size_t i = first_sample; i < samples.size(); ++i) {
+    sum += samples[i];
+  }
+  const double mean = sum / n;
+
+  double sumsq = 0.0;
+  for (size_t i = first_sample; i < samples.size(); ++i) {
+    sumsq += (samples[i] - mean) * (samples[i] - mean);
+  }
+  const double stddev = std::sqrt( sumsq / (n - 1) );
+
+  const double half_width = 
+    getStudentT95(n - 1) * stddev / std::sqrt( static_cast<double>(n) );
+
+  return ( mean > 0.0 && 
+           half_width <= run_params.getTargetRelErr() * mean );
+}
+
 void KernelBase::recordExecTime()
 {
-  num_exec[running_variant]++;
+  if ( probing ) {
+    return;
+  }
+
+  if ( warming_up ) {
+    warmup_time[running_variant] += timer.elapsed();
+    return;
+  }
+
+  RAJA::Timer::ElapsedType sample_time = timer.elapsed();
+  exec_time += sample_time;
+  tot_time[running_variant] += sample_time;
+
+  if ( batch_reps > 0 ) {
+    time_samples[running_variant].push_back(sample_time / batch_reps);
+  }
+}
+
+void KernelBase::recordCounters()
+{
+  if ( probing || warming_up ) {
+    return;
+  }
 
-  RAJA::Timer::ElapsedType exec_time = timer.elapsed();
-  min_time[running_variant] = std::min(min_time[running_variant], exec_time);
-  max_time[running_variant] = std::max(min_time[running_variant], exec_time);
-  tot_time[running_variant] += exec_time;
+  HWCounters::Count_type counter_stop[HWCounters::NumEvents];
+  hw_counters->read(counter_stop);
+
+  for (int ie = 0; ie < HWCounters::NumEvents; ++ie) {
+    counter_tot[running_variant][ie] += counter_stop[ie] - counter_start[ie];
+  }
 }
 
 void KernelBase::print(std::ostream& os) const
@@ -95,15 +378,17 @@ void KernelBase::print(std::ostream& os) const
   os << "\t\t name(id) = " << name << "(" << kernel_id << ")" << std::endl;
   os << "\t\t\t default_size = " << default_size << std::endl;
   os << "\t\t\t default_reps = " << default_reps << std::endl;
+  os << "\t\t\t bytes_per_rep = " << getBytesPerRep() << std::endl;
+  os << "\t\t\t flops_per_rep = " << getFLOPsPerRep() << std::endl;
   os << "\t\t\t num_exec: " << std::endl;
   for (unsigned j = 0; j < NumVariants; ++j) {
     os << "\t\t\t\t" << num_exec[j] << std::endl; 
   }
-  os << "\t\t\t min_time: " << std::endl;
+  os << "\t\t\t min_time (per execution): " << std::endl;
   for (unsigned j = 0; j < NumVariants; ++j) {
     os << "\t\t\t\t" << min_time[j] << std::endl; 
   }
-  os << "\t\t\t max_time: " << std::endl;
+  os << "\t\t\t max_time (per execution): " << std::endl;
   for (unsigned j = 0; j < NumVariants; ++j) {
     os << "\t\t\t\t" << max_time[j] << std::endl; 
   }
@@ -111,6 +396,10 @@ void KernelBase::print(std::ostream& os) const
   for (unsigned j = 0; j < NumVariants; ++j) {
     os << "\t\t\t\t" << tot_time[j] << std::endl; 
   }
+  os << "\t\t\t num time samples: " << std::endl;
+  for (unsigned j = 0; j < NumVariants; ++j) {
+    os << "\t\t\t\t" << time_samples[j].size() << std::endl; 
+  }
   os << "\t\t\t checksum: " << std::endl;
   for (unsigned j = 0; j < NumVariants; ++j) {
     os << "\t\t\t\t" << checksum[j] << std::endl; 
@@ -21,9 +21,17 @@
 #include "common/RPTypes.hpp"
 #include "common/DataUtils.hpp"
 #include "common/RunParams.hpp"
+#include "common/HWCounters.hpp"
+#include "common/ThreadPool.hpp"
 
 #include "RAJA/util/Timer.hpp"
 
+#if defined(RAJA_ENABLE_TBB)
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+#include "tbb/parallel_reduce.h"
+#endif
+
 //
 // Eventually, to be deprecated 'forallN' versions of nested loops are on by 
 // default for some PM backends since the new RAJA::nested::forall interface 
@@ -32,10 +40,30 @@
 //
 //#define USE_FORALLN_FOR_SEQ
 //#define USE_FORALLN_FOR_OPENMP
+//#define USE_FORALLN_FOR_TBB
 #define USE_FORALLN_FOR_CUDA
 #define USE_FORALLN_FOR_OPENMPTARGET
 
+//
+// Kernel classes are class templates on their Real_type and Index_type, 
+// defined in their implementation files. This goes at the end of each 
+// implementation file to instantiate the kernel class for each precision
+// and index width the suite can run. Precisions and index widths are 
+// compared one at a time, so the other width is only needed with the 
+// default precision.
+//
+#if defined(RP_USE_MIXED_TYPES)
+#define RAJAPERF_INSTANTIATE_KERNEL(KERNEL) \
+  template class KERNEL<double, Index_type>; \
+  template class KERNEL<float, Index_type>; \
+  template class KERNEL<Real_type, AltIndex_type>
+#else
+#define RAJAPERF_INSTANTIATE_KERNEL(KERNEL) \
+  template class KERNEL<Real_type, Index_type>
+#endif
+
 #include <string>
+#include <vector>
 #include <iostream>
 
 namespace rajaperf {
@@ -66,20 +94,124 @@ public:
   void setDefaultSize(Index_type size) { default_size = size; }
   void setDefaultReps(Index_type reps) { default_reps = reps; }
 
+  /*!
+   * \brief Mark variant as implemented by kernel. 
+   *
+   * Most variants are implemented by all kernels; see KernelBase 
+   * constructor for those that kernels must turn on. execute() does
+   * nothing for a variant that is not defined.
+   */
+  void setVariantDefined(VariantID vid) { has_variant_defined[vid] = true; }
+  bool hasVariantDefined(VariantID vid) const 
+    { return has_variant_defined[vid]; }
+
   Index_type getRunSize() const;
+
+  /*!
+   * \brief Return number of reps to run for each variant.
+   *
+   * When a target run time is given (see RunParams::getTargetTime()), this 
+   * is the number of reps chosen by the calibration run of the first 
+   * variant executed, so all variants run the same number of reps.
+   */
   Index_type getRunReps() const;
 
+  /*!
+   * \brief Return number of reps to run in current call to runKernel().
+   *
+   * execute() splits the reps of each variant run into timing samples
+   * (see RunParams::getRepsPerSample()) and calls runKernel() once for 
+   * each sample.
+   */
+  Index_type getBatchReps() const { return batch_reps; }
+
   bool wasVariantRun(VariantID vid) const 
     { return num_exec[vid] > 0; }
 
+  /*!
+   * \brief Return min and max time (sec.) of all reps of one execution 
+   *        of given variant, over its executions, and total time of all 
+   *        executions. A variant execution is timed as the sum of its 
+   *        timing samples (see getTimeSamples()).
+   */
   double getMinTime(VariantID vid) const { return min_time[vid]; }
   double getMaxTime(VariantID vid) const { return max_time[vid]; }
   double getTotTime(VariantID vid) { return tot_time[vid]; }
+
+  /*!
+   * \brief Return time per rep (sec.) of each timing sample recorded 
+   *        for given variant, in the order they were recorded.
+   */
+  const std::vector<double>& getTimeSamples(VariantID vid) const 
+    { return time_samples[vid]; }
+
+  /*!
+   * \brief Return total time (sec.) and # reps of untimed warmup runs 
+   *        of given variant (see RunParams::getWarmupReps()).
+   */
+  double getWarmupTime(VariantID vid) const { return warmup_time[vid]; }
+  Index_type getWarmupReps(VariantID vid) const { return warmup_reps[vid]; }
+
   Checksum_type getChecksum(VariantID vid) const { return checksum[vid]; }
 
+  /*!
+   * \brief Return total hardware counter value for given variant and event
+   *        over all timed regions.
+   */
+  HWCounters::Count_type getCounterTotal(VariantID vid, 
+                                         HWCounters::EventID eid) const
+    { return counter_tot[vid][eid]; }
+
+  /*!
+   * \brief Set counters read at start and stop of each timed region
+   *        (null pointer -> counters not used).
+   */
+  void setHWCounters(const HWCounters* counters) { hw_counters = counters; }
+
+  /*!
+   * \brief Set and get loop schedule that Base_OpenMP_Sched variants run 
+   *        with.
+   *
+   * Default is first schedule in the schedule sweep, or static if there 
+   * is no sweep (see RunParams::getOpenMPSchedules()). Executor sets 
+   * others to rerun variants for the sweep.
+   */
+  void setOpenMPSchedule(const OpenMPSchedule& sched) 
+    { omp_schedule = sched; }
+  const OpenMPSchedule& getOpenMPSchedule() const { return omp_schedule; }
+
+  /*!
+   * \brief Set and get prefetch distance, in loop iterations, that 
+   *        *_Prefetch variants run with; 0 -> no prefetch.
+   *
+   * Default is RunParams::getPrefetchDistance(). Executor sets others to 
+   * rerun variants for the prefetch distance sweep.
+   */
+  void setPrefetchDistance(int dist) { prefetch_distance = dist; }
+  int getPrefetchDistance() const { return prefetch_distance; }
+
   void execute(VariantID vid);
-  void startTimer() { timer.start(); }
-  void stopTimer()  { timer.stop(); recordExecTime(); }
+
+  /*!
+   * \brief Execute variant as in execute(), but leave the timing, sample, 
+   *        counter, and checksum data for the variant unchanged. 
+   *
+   * Used to rerun a variant under a different configuration for a sweep
+   * report. Returns mean time per rep (sec.) of the run.
+   */
+  double executeSweep(VariantID vid);
+
+  void startTimer() 
+  { 
+    if ( hw_counters ) { hw_counters->read(counter_start); }
+    timer.start(); 
+  }
+  void stopTimer()  
+  { 
+    timer.stop(); 
+    if ( hw_counters ) { recordCounters(); }
+    recordExecTime(); 
+  }
   void resetTimer() { timer.reset(); }
 
   //
@@ -89,6 +221,44 @@ public:
 
   virtual Index_type getItsPerRep() const { return getRunSize(); }
 
+  /*!
+   * \brief Return analytic model of bytes of memory read and written 
+   *        and floating point operations executed in one kernel rep.
+   *
+   * Bytes count each array element read and each element written once 
+   * per rep (i.e., perfect cache reuse within a rep). Add, subtract, 
+   * multiply, divide, sqrt, and exp each count as one operation. A kernel 
+   * that does not provide a model returns zero for both.
+   */
+  virtual double getBytesPerRep() const { return 0.0; }
+  virtual double getFLOPsPerRep() const { return 0.0; }
+
+  /*!
+   * \brief Return bytes model of one rep of fused variants (e.g., 
+   *        Base_Seq_Fused), which merge loops of a kernel so arrays that 
+   *        are used in several loops are read or written once per rep.
+   *
+   * getBytesPerRep() models the unfused loops. Default is the same.
+   */
+  virtual double getFusedBytesPerRep() const { return getBytesPerRep(); }
+
+  /*!
+   * \brief Return number of parallel loops in one rep of a kernel. 
+   *
+   * Used to model fork/join cost of OpenMP variants that start a parallel 
+   * region for each loop. Default is one loop.
+   */
+  virtual int getLoopsPerRep() const { return 1; }
+
+  /*!
+   * \brief Return bytes of output arrays written in one rep, which 
+   *        regular stores also read for ownership (RFO) and streaming 
+   *        stores of *_NTStore variants do not.
+   *
+   * Zero (default) means not modeled.
+   */
+  virtual double getBytesWrittenPerRep() const { return 0.0; }
+
   virtual void print(std::ostream& os) const; 
 
   virtual void setUp(VariantID vid) = 0;
@@ -105,6 +275,13 @@ protected:
   RAJA::Timer::ElapsedType max_time[NumVariants];
   RAJA::Timer::ElapsedType tot_time[NumVariants];
 
+  std::vector<double> time_samples[NumVariants];
+
+  RAJA::Timer::ElapsedType warmup_time[NumVariants];
+  Index_type warmup_reps[NumVariants];
+
+  HWCounters::Count_type counter_tot[NumVariants][HWCounters::NumEvents];
+
   Checksum_type checksum[NumVariants];
 
 
@@ -112,16 +289,39 @@ private:
   KernelBase() = delete;
 
   void recordExecTime(); 
+  void recordCounters(); 
+
+  double probeTimePerRep(VariantID vid);
+  bool timingConverged(VariantID vid, size_t first_sample) const;
 
   KernelID    kernel_id;
   std::string name;
 
   RAJA::Timer timer;
 
+  RAJA::Timer::ElapsedType exec_time;  /*!< time of samples of current 
+                                            execution of a variant */
+
+  const HWCounters* hw_counters;
+  HWCounters::Count_type counter_start[HWCounters::NumEvents];
+
+  OpenMPSchedule omp_schedule;
+
+  int prefetch_distance;
+
   Index_type default_size;
   Index_type default_reps;
 
+  bool has_variant_defined[NumVariants];
+
   VariantID running_variant; 
+  Index_type batch_reps;
+
+  bool probing;                       /*!< true -> timed regions not recorded */
+  bool warming_up;                    /*!< true -> timed regions recorded 
+                                           as warmup time */
+  Index_type calibrated_reps;         /*!< 0 -> reps not calibrated (yet) */
+  Index_type calibrated_sample_reps;
 };
 
 }  // closing brace for rajaperf namespace
@@ -135,4 +135,23 @@ std::string recursiveMkdir(const std::string& in_path)
   return outpath;
 }
 
+/*
+ * Two-sided 95% Student-t critical value for given degrees of freedom.
+ */
+double getStudentT95(size_t dof)
+{
+  static const double t95[] = { 12.706, 4.303, 3.182, 2.776, 2.571, 
+                                 2.447, 2.365, 2.306, 2.262, 2.228,
+                                 2.201, 2.179, 2.160, 2.145, 2.131,
+                                 2.120, 2.110, 2.101, 2.093, 2.086,
+                                 2.080, 2.074, 2.069, 2.064, 2.060,
+                                 2.056, 2.052, 2.048, 2.045, 2.042 };
+  const size_t nt95 = sizeof(t95) / sizeof(t95[0]);
+
+  if ( dof == 0 ) {
+    return 0.0;
+  }
+  return ( dof <= nt95 ? t95[dof - 1] : 1.960 );
+}
+
 }  // closing brace for rajaperf namespace
@@ -21,6 +21,7 @@
 #define RAJAPerf_OutputUtils_HPP
 
 #include <string>
+#include <cstddef>
 
 namespace rajaperf
 {
@@ -33,6 +34,12 @@ namespace rajaperf
  */
 std::string recursiveMkdir(const std::string& in_path);
 
+/*!
+ * \brief Return two-sided 95% Student-t critical value for given number
+ * of degrees of freedom (normal approximation used for large values).
+ */
+double getStudentT95(size_t dof);
+
 }  // closing brace for rajaperf namespace
 
 #endif  // closing endif for header file include guard
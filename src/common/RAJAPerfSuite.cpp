@@ -69,7 +69,13 @@
 #include "apps/WIP-COUPLE.hpp"
 
 
+#include <cstdlib>
 #include <iostream>
+#include <sstream>
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
 
 namespace rajaperf
 {
@@ -190,10 +196,62 @@ static const std::string VariantNames [] =
   std::string("Base_Seq"),
   std::string("RAJA_Seq"),
 
+  std::string("Base_Simd"),
+  std::string("RAJA_Simd"),
+
+  std::string("Base_Seq_AoS"),
+  std::string("RAJA_Seq_AoS"),
+  std::string("Base_Seq_AoSoA"),
+  std::string("RAJA_Seq_AoSoA"),
+
+  std::string("Base_Seq_Tiled"),
+  std::string("RAJA_Seq_Tiled"),
+
+  std::string("Base_Seq_Fused"),
+  std::string("RAJA_Seq_Fused"),
+
+  std::string("Base_Seq_NTStore"),
+  std::string("RAJA_Seq_NTStore"),
+
+  std::string("Base_Seq_Prefetch"),
+  std::string("RAJA_Seq_Prefetch"),
+
+  std::string("Base_Seq_Blocked"),
+  std::string("RAJA_Seq_Blocked"),
+
+  std::string("Base_ThreadPool"),
+
+#if defined(RAJAPERF_ENABLE_STDPAR)
+  std::string("Base_StdPar"),
+#endif
+
 #if defined(RAJA_ENABLE_OPENMP)
   std::string("Base_OpenMP"),
   std::string("RAJA_OpenMP"),
 
+  std::string("Base_OpenMP_Simd"),
+  std::string("RAJA_OpenMP_Simd"),
+
+  std::string("Base_OpenMP_Sched"),
+
+  std::string("Base_OpenMP_Tiled"),
+  std::string("RAJA_OpenMP_Tiled"),
+
+  std::string("Base_OpenMP_Fused"),
+  std::string("RAJA_OpenMP_Fused"),
+
+  std::string("Base_OpenMP_Region"),
+  std::string("RAJA_OpenMP_Region"),
+
+  std::string("Base_OpenMP_NTStore"),
+  std::string("RAJA_OpenMP_NTStore"),
+
+  std::string("Base_OpenMP_Prefetch"),
+  std::string("RAJA_OpenMP_Prefetch"),
+
+  std::string("Base_OpenMP_Blocked"),
+  std::string("RAJA_OpenMP_Blocked"),
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)  
   std::string("Base_OpenMPTarget"),
   std::string("RAJA_OpenMPTarget"),
@@ -201,6 +259,11 @@ static const std::string VariantNames [] =
 
 #endif
 
+#if defined(RAJA_ENABLE_TBB)
+  std::string("Base_TBB"),
+  std::string("RAJA_TBB"),
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
   std::string("Base_CUDA"),
   std::string("RAJA_CUDA"),
@@ -267,12 +330,309 @@ const std::string& getVariantName(VariantID vid)
 /*
  *******************************************************************************
  *
- * \brief Construct and return kernel object for given KernelID enum value.
+ * \brief Return true if variant runs on host using OpenMP threads.
  *
  *******************************************************************************
  */
-KernelBase* getKernelObject(KernelID kid,
-                            const RunParams& run_params)
+bool isOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP)
+  return ( vid == Base_OpenMP || vid == RAJA_OpenMP ||
+           vid == Base_OpenMP_Simd || vid == RAJA_OpenMP_Simd ||
+           vid == Base_OpenMP_Sched ||
+           vid == Base_OpenMP_Tiled || vid == RAJA_OpenMP_Tiled ||
+           vid == Base_OpenMP_Fused || vid == RAJA_OpenMP_Fused ||
+           vid == Base_OpenMP_Region || vid == RAJA_OpenMP_Region ||
+           vid == Base_OpenMP_NTStore || vid == RAJA_OpenMP_NTStore ||
+           vid == Base_OpenMP_Prefetch || vid == RAJA_OpenMP_Prefetch ||
+           vid == Base_OpenMP_Blocked || vid == RAJA_OpenMP_Blocked );
+#else
+  (void) vid;
+  return false;
+#endif
+}
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Array of names for each OpenMP schedule kind.
+ *
+ * IMPORTANT: This is only modified when a schedule kind is added or removed.
+ *
+ *            IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ENUM OF SCHEDULE KINDS IN HEADER FILE!!!
+ *
+ *******************************************************************************
+ */
+static const std::string OpenMPScheduleKindNames [] =
+{
+
+  std::string("static"),
+  std::string("dynamic"),
+  std::string("guided"),
+  std::string("taskloop"),
+
+  std::string("Unknown Schedule")  // Keep this at the end and DO NOT remove....
+
+}; // END OpenMPScheduleKindNames
+
+/*
+ *******************************************************************************
+ *
+ * \brief Return name of OpenMP schedule.
+ *
+ *******************************************************************************
+ */
+std::string getOpenMPScheduleName(const OpenMPSchedule& sched)
+{
+  std::string name(OpenMPScheduleKindNames[sched.kind]);
+  if ( sched.chunk > 0 ) {
+    std::ostringstream chunk;
+    chunk << sched.chunk;
+    name += "," + chunk.str();
+  }
+  return name;
+}
+
+/*
+ *******************************************************************************
+ *
+ * \brief Parse OpenMP schedule from its name.
+ *
+ *******************************************************************************
+ */
+bool parseOpenMPSchedule(const std::string& name, OpenMPSchedule& sched)
+{
+  const std::string::size_type pos = name.find(',');
+  const std::string kind_name = name.substr(0, pos);
+
+  sched.kind = NumOpenMPScheduleKinds;
+  for (int ik = 0; ik < NumOpenMPScheduleKinds; ++ik) {
+    if ( kind_name == OpenMPScheduleKindNames[ik] ) {
+      sched.kind = static_cast<OpenMPScheduleKind>(ik);
+    }
+  }
+
+  sched.chunk = 0;
+  if ( pos != std::string::npos ) {
+    sched.chunk = ::atoi( name.substr(pos+1).c_str() );
+    if ( sched.chunk <= 0 ) {
+      return false;
+    }
+  }
+
+  return ( sched.kind != NumOpenMPScheduleKinds );
+}
+
+/*
+ *******************************************************************************
+ *
+ * \brief Set OpenMP runtime schedule.
+ *
+ *******************************************************************************
+ */
+void setOpenMPRuntimeSchedule(const OpenMPSchedule& sched)
+{
+#if defined(RAJA_ENABLE_OPENMP)
+  switch ( sched.kind ) {
+    case DynamicSchedule : {
+      omp_set_schedule(omp_sched_dynamic, sched.chunk);
+      break;
+    }
+    case GuidedSchedule : {
+      omp_set_schedule(omp_sched_guided, sched.chunk);
+      break;
+    }
+    default : {
+      omp_set_schedule(omp_sched_static, sched.chunk);
+    }
+  }
+#else
+  (void) sched;
+#endif
+}
+
+/*
+ *******************************************************************************
+ *
+ * \brief Return taskloop grainsize for loop of given length.
+ *
+ *******************************************************************************
+ */
+int getTaskloopGrainsize(const OpenMPSchedule& sched, long long len)
+{
+  if ( sched.chunk > 0 ) {
+    return sched.chunk;
+  }
+  int nthreads = 1;
+#if defined(RAJA_ENABLE_OPENMP)
+  nthreads = omp_get_max_threads();
+#endif
+  const long long grain = len / (4 * nthreads);
+  return static_cast<int>( grain > 0 ? grain : 1 );
+}
+
+/*
+ *******************************************************************************
+ *
+ * \brief Check coefficient length for FIR kernel variants.
+ *
+ *******************************************************************************
+ */
+bool isFIRCoeffLenSupported(int len)
+{
+  for (int il = 0; il < NumFIRCoeffLens; ++il) {
+    if ( FIRCoeffLens[il] == len ) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Array of names for each floating point precision.
+ *
+ * IMPORTANT: This is only modified when a precision is added or removed.
+ *
+ *            IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ENUM OF PRECISION IDS IN HEADER FILE!!!
+ *
+ *******************************************************************************
+ */
+static const std::string PrecisionNames [] =
+{
+
+  std::string("double"),
+  std::string("float"),
+
+  std::string("Unknown Precision")  // Keep this at the end and DO NOT remove....
+
+}; // END PrecisionNames
+
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Array of names for each loop index width.
+ *
+ * IMPORTANT: This is only modified when an index width is added or removed.
+ *
+ *            IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ENUM OF INDEX WIDTH IDS IN HEADER FILE!!!
+ *
+ *******************************************************************************
+ */
+static const std::string IndexWidthNames [] =
+{
+
+  std::string("32-bit"),
+  std::string("64-bit"),
+
+  std::string("Unknown Index Width")  // Keep this at the end and DO NOT remove....
+
+}; // END IndexWidthNames
+
+/*
+ *******************************************************************************
+ *
+ * \brief Return name of precision associated with PrecisionID enum value.
+ *
+ *******************************************************************************
+ */
+const std::string& getPrecisionName(PrecisionID pid)
+{
+  return PrecisionNames[pid];
+}
+
+/*
+ *******************************************************************************
+ *
+ * \brief Return precision of Real_type.
+ *
+ *******************************************************************************
+ */
+PrecisionID getDefaultPrecision()
+{
+#if defined(RP_USE_FLOAT)
+  return FloatPrecision;
+#else
+  return DoublePrecision;
+#endif
+}
+
+/*
+ *******************************************************************************
+ *
+ * \brief Return true if kernel objects can be created with given precision.
+ *
+ *******************************************************************************
+ */
+bool isPrecisionAvailable(PrecisionID pid)
+{
+#if defined(RP_USE_MIXED_TYPES)
+  return ( pid == DoublePrecision || pid == FloatPrecision );
+#else
+  return ( pid == getDefaultPrecision() );
+#endif
+}
+
+/*
+ *******************************************************************************
+ *
+ * \brief Return name of index width associated with IndexWidthID enum value.
+ *
+ *******************************************************************************
+ */
+const std::string& getIndexWidthName(IndexWidthID iwid)
+{
+  return IndexWidthNames[iwid];
+}
+
+/*
+ *******************************************************************************
+ *
+ * \brief Return width of Index_type.
+ *
+ *******************************************************************************
+ */
+IndexWidthID getDefaultIndexWidth()
+{
+#if defined(RP_USE_INDEX64)
+  return Index64;
+#else
+  return Index32;
+#endif
+}
+
+/*
+ *******************************************************************************
+ *
+ * \brief Return true if kernel objects can be created with given index width.
+ *
+ *******************************************************************************
+ */
+bool isIndexWidthAvailable(IndexWidthID iwid)
+{
+#if defined(RP_USE_MIXED_TYPES)
+  return ( iwid == Index32 || iwid == Index64 );
+#else
+  return ( iwid == getDefaultIndexWidth() );
+#endif
+}
+
+/*
+ *******************************************************************************
+ *
+ * \brief Construct and return kernel object for given KernelID enum value
+ *        with Real_type REAL and Index_type INDEX.
+ *
+ *******************************************************************************
+ */
+template <typename REAL, typename INDEX>
+static KernelBase* makeKernelObject(KernelID kid,
+                                    const RunParams& run_params)
 {
   KernelBase* kernel = 0;
 
@@ -282,35 +642,35 @@ KernelBase* getKernelObject(KernelID kid,
     // Basic kernels...
     //
     case Basic_MULADDSUB : {
-       kernel = new basic::MULADDSUB(run_params);
+       kernel = new basic::MULADDSUB<REAL, INDEX>(run_params);
        break;
     }
     case Basic_IF_QUAD : {
-       kernel = new basic::IF_QUAD(run_params);
+       kernel = new basic::IF_QUAD<REAL, INDEX>(run_params);
        break;
     }
     case Basic_TRAP_INT : {
-       kernel = new basic::TRAP_INT(run_params);
+       kernel = new basic::TRAP_INT<REAL, INDEX>(run_params);
        break;
     }
     case Basic_INIT3 : {
-       kernel = new basic::INIT3(run_params);
+       kernel = new basic::INIT3<REAL, INDEX>(run_params);
        break;
     }
     case Basic_REDUCE3_INT : {
-       kernel = new basic::REDUCE3_INT(run_params);
+       kernel = new basic::REDUCE3_INT<REAL, INDEX>(run_params);
        break;
     }
     case Basic_NESTED_INIT : {
-       kernel = new basic::NESTED_INIT(run_params);
+       kernel = new basic::NESTED_INIT<REAL, INDEX>(run_params);
        break;
     }
     case Basic_INIT_VIEW1D : {
-       kernel = new basic::INIT_VIEW1D(run_params);
+       kernel = new basic::INIT_VIEW1D<REAL, INDEX>(run_params);
        break;
     }
     case Basic_INIT_VIEW1D_OFFSET : {
-       kernel = new basic::INIT_VIEW1D_OFFSET(run_params);
+       kernel = new basic::INIT_VIEW1D_OFFSET<REAL, INDEX>(run_params);
        break;
     }
 
@@ -318,27 +678,27 @@ KernelBase* getKernelObject(KernelID kid,
 // Lcals kernels...
 //
     case Lcals_HYDRO_1D : {
-       kernel = new lcals::HYDRO_1D(run_params);
+       kernel = new lcals::HYDRO_1D<REAL, INDEX>(run_params);
        break;
     }
     case Lcals_EOS : {
-       kernel = new lcals::EOS(run_params);
+       kernel = new lcals::EOS<REAL, INDEX>(run_params);
        break;
     }
     case Lcals_INT_PREDICT : {
-       kernel = new lcals::INT_PREDICT(run_params);
+       kernel = new lcals::INT_PREDICT<REAL, INDEX>(run_params);
        break;
     }
     case Lcals_DIFF_PREDICT : {
-       kernel = new lcals::DIFF_PREDICT(run_params);
+       kernel = new lcals::DIFF_PREDICT<REAL, INDEX>(run_params);
        break;
     }
     case Lcals_FIRST_DIFF : {
-       kernel = new lcals::FIRST_DIFF(run_params);
+       kernel = new lcals::FIRST_DIFF<REAL, INDEX>(run_params);
        break;
     }
     case Lcals_PLANCKIAN : {
-       kernel = new lcals::PLANCKIAN(run_params);
+       kernel = new lcals::PLANCKIAN<REAL, INDEX>(run_params);
        break;
     }
 
@@ -346,17 +706,17 @@ KernelBase* getKernelObject(KernelID kid,
 // Polybench kernels...
 //
     case Polybench_2MM : {
-       kernel = new polybench::POLYBENCH_2MM(run_params);
+       kernel = new polybench::POLYBENCH_2MM<REAL, INDEX>(run_params);
        break;
     }
 
     case Polybench_3MM : {
-       kernel = new polybench::POLYBENCH_3MM(run_params);
+       kernel = new polybench::POLYBENCH_3MM<REAL, INDEX>(run_params);
        break;
     }
 
     case Polybench_GEMMVER : {
-       kernel = new polybench::POLYBENCH_GEMMVER(run_params);
+       kernel = new polybench::POLYBENCH_GEMMVER<REAL, INDEX>(run_params);
        break;
     }
 
@@ -364,23 +724,23 @@ KernelBase* getKernelObject(KernelID kid,
 // Stream kernels...
 //
     case Stream_COPY : {
-       kernel = new stream::COPY(run_params);
+       kernel = new stream::COPY<REAL, INDEX>(run_params);
        break;
     }
     case Stream_MUL : {
-       kernel = new stream::MUL(run_params);
+       kernel = new stream::MUL<REAL, INDEX>(run_params);
        break;
     }
     case Stream_ADD : {
-       kernel = new stream::ADD(run_params);
+       kernel = new stream::ADD<REAL, INDEX>(run_params);
        break;
     }
     case Stream_TRIAD : {
-       kernel = new stream::TRIAD(run_params);
+       kernel = new stream::TRIAD<REAL, INDEX>(run_params);
        break;
     }
     case Stream_DOT : {
-       kernel = new stream::DOT(run_params);
+       kernel = new stream::DOT<REAL, INDEX>(run_params);
        break;
     }
 
@@ -388,31 +748,31 @@ KernelBase* getKernelObject(KernelID kid,
 // Apps kernels...
 //
     case Apps_PRESSURE : {
-       kernel = new apps::PRESSURE(run_params);
+       kernel = new apps::PRESSURE<REAL, INDEX>(run_params);
        break;
     }
     case Apps_ENERGY : {
-       kernel = new apps::ENERGY(run_params);
+       kernel = new apps::ENERGY<REAL, INDEX>(run_params);
        break;
     }
     case Apps_VOL3D : {
-       kernel = new apps::VOL3D(run_params);
+       kernel = new apps::VOL3D<REAL, INDEX>(run_params);
        break;
     }
     case Apps_DEL_DOT_VEC_2D : {
-       kernel = new apps::DEL_DOT_VEC_2D(run_params);
+       kernel = new apps::DEL_DOT_VEC_2D<REAL, INDEX>(run_params);
        break;
     }
     case Apps_FIR : {
-       kernel = new apps::FIR(run_params);
+       kernel = new apps::FIR<REAL, INDEX>(run_params);
        break;
     }
     case Apps_LTIMES : {
-       kernel = new apps::LTIMES(run_params);
+       kernel = new apps::LTIMES<REAL, INDEX>(run_params);
        break;
     }
     case Apps_COUPLE : {
-       kernel = new apps::COUPLE(run_params);
+       kernel = new apps::COUPLE<REAL, INDEX>(run_params);
        break;
     }
 
@@ -425,4 +785,65 @@ KernelBase* getKernelObject(KernelID kid,
   return kernel;
 }
 
+/*
+ *******************************************************************************
+ *
+ * \brief Construct and return kernel object for given KernelID enum value.
+ *
+ *******************************************************************************
+ */
+KernelBase* getKernelObject(KernelID kid,
+                            const RunParams& run_params)
+{
+  return makeKernelObject<Real_type, Index_type>(kid, run_params);
+}
+
+KernelBase* getKernelObject(KernelID kid,
+                            const RunParams& run_params,
+                            PrecisionID pid)
+{
+  if ( pid == getDefaultPrecision() ) {
+    return makeKernelObject<Real_type, Index_type>(kid, run_params);
+  }
+
+#if defined(RP_USE_MIXED_TYPES)
+  switch ( pid ) {
+    case DoublePrecision : {
+      return makeKernelObject<double, Index_type>(kid, run_params);
+    }
+    case FloatPrecision : {
+      return makeKernelObject<float, Index_type>(kid, run_params);
+    }
+    default : {
+      std::cout << "\n Unknown Precision ID = " << pid << std::endl;
+    }
+  }
+#endif
+
+  return 0;
+}
+
+KernelBase* getKernelObject(KernelID kid,
+                            const RunParams& run_params,
+                            IndexWidthID iwid)
+{
+  if ( iwid == getDefaultIndexWidth() ) {
+    return makeKernelObject<Real_type, Index_type>(kid, run_params);
+  }
+
+#if defined(RP_USE_MIXED_TYPES)
+  switch ( iwid ) {
+    case Index32 : 
+    case Index64 : {
+      return makeKernelObject<Real_type, AltIndex_type>(kid, run_params);
+    }
+    default : {
+      std::cout << "\n Unknown Index Width ID = " << iwid << std::endl;
+    }
+  }
+#endif
+
+  return 0;
+}
+
 }  // closing brace for rajaperf namespace
@@ -164,10 +164,62 @@ enum VariantID {
   Base_Seq = 0,
   RAJA_Seq,
 
+  Base_Simd,
+  RAJA_Simd,
+
+  Base_Seq_AoS,
+  RAJA_Seq_AoS,
+  Base_Seq_AoSoA,
+  RAJA_Seq_AoSoA,
+
+  Base_Seq_Tiled,
+  RAJA_Seq_Tiled,
+
+  Base_Seq_Fused,
+  RAJA_Seq_Fused,
+
+  Base_Seq_NTStore,
+  RAJA_Seq_NTStore,
+
+  Base_Seq_Prefetch,
+  RAJA_Seq_Prefetch,
+
+  Base_Seq_Blocked,
+  RAJA_Seq_Blocked,
+
+  Base_ThreadPool,
+
+#if defined(RAJAPERF_ENABLE_STDPAR)
+  Base_StdPar,
+#endif
+
 #if defined(RAJA_ENABLE_OPENMP)
   Base_OpenMP,
   RAJA_OpenMP,
 
+  Base_OpenMP_Simd,
+  RAJA_OpenMP_Simd,
+
+  Base_OpenMP_Sched,
+
+  Base_OpenMP_Tiled,
+  RAJA_OpenMP_Tiled,
+
+  Base_OpenMP_Fused,
+  RAJA_OpenMP_Fused,
+
+  Base_OpenMP_Region,
+  RAJA_OpenMP_Region,
+
+  Base_OpenMP_NTStore,
+  RAJA_OpenMP_NTStore,
+
+  Base_OpenMP_Prefetch,
+  RAJA_OpenMP_Prefetch,
+
+  Base_OpenMP_Blocked,
+  RAJA_OpenMP_Blocked,
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)  
   Base_OpenMPTarget,
   RAJA_OpenMPTarget,
@@ -175,6 +227,11 @@ enum VariantID {
 
 #endif
 
+#if defined(RAJA_ENABLE_TBB)
+  Base_TBB,
+  RAJA_TBB,
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
   Base_CUDA,
   RAJA_CUDA,
@@ -185,6 +242,140 @@ enum VariantID {
 };
 
 
+/*!
+ *******************************************************************************
+ *
+ * \brief Enumeration of floating point precisions (Real_type) that kernel
+ *        objects can be created with.
+ *
+ * IMPORTANT: IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ARRAY OF PRECISION NAMES IN IMPLEMENTATION FILE!!! 
+ *
+ *******************************************************************************
+ */
+enum PrecisionID {
+  DoublePrecision = 0,
+  FloatPrecision,
+
+  NumPrecisions // Keep this one last and NEVER comment out (!!)
+};
+
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Enumeration of loop index widths (Index_type) that kernel objects
+ *        can be created with.
+ *
+ * IMPORTANT: IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ARRAY OF INDEX WIDTH NAMES IN IMPLEMENTATION FILE!!! 
+ *
+ *******************************************************************************
+ */
+enum IndexWidthID {
+  Index32 = 0,
+  Index64,
+
+  NumIndexWidths // Keep this one last and NEVER comment out (!!)
+};
+
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Directives that vectorize the loop that follows in Base_Simd 
+ *        kernel variants.
+ *
+ * With OpenMP, these are 'omp simd' directives, which make the compiler
+ * vectorize the loop; RAJAPERF_SIMD_REDUCE takes the reduction clauses 
+ * for the loop. Otherwise, they are the compiler-specific RAJA_SIMD 
+ * directive that RAJA::simd_exec uses.
+ *
+ *******************************************************************************
+ */
+#define RAJAPERF_PRAGMA(x) _Pragma(#x)
+
+#if defined(RAJA_ENABLE_OPENMP)
+#define RAJAPERF_SIMD RAJAPERF_PRAGMA(omp simd)
+#define RAJAPERF_SIMD_REDUCE(clauses) RAJAPERF_PRAGMA(omp simd clauses)
+#else
+#define RAJAPERF_SIMD RAJA_SIMD
+#define RAJAPERF_SIMD_REDUCE(clauses) RAJA_SIMD
+#endif
+
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Tile size of each loop in RAJA tiled kernel variants.
+ *
+ * RAJA tile policies take the tile size as a template parameter, so unlike
+ * the tile sizes of Base tiled variants (see RunParams::getTileSize()), it 
+ * is fixed at compile time.
+ *
+ *******************************************************************************
+ */
+#if !defined(RAJAPERF_RAJA_TILE_SIZE)
+#define RAJAPERF_RAJA_TILE_SIZE 32
+#endif
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Software prefetch of cache line at address for reading 
+ *        (RAJAPERF_PREFETCH) or writing (RAJAPERF_PREFETCH_W), used in
+ *        *_Prefetch kernel variants, and cache line size those variants
+ *        assume.
+ *
+ * Prefetches are hints; they do nothing on compilers that do not support 
+ * __builtin_prefetch.
+ *
+ *******************************************************************************
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define RAJAPERF_PREFETCH(addr) __builtin_prefetch((addr), 0, 3)
+#define RAJAPERF_PREFETCH_W(addr) __builtin_prefetch((addr), 1, 3)
+#else
+#define RAJAPERF_PREFETCH(addr)
+#define RAJAPERF_PREFETCH_W(addr)
+#endif
+
+#define RAJAPERF_CACHE_LINE_BYTES 64
+
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Enumeration of loop schedules that Base_OpenMP_Sched kernel 
+ *        variants can run with.
+ *
+ * Static, dynamic, and guided are OpenMP loop schedule kinds; taskloop 
+ * runs the loop as OpenMP tasks created by one thread.
+ *
+ * IMPORTANT: IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ARRAY OF SCHEDULE NAMES IN IMPLEMENTATION FILE!!! 
+ *
+ *******************************************************************************
+ */
+enum OpenMPScheduleKind {
+  StaticSchedule = 0,
+  DynamicSchedule,
+  GuidedSchedule,
+  TaskloopSchedule,
+
+  NumOpenMPScheduleKinds // Keep this one last and NEVER comment out (!!)
+};
+
+/*!
+ * \brief Loop schedule kind and chunk size (grainsize for taskloop); 
+ *        chunk size 0 -> default for the kind.
+ */
+struct OpenMPSchedule {
+  OpenMPScheduleKind kind;
+  int chunk;
+};
+
+
 /*!
  *******************************************************************************
  *
@@ -228,13 +419,145 @@ const std::string& getVariantName(VariantID vid);
 /*!
  *******************************************************************************
  *
- * \brief Construct and return kernel object for given KernelID enum value.
+ * \brief Return true if variant runs on host using OpenMP threads 
+ *        (i.e., its performance depends on OpenMP thread count).
+ *
+ *******************************************************************************
+ */
+bool isOpenMPVariant(VariantID vid);
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Return name of OpenMP schedule, "<kind>" or "<kind>,<chunk>".
+ *
+ *******************************************************************************
+ */
+std::string getOpenMPScheduleName(const OpenMPSchedule& sched);
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Parse OpenMP schedule from its name; return false if name is not 
+ *        valid.
+ *
+ *******************************************************************************
+ */
+bool parseOpenMPSchedule(const std::string& name, OpenMPSchedule& sched);
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Set OpenMP runtime schedule, used by 'schedule(runtime)' loops, 
+ *        to given schedule for loop schedule kinds (static for taskloop).
+ *
+ *******************************************************************************
+ */
+void setOpenMPRuntimeSchedule(const OpenMPSchedule& sched);
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Return taskloop grainsize for loop of given length: the chunk 
+ *        size of the given schedule, or by default enough iterations to
+ *        make about four tasks per OpenMP thread.
+ *
+ *******************************************************************************
+ */
+int getTaskloopGrainsize(const OpenMPSchedule& sched, long long len);
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Coefficient lengths the FIR kernel is compiled for.
+ *
+ * FIR runs a loop specialized at compile time for each length, so it can
+ * only run with these (see FIR::runKernel()).
+ *
+ *******************************************************************************
+ */
+const int FIRCoeffLens[] = { 4, 8, 16, 32, 64, 128 };
+const int NumFIRCoeffLens = sizeof(FIRCoeffLens) / sizeof(FIRCoeffLens[0]);
+
+bool isFIRCoeffLenSupported(int len);
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Return name of precision associated with PrecisionID enum value.
+ *
+ *******************************************************************************
+ */
+const std::string& getPrecisionName(PrecisionID pid);
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Return precision of Real_type; i.e., precision of kernel objects 
+ *        used for regular suite runs.
+ *
+ *******************************************************************************
+ */
+PrecisionID getDefaultPrecision();
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Return true if kernel objects can be created with given precision
+ *        (see RP_USE_MIXED_TYPES).
+ *
+ *******************************************************************************
+ */
+bool isPrecisionAvailable(PrecisionID pid);
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Return name of index width associated with IndexWidthID enum value.
+ *
+ *******************************************************************************
+ */
+const std::string& getIndexWidthName(IndexWidthID iwid);
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Return width of Index_type; i.e., index width of kernel objects 
+ *        used for regular suite runs (see RP_USE_INDEX64).
+ *
+ *******************************************************************************
+ */
+IndexWidthID getDefaultIndexWidth();
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Return true if kernel objects can be created with given index 
+ *        width (see RP_USE_MIXED_TYPES).
+ *
+ *******************************************************************************
+ */
+bool isIndexWidthAvailable(IndexWidthID iwid);
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Construct and return kernel object for given KernelID enum value,
+ *        with Real_type of given precision or Index_type of given width 
+ *        (default is Real_type and Index_type). Returns null pointer if 
+ *        precision or index width is not available.
  *
  *        IMPORTANT: Caller assumes ownerhip of returned object.
  *
  *******************************************************************************
  */
 KernelBase* getKernelObject(KernelID kid, const RunParams& run_params);
+///
+KernelBase* getKernelObject(KernelID kid, const RunParams& run_params,
+                            PrecisionID pid);
+///
+KernelBase* getKernelObject(KernelID kid, const RunParams& run_params,
+                            IndexWidthID iwid);
 
 }  // closing brace for rajaperf namespace
 
@@ -20,6 +20,7 @@
 #ifndef RAJAPerf_RPTypes_HPP
 #define RAJAPerf_RPTypes_HPP
 
+#include "RAJA/config.hpp"
 #include "RAJA/util/types.hpp"
 
 //
@@ -33,10 +34,30 @@
 #define RP_USE_COMPLEX
 //#undef RP_USE_DOUBLE
 
+//
+// When defined, loop indices are 64-bit (RAJA::Index_type) instead of int,
+// so kernels can run on arrays with more than 2^31 elements. May also be
+// set with the PERFSUITE_ENABLE_INDEX64 CMake option.
+//
+//#define RP_USE_INDEX64
+
+//
+// When defined, kernels are instantiated for both float and double, and 
+// for the index width not selected above, so the suite can compare 
+// precisions and index widths in one run (Real_type and Index_type below 
+// are used for regular runs). CUDA device kernels are written for 
+// Real_type and Index_type only, so CUDA builds instantiate those only.
+//
+#if !defined(RAJA_ENABLE_CUDA)
+#define RP_USE_MIXED_TYPES
+#endif
+
 #if defined(RP_USE_COMPLEX)
 #include <complex>
 #endif
 
+#include <cmath>
+
 
 namespace rajaperf
 {
@@ -60,12 +81,21 @@ typedef volatile int RepIndex_type;
  *
  * \brief Types used for all kernel loop indexing.
  *
+ * AltIndex_type is the index type of the other width, with which kernels 
+ * are also instantiated to compare index widths (see RP_USE_MIXED_TYPES).
+ *
  ******************************************************************************
  */
-#if 0 // Index_type
-typedef RAJA::Index_type Index_type;
+typedef int Index32_type;
+///
+typedef RAJA::Index_type Index64_type;
+///
+#if defined(RP_USE_INDEX64)
+typedef Index64_type Index_type;
+typedef Index32_type AltIndex_type;
 #else
-typedef int Index_type;
+typedef Index32_type Index_type;
+typedef Index64_type AltIndex_type;
 #endif
 ///
 typedef Index_type* Index_ptr;
@@ -126,6 +156,62 @@ typedef Complex_type* RAJA_RESTRICT ResComplex_ptr;
 #endif
 
 
+/*!
+ ******************************************************************************
+ *
+ * \brief Floating point types used in a kernel class template instantiated
+ *        with real type REAL.
+ *
+ * Placed at the start of a kernel class, these hide the types above so
+ * kernel code written in terms of Real_type, Real_ptr, etc. uses REAL.
+ *
+ ******************************************************************************
+ */
+#if defined(RP_USE_COMPLEX)
+#define RAJAPERF_REAL_TYPES(REAL) \
+  typedef REAL Real_type; \
+  typedef Real_type* Real_ptr; \
+  typedef Real_type* RAJA_RESTRICT ResReal_ptr; \
+  typedef std::complex<Real_type> Complex_type; \
+  typedef Complex_type* Complex_ptr; \
+  typedef Complex_type* RAJA_RESTRICT ResComplex_ptr
+#else
+#define RAJAPERF_REAL_TYPES(REAL) \
+  typedef REAL Real_type; \
+  typedef Real_type* Real_ptr; \
+  typedef Real_type* RAJA_RESTRICT ResReal_ptr
+#endif
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Index type used in a kernel class template instantiated with 
+ *        index type INDEX.
+ *
+ * Placed at the start of a kernel class, this hides the type above so 
+ * kernel loops written in terms of Index_type use INDEX. Index arrays 
+ * (Index_ptr) hold data shared by all kernels and keep the suite-wide 
+ * type, as do overrides of KernelBase methods, which must name it as 
+ * rajaperf::Index_type.
+ *
+ ******************************************************************************
+ */
+#define RAJAPERF_INDEX_TYPES(INDEX) \
+  typedef INDEX Index_type
+
+#if defined(RP_USE_MIXED_TYPES)
+//
+// Unqualified math calls in kernels resolve to the overloads for the 
+// kernel's Real_type; the C library functions take and return double.
+//
+using std::sqrt;
+using std::fabs;
+using std::exp;
+using std::sin;
+using std::cos;
+#endif
+
+
 
 
 }  // closing brace for rajaperf namespace
@@ -19,6 +19,8 @@
 #include "RAJAPerfSuite.hpp"
 
 #include <cstdlib>
+#include <algorithm>
+#include <cmath>
 #include <cstdio>
 #include <iostream>
 
@@ -38,9 +40,32 @@ RunParams::RunParams(int argc, char** argv)
    show_progress(false),
    npasses(1),
    rep_fact(1.0),
+   reps_per_sample(0),
+   thread_counts(),
+   pool_threads(0),
+   omp_schedules(),
+   peak_gflops(0.0),
+   prefetch_distance(64),
+   prefetch_distances(),
+   fir_coefflen(16),
+   fir_coefflens(),
+   warmup_reps(0),
+   target_time(0.0),
+   target_rel_err(0.01),
    size_fact(1.0),
+   size_sweep_facts(),
    pf_tol(0.1),
    checkrun_reps(1),
+   use_hw_counters(false),
+   counter_fp_event(0),
+   data_placement(DefaultPlacement),
+   data_placement_node(0),
+   report_data_placement(false),
+   data_page_mode(DefaultPages),
+   report_data_pages(false),
+   use_data_pool(false),
+   compare_precision(false),
+   compare_index_width(false),
    size_spec(Specundefined),
    size_spec_string("SPECUNDEFINED"),
    reference_variant(),
@@ -51,6 +76,8 @@ RunParams::RunParams(int argc, char** argv)
    outdir(),
    outfile_prefix("RAJAPerf")
 {
+  tile_sizes[0] = tile_sizes[1] = tile_sizes[2] = 32;
+
   parseCommandLineOptions(argc, argv);
 }
 
@@ -79,10 +106,50 @@ void RunParams::print(std::ostream& str) const
   str << "\n show_progress = " << show_progress; 
   str << "\n npasses = " << npasses; 
   str << "\n rep_fact = " << rep_fact; 
+  str << "\n reps_per_sample = " << reps_per_sample; 
+  str << "\n warmup_reps = " << warmup_reps; 
+  str << "\n target_time = " << target_time; 
+  str << "\n target_rel_err = " << target_rel_err; 
+  str << "\n thread_counts = "; 
+  for (size_t j = 0; j < thread_counts.size(); ++j) {
+    str << " " << thread_counts[j];
+  }
+  str << "\n pool_threads = " << pool_threads; 
+  str << "\n omp_schedules = "; 
+  for (size_t j = 0; j < omp_schedules.size(); ++j) {
+    str << " " << getOpenMPScheduleName(omp_schedules[j]);
+  }
+  str << "\n tile_sizes = " << tile_sizes[0] << " " << tile_sizes[1] 
+      << " " << tile_sizes[2]; 
+  str << "\n peak_gflops = " << peak_gflops; 
+  str << "\n prefetch_distance = " << prefetch_distance; 
+  str << "\n prefetch_distances = "; 
+  for (size_t j = 0; j < prefetch_distances.size(); ++j) {
+    str << " " << prefetch_distances[j];
+  }
+  str << "\n fir_coefflen = " << fir_coefflen; 
+  str << "\n fir_coefflens = "; 
+  for (size_t j = 0; j < fir_coefflens.size(); ++j) {
+    str << " " << fir_coefflens[j];
+  }
   str << "\n size_fact = " << size_fact; 
   str << "\n size_fact = " << size_fact; 
+  str << "\n size_sweep_facts = "; 
+  for (size_t j = 0; j < size_sweep_facts.size(); ++j) {
+    str << " " << size_sweep_facts[j];
+  }
   str << "\n pf_tol = " << pf_tol; 
   str << "\n checkrun_reps = " << checkrun_reps; 
+  str << "\n use_hw_counters = " << use_hw_counters; 
+  str << "\n counter_fp_event = " << counter_fp_event; 
+  str << "\n data_placement = " << getDataPlacementName(data_placement); 
+  str << "\n data_placement_node = " << data_placement_node; 
+  str << "\n report_data_placement = " << report_data_placement; 
+  str << "\n data_page_mode = " << getDataPageModeName(data_page_mode); 
+  str << "\n report_data_pages = " << report_data_pages; 
+  str << "\n use_data_pool = " << use_data_pool; 
+  str << "\n compare_precision = " << compare_precision; 
+  str << "\n compare_index_width = " << compare_index_width; 
   str << "\n reference_variant = " << reference_variant; 
   str << "\n outdir = " << outdir; 
   str << "\n outfile_prefix = " << outfile_prefix; 
@@ -170,6 +237,285 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
         input_state = BadInput;
       }
 
+    } else if ( opt == std::string("--reps-per-sample") ||
+                opt == std::string("-rps") ) {
+
+      i++;
+      if ( i < argc ) { 
+        reps_per_sample = ::atoi( argv[i] );
+      } else {
+        std::cout << "\nBad input:"
+                  << " must give --reps-per-sample (or -rps) a value (int)" 
+                  << std::endl;       
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--warmup-reps") ||
+                opt == std::string("-wr") ) {
+
+      i++;
+      if ( i < argc ) { 
+        warmup_reps = ::atoi( argv[i] );
+      } else {
+        std::cout << "\nBad input:"
+                  << " must give --warmup-reps (or -wr) a value (int)" 
+                  << std::endl;       
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--target-time") ||
+                opt == std::string("-tt") ) {
+
+      i++;
+      if ( i < argc ) { 
+        target_time = ::atof( argv[i] );
+      } else {
+        std::cout << "\nBad input:"
+                  << " must give --target-time (or -tt) a value (double)" 
+                  << std::endl;       
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--target-rel-err") ||
+                opt == std::string("-tre") ) {
+
+      i++;
+      if ( i < argc ) { 
+        target_rel_err = ::atof( argv[i] );
+      } else {
+        std::cout << "\nBad input:"
+                  << " must give --target-rel-err (or -tre) a value (double)" 
+                  << std::endl;       
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--threads") ||
+                opt == std::string("-t") ) {
+
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          int nthreads = ::atoi( argv[i] );
+          if ( nthreads > 0 ) {
+            thread_counts.push_back(nthreads);
+          } else {
+            std::cout << "\nBad input:"
+                      << " --threads (or -t) values must be positive (int)" 
+                      << std::endl;
+            input_state = BadInput;
+          }
+          ++i;
+        }
+      }
+      if ( thread_counts.empty() ) {
+        std::cout << "\nBad input:"
+                  << " must give --threads (or -t) one or more thread counts"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--omp-schedules") ||
+                opt == std::string("-os") ) {
+
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          OpenMPSchedule sched;
+          if ( parseOpenMPSchedule(opt, sched) ) {
+            omp_schedules.push_back(sched);
+          } else {
+            std::cout << "\nBad input:"
+                      << " unknown --omp-schedules (or -os) schedule: " << opt
+                      << std::endl;
+            input_state = BadInput;
+          }
+          ++i;
+        }
+      }
+      if ( omp_schedules.empty() ) {
+        std::cout << "\nBad input:"
+                  << " must give --omp-schedules (or -os) one or more schedules"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--pool-threads") ||
+                opt == std::string("-pt") ) {
+
+      i++;
+      if ( i < argc ) { 
+        pool_threads = ::atoi( argv[i] );
+        if ( pool_threads <= 0 ) {
+          std::cout << "\nBad input:"
+                    << " --pool-threads (or -pt) value must be positive (int)" 
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        std::cout << "\nBad input:"
+                  << " must give --pool-threads (or -pt) a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--tile-sizes") ||
+                opt == std::string("-ts") ) {
+
+      int ntiles = 0;
+      while ( i + 1 < argc && argv[i+1][0] != '-' && ntiles < 3 ) {
+        tile_sizes[ntiles] = ::atoi( argv[++i] );
+        if ( tile_sizes[ntiles] <= 0 ) {
+          std::cout << "\nBad input:"
+                    << " --tile-sizes (or -ts) values must be positive (int)" 
+                    << std::endl;
+          input_state = BadInput;
+        }
+        ++ntiles;
+      }
+      if ( ntiles == 0 ) {
+        std::cout << "\nBad input:"
+                  << " must give --tile-sizes (or -ts) one to three tile"
+                  << " sizes (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+      for (int it = ntiles; it > 0 && it < 3; ++it) {
+        tile_sizes[it] = tile_sizes[it-1];
+      }
+
+    } else if ( opt == std::string("--peak-gflops") ) {
+
+      i++;
+      if ( i < argc ) { 
+        peak_gflops = ::atof( argv[i] );
+      } else {
+        std::cout << "\nBad input:"
+                  << " must give --peak-gflops a value (double)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--prefetch-distance") ||
+                opt == std::string("-pd") ) {
+
+      i++;
+      if ( i < argc ) { 
+        prefetch_distance = ::atoi( argv[i] );
+        if ( prefetch_distance < 0 ) {
+          std::cout << "\nBad input:"
+                    << " --prefetch-distance (or -pd) value must be"
+                    << " non-negative (int)" 
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        std::cout << "\nBad input:"
+                  << " must give --prefetch-distance (or -pd) a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--prefetch-sweep") ||
+                opt == std::string("-ps") ) {
+
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          const int dist = ::atoi( opt.c_str() );
+          if ( dist < 0 ) {
+            std::cout << "\nBad input:"
+                      << " --prefetch-sweep (or -ps) values must be"
+                      << " non-negative (int)"
+                      << std::endl;
+            input_state = BadInput;
+          }
+          prefetch_distances.push_back(dist);
+          ++i;
+        }
+      }
+      if ( prefetch_distances.empty() ) {
+        std::cout << "\nBad input:"
+                  << " must give --prefetch-sweep (or -ps) one or more"
+                  << " distances (int)"
+                  << std::endl;
+        input_state = BadInput;
+      } else if ( std::find(prefetch_distances.begin(), 
+                            prefetch_distances.end(), 0) == 
+                  prefetch_distances.end() ) {
+        // distance 0 (no prefetch) is the baseline for prefetch speedup
+        prefetch_distances.insert(prefetch_distances.begin(), 0);
+      }
+
+    } else if ( opt == std::string("--fir-coefflen") ||
+                opt == std::string("-fl") ) {
+
+      i++;
+      if ( i < argc ) { 
+        fir_coefflen = ::atoi( argv[i] );
+        if ( !isFIRCoeffLenSupported(fir_coefflen) ) {
+          std::cout << "\nBad input:"
+                    << " --fir-coefflen (or -fl) value must be one of";
+          for (int il = 0; il < NumFIRCoeffLens; ++il) {
+            std::cout << " " << FIRCoeffLens[il];
+          }
+          std::cout << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        std::cout << "\nBad input:"
+                  << " must give --fir-coefflen (or -fl) a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--fir-sweep") ||
+                opt == std::string("-fs") ) {
+
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          const int len = ::atoi( opt.c_str() );
+          if ( !isFIRCoeffLenSupported(len) ) {
+            std::cout << "\nBad input:"
+                      << " --fir-sweep (or -fs) values must be one of";
+            for (int il = 0; il < NumFIRCoeffLens; ++il) {
+              std::cout << " " << FIRCoeffLens[il];
+            }
+            std::cout << std::endl;
+            input_state = BadInput;
+          }
+          fir_coefflens.push_back(len);
+          ++i;
+        }
+      }
+      if ( fir_coefflens.empty() ) {
+        std::cout << "\nBad input:"
+                  << " must give --fir-sweep (or -fs) one or more"
+                  << " coefficient lengths (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
     } else if ( opt == std::string("--sizefact") ) {
 
       i++;
@@ -182,6 +528,36 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
         input_state = BadInput;
       }
 
+    } else if ( opt == std::string("--size-sweep") ) {
+
+      if ( i + 2 < argc ) {
+        double fmin = ::atof( argv[++i] );
+        double fmax = ::atof( argv[++i] );
+        int npoints = 8;
+        if ( i + 1 < argc && argv[i+1][0] != '-' ) {
+          npoints = ::atoi( argv[++i] );
+        }
+        if ( fmin > 0.0 && fmax >= fmin && npoints > 0 ) {
+          size_sweep_facts.clear();
+          for (int ip = 0; ip < npoints; ++ip) {
+            double frac = ( npoints > 1 ? double(ip) / (npoints - 1) : 0.0 );
+            size_sweep_facts.push_back( fmin * std::pow(fmax / fmin, frac) );
+          }
+        } else {
+          std::cout << "\nBad input:"
+                    << " --size-sweep needs 0 < min <= max and"
+                    << " # points > 0"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        std::cout << "\nBad input:"
+                  << " must give --size-sweep min and max size factors"
+                  << " (double) and optionally # points (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
     } else if (opt == std::string("--sizespec") ) {
       i++;
       if ( i < argc ) {
@@ -205,6 +581,96 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
         input_state = BadInput;
       }
 
+    } else if ( opt == std::string("--counters") ) {
+
+      use_hw_counters = true;
+
+    } else if ( opt == std::string("--counters-fp-event") ) {
+
+      i++;
+      if ( i < argc ) {
+        use_hw_counters = true;
+        counter_fp_event = ::strtoull( argv[i], 0, 0 );
+      } else {
+        std::cout << "\nBad input:"
+                  << " must give --counters-fp-event a value (raw event code)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--data-placement") ||
+                opt == std::string("-dp") ) {
+
+      i++;
+      if ( i < argc ) {
+        opt = std::string(argv[i]);
+        data_placement = NumDataPlacements;
+        for (int ip = 0; ip < NumDataPlacements; ++ip) {
+          DataPlacement dp = static_cast<DataPlacement>(ip);
+          if ( opt == getDataPlacementName(dp) ) {
+            data_placement = dp;
+          }
+        }
+        if ( data_placement == NumDataPlacements ) {
+          std::cout << "\nBad input:"
+                    << " unknown --data-placement (or -dp) policy: " << opt
+                    << std::endl;
+          data_placement = DefaultPlacement;
+          input_state = BadInput;
+        } else if ( data_placement == BindPlacement &&
+                    i + 1 < argc && argv[i+1][0] != '-' ) {
+          data_placement_node = ::atoi( argv[++i] );
+        }
+        report_data_placement = true;
+      } else {
+        std::cout << "\nBad input:"
+                  << " must give --data-placement (or -dp) a policy name"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--huge-pages") ||
+                opt == std::string("-hp") ) {
+
+      i++;
+      if ( i < argc ) {
+        opt = std::string(argv[i]);
+        data_page_mode = NumDataPageModes;
+        for (int im = 0; im < NumDataPageModes; ++im) {
+          DataPageMode mode = static_cast<DataPageMode>(im);
+          if ( opt == getDataPageModeName(mode) ) {
+            data_page_mode = mode;
+          }
+        }
+        if ( data_page_mode == NumDataPageModes ) {
+          std::cout << "\nBad input:"
+                    << " unknown --huge-pages (or -hp) mode: " << opt
+                    << std::endl;
+          data_page_mode = DefaultPages;
+          input_state = BadInput;
+        }
+        report_data_pages = true;
+      } else {
+        std::cout << "\nBad input:"
+                  << " must give --huge-pages (or -hp) a mode name"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--data-pool") ) {
+
+      use_data_pool = true;
+
+    } else if ( opt == std::string("--precision-compare") ||
+                opt == std::string("-pc") ) {
+
+      compare_precision = true;
+
+    } else if ( opt == std::string("--index-compare") ||
+                opt == std::string("-ic") ) {
+
+      compare_index_width = true;
+
     } else if ( opt == std::string("--kernels") ||
                 opt == std::string("-k") ) {
 
@@ -332,11 +798,94 @@ void RunParams::printHelpMessage(std::ostream& str) const
   str << "\t\t Example...\n"
       << "\t\t --repfact 0.5 (runs kernels 1/2 as many times as default)\n\n";
 
+  str << "\t --reps-per-sample, -rps <int> [default is 0; i.e., all reps]\n"
+      << "\t      (# kernel reps timed together in each timing sample)\n";
+  str << "\t\t Example...\n"
+      << "\t\t -rps 1 (time each kernel rep separately; statistics over samples in timing-stats report)\n\n";
+
+  str << "\t --warmup-reps, -wr <int> [default is 0]\n"
+      << "\t      (# kernel reps run before timed reps of each variant run;\n"
+      << "\t       warmup time reported separately in warmup report)\n";
+  str << "\t\t Example...\n"
+      << "\t\t -wr 10 (run 10 warmup reps before timing each kernel variant)\n\n";
+
+  str << "\t --target-time, -tt <double> [default is 0; i.e., use default reps]\n"
+      << "\t      (calibrate reps so each kernel variant runs about this many seconds;\n"
+      << "\t       first variant run of each kernel probes time per rep and stops early\n"
+      << "\t       when timing converges, other variants run the same # reps)\n";
+  str << "\t\t Example...\n"
+      << "\t\t -tt 0.5 (run each kernel variant for at most about 0.5 sec.)\n\n";
+
+  str << "\t --target-rel-err, -tre <double> [default is 0.01; i.e., 1%]\n"
+      << "\t      (relative half-width of 95% confidence interval of mean time per rep\n"
+      << "\t       at which --target-time calibration run stops early)\n\n";
+
+  str << "\t --threads, -t <space-separated ints> [default is no sweep]\n"
+      << "\t      (rerun OpenMP variants with each thread count; results in thread scaling report)\n";
+  str << "\t\t Example...\n"
+      << "\t\t -t 1 2 4 8 16 32 (strong scaling of OpenMP variants from 1 to 32 threads)\n\n";
+
+  str << "\t --omp-schedules, -os <space-separated schedules> [default is static]\n"
+      << "\t      (schedules for Base_OpenMP_Sched variants of irregular kernels; each one of\n"
+      << "\t       static, dynamic, guided, taskloop with optional ',<chunk>' (grainsize for\n"
+      << "\t       taskloop); first is used for timing reports; results in OpenMP schedule report)\n";
+  str << "\t\t Example...\n"
+      << "\t\t -os static static,16 dynamic,16 guided taskloop\n\n";
+
+  str << "\t --pool-threads, -pt <int> [default is number of hardware threads]\n"
+      << "\t      (threads in work-stealing pool used by Base_ThreadPool variants)\n";
+  str << "\t\t Example...\n"
+      << "\t\t -pt 16\n\n";
+
+  str << "\t --tile-sizes, -ts <int> [int] [int] [default is 32 32 32]\n"
+      << "\t      (i, j, k tile sizes of Base tiled variants of matrix products\n"
+      << "\t       C[i][j] += A[i][k] * B[k][j]; missing sizes repeat the last one;\n"
+      << "\t       RAJA tiled variants use RAJAPERF_RAJA_TILE_SIZE, set at build time)\n";
+  str << "\t\t Example...\n"
+      << "\t\t -ts 64 64 128\n\n";
+
+  str << "\t --peak-gflops <double> [default is measured estimate]\n"
+      << "\t      (peak GFLOP/s of one thread, for % of peak in tiling report;\n"
+      << "\t       OpenMP variants are compared with this times # threads)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --peak-gflops 32.0 (2.0 GHz core, two 4-wide double FMA units)\n\n";
+
+  str << "\t --prefetch-distance, -pd <int> [default is 64]\n"
+      << "\t      (software prefetch distance, in loop iterations, of *_Prefetch variants;\n"
+      << "\t       0 turns prefetch off)\n";
+  str << "\t\t Example...\n"
+      << "\t\t -pd 128\n\n";
+
+  str << "\t --prefetch-sweep, -ps <space-separated ints> [default is no sweep]\n"
+      << "\t      (rerun *_Prefetch variants with each prefetch distance, and with 0 if not\n"
+      << "\t       given; results in prefetch report, which gives the best distance for\n"
+      << "\t       each kernel variant)\n";
+  str << "\t\t Example...\n"
+      << "\t\t -ps 0 8 16 32 64 128 256\n\n";
+
+  str << "\t --fir-coefflen, -fl <int> [default is 16]\n"
+      << "\t      (FIR kernel coefficient length; one of 4, 8, 16, 32, 64, 128)\n";
+  str << "\t\t Example...\n"
+      << "\t\t -fl 64\n\n";
+
+  str << "\t --fir-sweep, -fs <space-separated ints> [default is no sweep]\n"
+      << "\t      (rerun FIR direct and *_Blocked variants with each coefficient\n"
+      << "\t       length; results in FIR coefficient length report)\n";
+  str << "\t\t Example...\n"
+      << "\t\t -fs 4 8 16 32 64 128\n\n";
+
   str << "\t --sizefact <double> [default is 1.0]\n"
       << "\t      (fraction of default kernel iteration space size to run)\n";
   str << "\t\t Example...\n"
       << "\t\t --repfact 2.0 (kernel loops will be twice as long as default)\n\n";
 
+  str << "\t --size-sweep <double> <double> [int] [default is no sweep; # points default is 8]\n"
+      << "\t      (rerun kernels at geometric sequence of size factors from min to max,\n"
+      << "\t       with reps scaled to keep work per kernel roughly constant;\n"
+      << "\t       results in size sweep report)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --size-sweep 0.001 10 13 (sizes from 1/1000 to 10 times default, 13 points)\n\n";
+
   str << "\t --sizespec <string> [one of : mini,small,medium,large,extralarge (anycase) -- default is medium]\n"
       << "\t      (used to set specific sizes for certain kernels : e.g. polybench)\n\n"; 
 
@@ -345,6 +894,42 @@ void RunParams::printHelpMessage(std::ostream& str) const
   str << "\t\t Example...\n"
       << "\t\t -pftol 0.2 (RAJA kernel variants that run 20% or more slower than Base variants will be reported as FAIL in FOM report)\n\n";
 
+  str << "\t --counters (read hardware performance counters around timed kernel regions;\n"
+      << "\t      results in counters report, Linux only)\n\n";
+
+  str << "\t --counters-fp-event <hex int> [default is none]\n"
+      << "\t      (raw CPU-specific perf event code for FP ops; implies --counters)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --counters-fp-event 0x01c7 (scalar double FP ops on recent Intel CPUs)\n\n";
+
+  str << "\t --data-placement, -dp <string> [int] [default is default]\n"
+      << "\t      (NUMA placement of data array pages; one of default, first-touch,\n"
+      << "\t       serial, interleave, bind <node>; interleave and bind are Linux only;\n"
+      << "\t       nodes of sampled pages given in data placement report)\n";
+  str << "\t\t Examples...\n"
+      << "\t\t -dp first-touch (fresh pages touched by OpenMP threads with static schedule)\n"
+      << "\t\t -dp bind 1 (all pages on NUMA node 1)\n\n";
+
+  str << "\t --huge-pages, -hp <string> [default is default]\n"
+      << "\t      (pages backing data arrays; one of default, thp (transparent huge\n"
+      << "\t       pages), explicit (hugetlbfs pool, falls back to thp); Linux only;\n"
+      << "\t       pages obtained given in huge page report)\n";
+  str << "\t\t Examples...\n"
+      << "\t\t -hp thp\n"
+      << "\t\t -hp explicit (reserve pool first, e.g., via /proc/sys/vm/nr_hugepages)\n\n";
+
+  str << "\t --data-pool (reuse data arrays of the same size across kernel\n"
+      << "\t      variant executions and passes instead of allocating them each time;\n"
+      << "\t      arrays are reinitialized before each use)\n\n";
+
+  str << "\t --precision-compare, -pc (also run each kernel variant in float if\n"
+      << "\t      suite is built for double, or double if built for float; results in\n"
+      << "\t      precision report with speedup and checksum drift; not in CUDA builds)\n\n";
+
+  str << "\t --index-compare, -ic (also run each kernel variant with 64-bit loop indices\n"
+      << "\t      if suite is built for 32-bit, or 32-bit if built for 64-bit; results in\n"
+      << "\t      index width report with time difference; not in CUDA builds)\n\n";
+
   str << "\t --outdir, -od <string> [Default is current directory]\n"
       << "\t      (directory path for output data files)\n";
   str << "\t\t Examples...\n"
@@ -74,8 +74,53 @@ public:
   int getNumPasses() const { return npasses; }
 
   double getRepFactor() const { return rep_fact; }
+  void setRepFactor(double fact) { rep_fact = fact; }
+
+  int getRepsPerSample() const { return reps_per_sample; }
+
+  int getWarmupReps() const { return warmup_reps; }
+
+  double getTargetTime() const { return target_time; }
+  double getTargetRelErr() const { return target_rel_err; }
+
+  const std::vector<int>& getThreadCounts() const { return thread_counts; }
+
+  int getPoolThreads() const { return pool_threads; }
+
+  const std::vector<OpenMPSchedule>& getOpenMPSchedules() const 
+                                     { return omp_schedules; }
+
+  /*!
+   * \brief Return tile size for given loop of hand-tiled matrix products
+   *        C[i][j] += A[i][k] * B[k][j] (dim 0 -> i, 1 -> j, 2 -> k).
+   */
+  int getTileSize(int dim) const { return tile_sizes[dim]; }
+
+  double getPeakGFLOPs() const { return peak_gflops; }
+
+  /*!
+   * \brief Return software prefetch distance (in loop iterations) of 
+   *        *_Prefetch variants; 0 -> no prefetch.
+   */
+  int getPrefetchDistance() const { return prefetch_distance; }
+
+  const std::vector<int>& getPrefetchDistances() const 
+                          { return prefetch_distances; }
+
+  /*!
+   * \brief Return coefficient length FIR kernel variants run with.
+   */
+  int getFIRCoeffLen() const { return fir_coefflen; }
+  void setFIRCoeffLen(int len) { fir_coefflen = len; }
+
+  const std::vector<int>& getFIRCoeffLens() const 
+                          { return fir_coefflens; }
 
   double getSizeFactor() const { return size_fact; }
+  void setSizeFactor(double fact) { size_fact = fact; }
+
+  const std::vector<double>& getSizeSweepFactors() const 
+                             { return size_sweep_facts; }
 
   SizeSpec_T  getSizeSpec() const { return size_spec; }
 
@@ -85,6 +130,23 @@ public:
 
   double getPFTolerance() const { return pf_tol; }
 
+  bool useHWCounters() const { return use_hw_counters; }
+
+  unsigned long long getCounterFPEvent() const { return counter_fp_event; }
+
+  DataPlacement getDataPlacement() const { return data_placement; }
+  int getDataPlacementNode() const { return data_placement_node; }
+  bool reportDataPlacement() const { return report_data_placement; }
+
+  DataPageMode getDataPageMode() const { return data_page_mode; }
+  bool reportDataPages() const { return report_data_pages; }
+
+  bool useDataPool() const { return use_data_pool; }
+
+  bool comparePrecision() const { return compare_precision; }
+
+  bool compareIndexWidth() const { return compare_index_width; }
+
   int getCheckRunReps() const { return checkrun_reps; }
 
   const std::string& getReferenceVariant() const { return reference_variant; }
@@ -133,12 +195,66 @@ private:
 
   int npasses;           /*!< Number of passes through suite  */
   double rep_fact;       /*!< pct of default kernel reps to run */
+  int reps_per_sample;   /*!< Num kernel reps timed in each timing sample 
+                              (value <= 0 -> all reps in one sample) */
+  std::vector<int> thread_counts; /*!< OpenMP thread counts to sweep 
+                                       (empty -> no sweep) */
+  int pool_threads;  /*!< threads in pool used by Base_ThreadPool variants;
+                          0 -> one per hardware thread */
+  std::vector<OpenMPSchedule> omp_schedules; /*!< schedules to sweep for
+                                                  Base_OpenMP_Sched variants
+                                                  (empty -> static only) */
+  int tile_sizes[3];     /*!< i, j, k tile sizes of Base tiled variants */
+  double peak_gflops;    /*!< Peak GFLOP/s of one thread for tiling report 
+                              (value <= 0 -> estimate at run time) */
+  int prefetch_distance; /*!< prefetch distance of *_Prefetch variants */
+  std::vector<int> prefetch_distances; /*!< prefetch distances to sweep for
+                                            *_Prefetch variants 
+                                            (empty -> no sweep) */
+  int fir_coefflen;      /*!< coefficient length of FIR kernel variants */
+  std::vector<int> fir_coefflens; /*!< FIR coefficient lengths to sweep
+                                       (empty -> no sweep) */
+  int warmup_reps;       /*!< Num untimed kernel reps run before timed reps
+                              of each variant run */
+  double target_time;    /*!< Target run time (sec.) of each kernel variant
+                              to calibrate reps (value <= 0 -> use 
+                              default reps) */
+  double target_rel_err; /*!< Relative half-width of 95% confidence 
+                              interval of mean time per rep at which 
+                              calibration run stops early */
   double size_fact;      /*!< pct of default kernel iteration space to run */
+  std::vector<double> size_sweep_facts; /*!< geometric sequence of size 
+                                             factors to sweep 
+                                             (empty -> no sweep) */
   double pf_tol;         /*!< pct RAJA variant run time can exceed base for
                               each PM case to pass/fail acceptance */
 
   int checkrun_reps;     /*!< Num reps each kernel is run in check run */
 
+  bool use_hw_counters;  /*!< true -> read hardware counters around each
+                              timed kernel region */
+  unsigned long long counter_fp_event; /*!< raw (CPU-specific) perf event 
+                                            code for FP ops; 0 -> none */
+
+  DataPlacement data_placement; /*!< NUMA placement policy for data arrays */
+  int data_placement_node;      /*!< NUMA node for bind placement */
+  bool report_data_placement;   /*!< true -> sample NUMA nodes of data pages
+                                     and generate report */
+
+  DataPageMode data_page_mode;  /*!< kind of pages backing data arrays */
+  bool report_data_pages;       /*!< true -> generate huge page report */
+
+  bool use_data_pool;  /*!< true -> reuse data arrays across kernel variant 
+                            executions */
+
+  bool compare_precision;  /*!< true -> also run kernels in non-default 
+                                floating point precision and generate 
+                                precision report */
+
+  bool compare_index_width;  /*!< true -> also run kernels with 
+                                  non-default index width and generate 
+                                  index width report */
+
   SizeSpec_T size_spec;  /*!< optional use/parse polybench spec file for size:
                               (MINI, SMALL, MEDIUM, LARGE, EXTRALARGE, UNDEFINED) */ 
 
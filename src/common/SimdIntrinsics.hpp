@@ -0,0 +1,319 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-738930
+//
+// All rights reserved.
+//
+// This file is part of the RAJA Performance Suite.
+//
+// For details about use and distribution, please read raja-perfsuite/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Support for Base_Simd variants written with SIMD intrinsics.
+///
+/// RAJA_Simd variants leave vectorization to the compiler under the
+/// RAJA::simd_exec policy. Base_Simd variants of the stream and basic
+/// kernels are vectorized by hand with SimdVec, which holds one register
+/// of float or double values, as wide as the target supports (AVX-512,
+/// AVX, or SSE2), so the two show what the compiler leaves on the table.
+///
+/// Intrinsics are available on x86-64 (SSE2 and up); elsewhere
+/// RAJAPERF_HAVE_SIMD_INTRINSICS is not defined and Base_Simd variants
+/// use the RAJAPERF_SIMD directive.
+///
+
+#ifndef RAJAPerf_SimdIntrinsics_HPP
+#define RAJAPerf_SimdIntrinsics_HPP
+
+#if defined(__x86_64__) && defined(__SSE2__)
+#define RAJAPERF_HAVE_SIMD_INTRINSICS
+#endif
+
+#if defined(RAJAPERF_HAVE_SIMD_INTRINSICS)
+
+#include <immintrin.h>
+
+namespace rajaperf
+{
+
+/*!
+ *******************************************************************************
+ *
+ * \brief One SIMD register of values of type T (float or double).
+ *
+ * Loads and stores are unaligned. Arithmetic operators act lane by lane,
+ * as the scalar operators in kernel bodies do.
+ *
+ *******************************************************************************
+ */
+template <typename T>
+struct SimdVec;
+
+#if defined(__AVX512F__)
+
+template <>
+struct SimdVec<double>
+{
+  typedef double value_type;
+  static const int width = 8;
+
+  __m512d v;
+
+  SimdVec() { }
+  SimdVec(__m512d r) : v(r) { }
+
+  static SimdVec load(const double* p) { return _mm512_loadu_pd(p); }
+  void store(double* p) const { _mm512_storeu_pd(p, v); }
+  static SimdVec set1(double s) { return _mm512_set1_pd(s); }
+  static SimdVec zero() { return _mm512_setzero_pd(); }
+
+  static SimdVec sqrt(SimdVec a) { return _mm512_sqrt_pd(a.v); }
+
+  /*!
+   * \brief Lanes of a where s >= 0, of b elsewhere.
+   */
+  static SimdVec selectNonNegative(SimdVec s, SimdVec a, SimdVec b)
+  {
+    const __mmask8 m = _mm512_cmp_pd_mask(s.v, _mm512_setzero_pd(),
+                                          _CMP_GE_OQ);
+    return _mm512_mask_blend_pd(m, b.v, a.v);
+  }
+
+  SimdVec operator-() const
+  {
+    return _mm512_castsi512_pd(
+      _mm512_xor_si512(_mm512_castpd_si512(v),
+                       _mm512_castpd_si512(_mm512_set1_pd(-0.0))) );
+  }
+  SimdVec operator+(SimdVec b) const { return _mm512_add_pd(v, b.v); }
+  SimdVec operator-(SimdVec b) const { return _mm512_sub_pd(v, b.v); }
+  SimdVec operator*(SimdVec b) const { return _mm512_mul_pd(v, b.v); }
+  SimdVec operator/(SimdVec b) const { return _mm512_div_pd(v, b.v); }
+};
+
+template <>
+struct SimdVec<float>
+{
+  typedef float value_type;
+  static const int width = 16;
+
+  __m512 v;
+
+  SimdVec() { }
+  SimdVec(__m512 r) : v(r) { }
+
+  static SimdVec load(const float* p) { return _mm512_loadu_ps(p); }
+  void store(float* p) const { _mm512_storeu_ps(p, v); }
+  static SimdVec set1(float s) { return _mm512_set1_ps(s); }
+  static SimdVec zero() { return _mm512_setzero_ps(); }
+
+  static SimdVec sqrt(SimdVec a) { return _mm512_sqrt_ps(a.v); }
+
+  static SimdVec selectNonNegative(SimdVec s, SimdVec a, SimdVec b)
+  {
+    const __mmask16 m = _mm512_cmp_ps_mask(s.v, _mm512_setzero_ps(),
+                                           _CMP_GE_OQ);
+    return _mm512_mask_blend_ps(m, b.v, a.v);
+  }
+
+  SimdVec operator-() const
+  {
+    return _mm512_castsi512_ps(
+      _mm512_xor_si512(_mm512_castps_si512(v),
+                       _mm512_castps_si512(_mm512_set1_ps(-0.0f))) );
+  }
+  SimdVec operator+(SimdVec b) const { return _mm512_add_ps(v, b.v); }
+  SimdVec operator-(SimdVec b) const { return _mm512_sub_ps(v, b.v); }
+  SimdVec operator*(SimdVec b) const { return _mm512_mul_ps(v, b.v); }
+  SimdVec operator/(SimdVec b) const { return _mm512_div_ps(v, b.v); }
+};
+
+#elif defined(__AVX__)
+
+template <>
+struct SimdVec<double>
+{
+  typedef double value_type;
+  static const int width = 4;
+
+  __m256d v;
+
+  SimdVec() { }
+  SimdVec(__m256d r) : v(r) { }
+
+  static SimdVec load(const double* p) { return _mm256_loadu_pd(p); }
+  void store(double* p) const { _mm256_storeu_pd(p, v); }
+  static SimdVec set1(double s) { return _mm256_set1_pd(s); }
+  static SimdVec zero() { return _mm256_setzero_pd(); }
+
+  static SimdVec sqrt(SimdVec a) { return _mm256_sqrt_pd(a.v); }
+
+  static SimdVec selectNonNegative(SimdVec s, SimdVec a, SimdVec b)
+  {
+    const __m256d m = _mm256_cmp_pd(s.v, _mm256_setzero_pd(), _CMP_GE_OQ);
+    return _mm256_blendv_pd(b.v, a.v, m);
+  }
+
+  SimdVec operator-() const { return _mm256_xor_pd(v, _mm256_set1_pd(-0.0)); }
+  SimdVec operator+(SimdVec b) const { return _mm256_add_pd(v, b.v); }
+  SimdVec operator-(SimdVec b) const { return _mm256_sub_pd(v, b.v); }
+  SimdVec operator*(SimdVec b) const { return _mm256_mul_pd(v, b.v); }
+  SimdVec operator/(SimdVec b) const { return _mm256_div_pd(v, b.v); }
+};
+
+template <>
+struct SimdVec<float>
+{
+  typedef float value_type;
+  static const int width = 8;
+
+  __m256 v;
+
+  SimdVec() { }
+  SimdVec(__m256 r) : v(r) { }
+
+  static SimdVec load(const float* p) { return _mm256_loadu_ps(p); }
+  void store(float* p) const { _mm256_storeu_ps(p, v); }
+  static SimdVec set1(float s) { return _mm256_set1_ps(s); }
+  static SimdVec zero() { return _mm256_setzero_ps(); }
+
+  static SimdVec sqrt(SimdVec a) { return _mm256_sqrt_ps(a.v); }
+
+  static SimdVec selectNonNegative(SimdVec s, SimdVec a, SimdVec b)
+  {
+    const __m256 m = _mm256_cmp_ps(s.v, _mm256_setzero_ps(), _CMP_GE_OQ);
+    return _mm256_blendv_ps(b.v, a.v, m);
+  }
+
+  SimdVec operator-() const { return _mm256_xor_ps(v, _mm256_set1_ps(-0.0f)); }
+  SimdVec operator+(SimdVec b) const { return _mm256_add_ps(v, b.v); }
+  SimdVec operator-(SimdVec b) const { return _mm256_sub_ps(v, b.v); }
+  SimdVec operator*(SimdVec b) const { return _mm256_mul_ps(v, b.v); }
+  SimdVec operator/(SimdVec b) const { return _mm256_div_ps(v, b.v); }
+};
+
+#else
+
+template <>
+struct SimdVec<double>
+{
+  typedef double value_type;
+  static const int width = 2;
+
+  __m128d v;
+
+  SimdVec() { }
+  SimdVec(__m128d r) : v(r) { }
+
+  static SimdVec load(const double* p) { return _mm_loadu_pd(p); }
+  void store(double* p) const { _mm_storeu_pd(p, v); }
+  static SimdVec set1(double s) { return _mm_set1_pd(s); }
+  static SimdVec zero() { return _mm_setzero_pd(); }
+
+  static SimdVec sqrt(SimdVec a) { return _mm_sqrt_pd(a.v); }
+
+  static SimdVec selectNonNegative(SimdVec s, SimdVec a, SimdVec b)
+  {
+    const __m128d m = _mm_cmpge_pd(s.v, _mm_setzero_pd());
+    return _mm_or_pd(_mm_and_pd(m, a.v), _mm_andnot_pd(m, b.v));
+  }
+
+  SimdVec operator-() const { return _mm_xor_pd(v, _mm_set1_pd(-0.0)); }
+  SimdVec operator+(SimdVec b) const { return _mm_add_pd(v, b.v); }
+  SimdVec operator-(SimdVec b) const { return _mm_sub_pd(v, b.v); }
+  SimdVec operator*(SimdVec b) const { return _mm_mul_pd(v, b.v); }
+  SimdVec operator/(SimdVec b) const { return _mm_div_pd(v, b.v); }
+};
+
+template <>
+struct SimdVec<float>
+{
+  typedef float value_type;
+  static const int width = 4;
+
+  __m128 v;
+
+  SimdVec() { }
+  SimdVec(__m128 r) : v(r) { }
+
+  static SimdVec load(const float* p) { return _mm_loadu_ps(p); }
+  void store(float* p) const { _mm_storeu_ps(p, v); }
+  static SimdVec set1(float s) { return _mm_set1_ps(s); }
+  static SimdVec zero() { return _mm_setzero_ps(); }
+
+  static SimdVec sqrt(SimdVec a) { return _mm_sqrt_ps(a.v); }
+
+  static SimdVec selectNonNegative(SimdVec s, SimdVec a, SimdVec b)
+  {
+    const __m128 m = _mm_cmpge_ps(s.v, _mm_setzero_ps());
+    return _mm_or_ps(_mm_and_ps(m, a.v), _mm_andnot_ps(m, b.v));
+  }
+
+  SimdVec operator-() const { return _mm_xor_ps(v, _mm_set1_ps(-0.0f)); }
+  SimdVec operator+(SimdVec b) const { return _mm_add_ps(v, b.v); }
+  SimdVec operator-(SimdVec b) const { return _mm_sub_ps(v, b.v); }
+  SimdVec operator*(SimdVec b) const { return _mm_mul_ps(v, b.v); }
+  SimdVec operator/(SimdVec b) const { return _mm_div_ps(v, b.v); }
+};
+
+#endif
+
+/*!
+ * \brief Vector of loop index values i, i+1, ..., converted to value type.
+ */
+template <typename VEC, typename I>
+inline VEC simdIndex(I i)
+{
+  typename VEC::value_type lanes[VEC::width];
+  for (int l = 0; l < VEC::width; ++l) {
+    lanes[l] = static_cast<typename VEC::value_type>(i + l);
+  }
+  return VEC::load(lanes);
+}
+
+/*!
+ * \brief Sum of lanes of vector.
+ */
+template <typename VEC>
+inline typename VEC::value_type simdSum(const VEC& a)
+{
+  typename VEC::value_type lanes[VEC::width];
+  a.store(lanes);
+  typename VEC::value_type sum = 0;
+  for (int l = 0; l < VEC::width; ++l) {
+    sum += lanes[l];
+  }
+  return sum;
+}
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Run vbody(i) for each full vector of VEC::width iterations of
+ *        [ibegin, iend), starting at ibegin, then body(i) for each
+ *        remaining iteration.
+ *
+ *******************************************************************************
+ */
+template <typename VEC, typename I, typename VBODY, typename BODY>
+inline void forallSimd(I ibegin, I iend, VBODY&& vbody, BODY&& body)
+{
+  const I ivec_end = ibegin + (iend - ibegin) / VEC::width * VEC::width;
+  for (I i = ibegin; i < ivec_end; i += VEC::width) {
+    vbody(i);
+  }
+  for (I i = ivec_end; i < iend; ++i) {
+    body(i);
+  }
+}
+
+}  // closing brace for rajaperf namespace
+
+#endif  // RAJAPERF_HAVE_SIMD_INTRINSICS
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,101 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-738930
+//
+// All rights reserved.
+//
+// This file is part of the RAJA Performance Suite.
+//
+// For details about use and distribution, please read raja-perfsuite/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Support for Base_StdPar variants, which use C++17 parallel algorithms.
+///
+
+#ifndef RAJAPerf_StdPar_HPP
+#define RAJAPerf_StdPar_HPP
+
+#if defined(RAJAPERF_ENABLE_STDPAR)
+
+#include "RPTypes.hpp"
+
+#include <algorithm>
+#include <execution>
+#include <iterator>
+#include <numeric>
+
+namespace rajaperf
+{
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Random access iterator over a range of loop indices.
+ *
+ * Lets kernels whose bodies are written in terms of a loop index (e.g.,
+ * with several output arrays) run with std::for_each and
+ * std::transform_reduce, the way RAJA variants run them with a RangeSegment.
+ * I is the index type of the kernel's loops.
+ *
+ *******************************************************************************
+ */
+template <typename I>
+class IndexIterator
+{
+public:
+  typedef std::random_access_iterator_tag iterator_category;
+  typedef I value_type;
+  typedef I difference_type;
+  typedef const I* pointer;
+  typedef I reference;
+
+  IndexIterator() : idx(0) { }
+  explicit IndexIterator(I i) : idx(i) { }
+
+  reference operator*() const { return idx; }
+  reference operator[](difference_type n) const { return idx + n; }
+
+  IndexIterator& operator++() { ++idx; return *this; }
+  IndexIterator& operator--() { --idx; return *this; }
+  IndexIterator operator++(int) { IndexIterator t(*this); ++idx; return t; }
+  IndexIterator operator--(int) { IndexIterator t(*this); --idx; return t; }
+
+  IndexIterator& operator+=(difference_type n) { idx += n; return *this; }
+  IndexIterator& operator-=(difference_type n) { idx -= n; return *this; }
+
+  friend IndexIterator operator+(IndexIterator it, difference_type n)
+    { return IndexIterator(it.idx + n); }
+  friend IndexIterator operator+(difference_type n, IndexIterator it)
+    { return IndexIterator(it.idx + n); }
+  friend IndexIterator operator-(IndexIterator it, difference_type n)
+    { return IndexIterator(it.idx - n); }
+  friend difference_type operator-(IndexIterator a, IndexIterator b)
+    { return a.idx - b.idx; }
+
+  friend bool operator==(IndexIterator a, IndexIterator b)
+    { return a.idx == b.idx; }
+  friend bool operator!=(IndexIterator a, IndexIterator b)
+    { return a.idx != b.idx; }
+  friend bool operator<(IndexIterator a, IndexIterator b)
+    { return a.idx < b.idx; }
+  friend bool operator>(IndexIterator a, IndexIterator b)
+    { return a.idx > b.idx; }
+  friend bool operator<=(IndexIterator a, IndexIterator b)
+    { return a.idx <= b.idx; }
+  friend bool operator>=(IndexIterator a, IndexIterator b)
+    { return a.idx >= b.idx; }
+
+private:
+  I idx;
+};
+
+}  // closing brace for rajaperf namespace
+
+#endif  // RAJAPERF_ENABLE_STDPAR
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,317 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-738930
+//
+// All rights reserved.
+//
+// This file is part of the RAJA Performance Suite.
+//
+// For details about use and distribution, please read raja-perfsuite/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Support for *_NTStore variants, which write output arrays with
+/// non-temporal (streaming) stores.
+///
+/// A regular store to a line that is not in cache first reads the line
+/// (read-for-ownership, RFO). Non-temporal stores write full cache lines
+/// through write-combining buffers without reading them or displacing
+/// other data from cache, which saves the RFO traffic for arrays that are
+/// not read again soon.
+///
+/// Streaming stores are available on x86-64 (SSE2 and up); elsewhere
+/// RAJAPERF_HAVE_NT_STORES is not defined and kernels do not define
+/// *_NTStore variants.
+///
+
+#ifndef RAJAPerf_StreamingStores_HPP
+#define RAJAPerf_StreamingStores_HPP
+
+#if defined(__x86_64__) && defined(__SSE2__)
+#define RAJAPERF_HAVE_NT_STORES
+#endif
+
+#if defined(RAJAPERF_HAVE_NT_STORES)
+
+#include "RAJAPerfSuite.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <immintrin.h>
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+#include <cstdint>
+#include <cstring>
+
+namespace rajaperf
+{
+
+/*!
+ * \brief Bytes written by one full-line streaming store.
+ */
+const std::size_t NT_LINE_BYTES = 64;
+
+/*!
+ * \brief Non-temporal store of one value (MOVNTI), for stores that are
+ *        not part of an aligned full line.
+ */
+inline void ntStore(double* p, double v)
+{
+  long long bits;
+  std::memcpy(&bits, &v, sizeof(bits));
+  _mm_stream_si64(reinterpret_cast<long long*>(p), bits);
+}
+///
+inline void ntStore(float* p, float v)
+{
+  int bits;
+  std::memcpy(&bits, &v, sizeof(bits));
+  _mm_stream_si32(reinterpret_cast<int*>(p), bits);
+}
+
+/*!
+ * \brief Non-temporal store of a full cache line of values at p, which
+ *        must be NT_LINE_BYTES aligned, with the widest vector stores
+ *        the target supports.
+ */
+inline void ntStoreLine(double* p, const double* v)
+{
+#if defined(__AVX512F__)
+  _mm512_stream_pd(p, _mm512_loadu_pd(v));
+#elif defined(__AVX__)
+  _mm256_stream_pd(p, _mm256_loadu_pd(v));
+  _mm256_stream_pd(p + 4, _mm256_loadu_pd(v + 4));
+#else
+  _mm_stream_pd(p, _mm_loadu_pd(v));
+  _mm_stream_pd(p + 2, _mm_loadu_pd(v + 2));
+  _mm_stream_pd(p + 4, _mm_loadu_pd(v + 4));
+  _mm_stream_pd(p + 6, _mm_loadu_pd(v + 6));
+#endif
+}
+///
+inline void ntStoreLine(float* p, const float* v)
+{
+#if defined(__AVX512F__)
+  _mm512_stream_ps(p, _mm512_loadu_ps(v));
+#elif defined(__AVX__)
+  _mm256_stream_ps(p, _mm256_loadu_ps(v));
+  _mm256_stream_ps(p + 8, _mm256_loadu_ps(v + 8));
+#else
+  _mm_stream_ps(p, _mm_loadu_ps(v));
+  _mm_stream_ps(p + 4, _mm_loadu_ps(v + 4));
+  _mm_stream_ps(p + 8, _mm_loadu_ps(v + 8));
+  _mm_stream_ps(p + 12, _mm_loadu_ps(v + 12));
+#endif
+}
+
+/*!
+ * \brief Order streaming stores before later stores, so values are
+ *        visible to other threads once they pass a barrier or join.
+ */
+inline void ntFence()
+{
+  _mm_sfence();
+}
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Write value(i) to out[k][i] for each of NOUT output arrays and
+ *        each i in [ibegin, iend) with streaming stores.
+ *
+ * Output arrays must have the same offset from a cache line boundary
+ * (arrays allocated by the suite are cache line aligned). Entries up to
+ * the first line boundary and after the last one are written with regular
+ * stores, since partial lines are read for ownership anyway. Each line of
+ * values is computed into a buffer, with the loop vectorized, and then
+ * streamed to each output. If outputs are offset differently, every entry
+ * is written with a scalar streaming store.
+ *
+ * Ends with ntFence().
+ *
+ *******************************************************************************
+ */
+template <typename T, int NOUT, typename I, typename VALUE>
+inline void ntStoreRange(T* const (&out)[NOUT], I ibegin, I iend,
+                         VALUE&& value)
+{
+  const I line_len = static_cast<I>(NT_LINE_BYTES / sizeof(T));
+
+  const std::uintptr_t offset =
+    reinterpret_cast<std::uintptr_t>(out[0]) % NT_LINE_BYTES;
+  bool same_offset = true;
+  for (int k = 1; k < NOUT; ++k) {
+    same_offset = same_offset &&
+      ( reinterpret_cast<std::uintptr_t>(out[k]) % NT_LINE_BYTES == offset );
+  }
+
+  I i = ibegin;
+
+  if ( !same_offset ) {
+    for ( ; i < iend; ++i) {
+      const T v = value(i);
+      for (int k = 0; k < NOUT; ++k) {
+        ntStore(out[k] + i, v);
+      }
+    }
+    ntFence();
+    return;
+  }
+
+  for ( ; i < iend &&
+          reinterpret_cast<std::uintptr_t>(out[0] + i) % NT_LINE_BYTES != 0;
+        ++i) {
+    const T v = value(i);
+    for (int k = 0; k < NOUT; ++k) {
+      out[k][i] = v;
+    }
+  }
+
+  alignas(NT_LINE_BYTES) T line[NT_LINE_BYTES / sizeof(T)];
+  for ( ; i + line_len <= iend; i += line_len) {
+    RAJAPERF_SIMD
+    for (I j = 0; j < line_len; ++j) {
+      line[j] = value(i + j);
+    }
+    for (int k = 0; k < NOUT; ++k) {
+      ntStoreLine(out[k] + i, line);
+    }
+  }
+
+  for ( ; i < iend; ++i) {
+    const T v = value(i);
+    for (int k = 0; k < NOUT; ++k) {
+      out[k][i] = v;
+    }
+  }
+
+  ntFence();
+}
+
+/*!
+ * \brief Get range [cbegin, cend) of chunk ichunk of nchunks chunks of
+ *        [ibegin, iend) for output arrays with entries of type T, split 
+ *        on cache line boundaries (assuming ibegin is on one) so that no 
+ *        line is written by two threads.
+ */
+template <typename T, typename I>
+inline void getNTStoreChunk(I ibegin, I iend, int nchunks, int ichunk,
+                            I& cbegin, I& cend)
+{
+  const long long line_len = NT_LINE_BYTES / sizeof(T);
+  const long long nlines = (iend - ibegin + line_len - 1) / line_len;
+  const long long lbegin = nlines * ichunk / nchunks;
+  const long long lend = nlines * (ichunk + 1) / nchunks;
+  cbegin = static_cast<I>( ibegin + lbegin * line_len );
+  cend = static_cast<I>( ibegin + lend * line_len < iend ?
+                         ibegin + lend * line_len : iend );
+}
+
+/*!
+ * \brief Number of cache lines in one iteration of forallNTStore loops.
+ */
+const int NT_BLOCK_LINES = 64;
+
+/*!
+ *******************************************************************************
+ *
+ * \brief RAJA counterpart of ntStoreRange: runs loop over blocks of
+ *        cache lines of the outputs with RAJA::forall and execution
+ *        policy EXEC_POL.
+ *
+ * Each iteration computes the values of NT_BLOCK_LINES lines one line at
+ * a time, streams each line to the outputs, and ends with ntFence(), so
+ * stores are ordered in whichever thread ran it. Partial lines at the
+ * ends of the range are written with regular stores. Outputs offset
+ * differently from a cache line boundary are written entry by entry with
+ * scalar streaming stores.
+ *
+ *******************************************************************************
+ */
+template <typename EXEC_POL, typename T, int NOUT, typename I, typename VALUE>
+inline void forallNTStore(T* const (&out)[NOUT], I ibegin, I iend,
+                          VALUE value)
+{
+  T* const out0 = out[0];
+  T* const out1 = out[NOUT > 1 ? 1 : 0];
+  T* const out2 = out[NOUT > 2 ? 2 : 0];
+
+  const I line_len = static_cast<I>(NT_LINE_BYTES / sizeof(T));
+  const I block_len = line_len * NT_BLOCK_LINES;
+
+  const std::uintptr_t offset =
+    reinterpret_cast<std::uintptr_t>(out0) % NT_LINE_BYTES;
+  bool same_offset = true;
+  for (int k = 1; k < NOUT; ++k) {
+    same_offset = same_offset &&
+      ( reinterpret_cast<std::uintptr_t>(out[k]) % NT_LINE_BYTES == offset );
+  }
+
+  if ( !same_offset ) {
+    const I nblocks = (iend - ibegin + block_len - 1) / block_len;
+    RAJA::forall<EXEC_POL>(
+      RAJA::RangeSegment(0, nblocks), [=](I b) {
+      const I bbegin = ibegin + b * block_len;
+      const I bend = ( bbegin + block_len < iend ? bbegin + block_len : iend );
+      for (I i = bbegin; i < bend; ++i) {
+        const T v = value(i);
+        ntStore(out0 + i, v);
+        if ( NOUT > 1 ) ntStore(out1 + i, v);
+        if ( NOUT > 2 ) ntStore(out2 + i, v);
+      }
+      ntFence();
+    });
+    return;
+  }
+
+  I head_end = ibegin;
+  while ( head_end < iend &&
+          reinterpret_cast<std::uintptr_t>(out0 + head_end) %
+            NT_LINE_BYTES != 0 ) {
+    ++head_end;
+  }
+  const I nlines = (iend - head_end) / line_len;
+  const I tail_begin = head_end + nlines * line_len;
+  const I nblocks = (nlines + NT_BLOCK_LINES - 1) / NT_BLOCK_LINES;
+
+  auto regular = [=](I i) {
+    const T v = value(i);
+    out0[i] = v;
+    if ( NOUT > 1 ) out1[i] = v;
+    if ( NOUT > 2 ) out2[i] = v;
+  };
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(ibegin, head_end), regular);
+
+  RAJA::forall<EXEC_POL>(
+    RAJA::RangeSegment(0, nblocks), [=](I b) {
+    const I bbegin = head_end + b * block_len;
+    const I bend = ( bbegin + block_len < tail_begin ? 
+                     bbegin + block_len : tail_begin );
+    alignas(NT_LINE_BYTES) T line[NT_LINE_BYTES / sizeof(T)];
+    for (I i = bbegin; i < bend; i += line_len) {
+      RAJAPERF_SIMD
+      for (I j = 0; j < line_len; ++j) {
+        line[j] = value(i + j);
+      }
+      ntStoreLine(out0 + i, line);
+      if ( NOUT > 1 ) ntStoreLine(out1 + i, line);
+      if ( NOUT > 2 ) ntStoreLine(out2 + i, line);
+    }
+    ntFence();
+  });
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(tail_begin, iend), regular);
+}
+
+}  // closing brace for rajaperf namespace
+
+#endif  // RAJAPERF_HAVE_NT_STORES
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,206 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-738930
+//
+// All rights reserved.
+//
+// This file is part of the RAJA Performance Suite.
+//
+// For details about use and distribution, please read raja-perfsuite/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+#include "ThreadPool.hpp"
+
+namespace rajaperf
+{
+
+//
+// Number of chunks each thread is dealt per dispatched range; more than
+// one so there is something to steal when threads run unevenly.
+//
+static const int chunks_per_thread = 4;
+
+//
+// Number of times an idle worker checks for new work before blocking.
+//
+static const int idle_spins = 2048;
+
+
+ThreadPool::ThreadPool()
+  : num_threads(1),
+    pending(0),
+    generation(0),
+    stopping(false)
+{
+}
+
+ThreadPool::~ThreadPool()
+{
+  stop();
+}
+
+void ThreadPool::start(int nthreads)
+{
+  stop();
+
+  num_threads = (nthreads > 1 ? nthreads : 1);
+  if ( num_threads == 1 ) {
+    return;
+  }
+
+  stopping.store(false);
+  queues.clear();
+  for (int t = 0; t < num_threads; ++t) {
+    queues.emplace_back(new WorkQueue);
+  }
+
+  for (int t = 1; t < num_threads; ++t) {
+    workers.emplace_back(&ThreadPool::workerLoop, this, t);
+  }
+}
+
+void ThreadPool::stop()
+{
+  if ( workers.empty() ) {
+    num_threads = 1;
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(wake_mutex);
+    stopping.store(true);
+  }
+  wake_cv.notify_all();
+
+  for (size_t t = 0; t < workers.size(); ++t) {
+    workers[t].join();
+  }
+  workers.clear();
+  queues.clear();
+
+  num_threads = 1;
+}
+
+void ThreadPool::dispatch(Job& job, long long begin, long long end)
+{
+  const long long len = end - begin;
+  long long nchunks =
+    static_cast<long long>(num_threads) * chunks_per_thread;
+  if ( nchunks > len ) {
+    nchunks = len;
+  }
+
+  pending.store(static_cast<int>(nchunks), std::memory_order_relaxed);
+
+  //
+  // Deal chunks out in contiguous blocks, one block per thread.
+  //
+  for (int t = 0; t < num_threads; ++t) {
+    const long long cfirst = (nchunks * t) / num_threads;
+    const long long clast = (nchunks * (t+1)) / num_threads;
+
+    std::lock_guard<std::mutex> lock(queues[t]->mutex);
+    for (long long c = cfirst; c < clast; ++c) {
+      Task task;
+      task.job = &job;
+      task.begin = begin + (len * c) / nchunks;
+      task.end = begin + (len * (c+1)) / nchunks;
+      queues[t]->tasks.push_back(task);
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(wake_mutex);
+    generation.fetch_add(1, std::memory_order_release);
+  }
+  wake_cv.notify_all();
+
+  while ( pending.load(std::memory_order_acquire) > 0 ) {
+    if ( !runTask(0) ) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+void ThreadPool::workerLoop(int tid)
+{
+  unsigned seen = 0;
+
+  while ( true ) {
+
+    bool wake = false;
+    for (int spin = 0; spin < idle_spins && !wake; ++spin) {
+      wake = stopping.load(std::memory_order_acquire) ||
+             generation.load(std::memory_order_acquire) != seen;
+      if ( !wake ) {
+        std::this_thread::yield();
+      }
+    }
+
+    if ( !wake ) {
+      std::unique_lock<std::mutex> lock(wake_mutex);
+      wake_cv.wait(lock, [&]() {
+        return stopping.load() || generation.load() != seen;
+      });
+    }
+
+    if ( stopping.load(std::memory_order_acquire) ) {
+      break;
+    }
+
+    seen = generation.load(std::memory_order_acquire);
+    while ( runTask(tid) ) { }
+
+  }
+}
+
+bool ThreadPool::popTask(int tid, Task& task)
+{
+  WorkQueue& queue = *queues[tid];
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  if ( queue.tasks.empty() ) {
+    return false;
+  }
+  task = queue.tasks.front();
+  queue.tasks.pop_front();
+  return true;
+}
+
+bool ThreadPool::stealTask(int tid, Task& task)
+{
+  for (int k = 1; k < num_threads; ++k) {
+    WorkQueue& queue = *queues[(tid + k) % num_threads];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if ( !queue.tasks.empty() ) {
+      task = queue.tasks.back();
+      queue.tasks.pop_back();
+      return true;
+    }
+  }
+  return false;
+}
+
+bool ThreadPool::runTask(int tid)
+{
+  Task task;
+  if ( !popTask(tid, task) && !stealTask(tid, task) ) {
+    return false;
+  }
+  task.job->run(task.begin, task.end, tid);
+  pending.fetch_sub(1, std::memory_order_release);
+  return true;
+}
+
+
+ThreadPool& getThreadPool()
+{
+  static ThreadPool pool;
+  return pool;
+}
+
+}  // closing brace for rajaperf namespace
@@ -0,0 +1,191 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-738930
+//
+// All rights reserved.
+//
+// This file is part of the RAJA Performance Suite.
+//
+// For details about use and distribution, please read raja-perfsuite/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Suite-owned work-stealing thread pool used by Base_ThreadPool variants.
+///
+
+#ifndef RAJAPerf_ThreadPool_HPP
+#define RAJAPerf_ThreadPool_HPP
+
+#include "RPTypes.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace rajaperf
+{
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Simple pool of persistent std::threads that executes index ranges
+ *        by splitting them into chunks and load balancing the chunks with
+ *        work stealing.
+ *
+ * Each thread owns a deque of chunks. When a range is dispatched, chunks
+ * are dealt out to the deques in contiguous blocks so each thread
+ * initially works on the same part of the range on every call (which
+ * keeps it close to data it first-touched). A thread pops chunks from the
+ * front of its own deque; when that is empty it steals from the back of
+ * other threads' deques.
+ *
+ * The calling thread participates as thread 0 and returns only after all
+ * chunks are done. Between calls, worker threads spin briefly and then
+ * block on a condition variable, so they persist for the life of the pool
+ * without being created per call.
+ *
+ * Calls must not be nested: loop bodies must not call back into the pool.
+ *
+ *******************************************************************************
+ */
+class ThreadPool
+{
+public:
+
+  ThreadPool();
+
+  ~ThreadPool();
+
+  /*!
+   * \brief Start pool with given number of threads (including the calling
+   *        thread). Stops a running pool first.
+   */
+  void start(int nthreads);
+
+  void stop();
+
+  bool isRunning() const { return !workers.empty(); }
+
+  /*!
+   * \brief Return number of threads that execute pool work; 1 if pool
+   *        has not been started.
+   */
+  int getNumThreads() const { return num_threads; }
+
+  /*!
+   * \brief Execute body(cbegin, cend, tid) over chunks that partition
+   *        [begin, end). tid is in [0, getNumThreads()) and is unique
+   *        among concurrently running chunks, so it may index per-thread
+   *        partial results.
+   *
+   * Chunk bounds are passed to body as index type I, which is deduced 
+   * from end (begin is converted to it), so kernels instantiated with 
+   * either index width run with their own Index_type.
+   */
+  template <typename I, typename BODY>
+  void forallChunks(typename std::common_type<I>::type begin, I end, 
+                    BODY&& body)
+  {
+    if ( begin >= end ) {
+      return;
+    }
+    if ( num_threads == 1 ) {
+      body(begin, end, 0);
+      return;
+    }
+    ChunkJob<I, BODY> job(body);
+    dispatch(job, begin, end);
+  }
+
+  /*!
+   * \brief Execute body(i) for each i in [begin, end).
+   */
+  template <typename I, typename BODY>
+  void forall(typename std::common_type<I>::type begin, I end, 
+              BODY&& body)
+  {
+    forallChunks(begin, end,
+                 [&](I cbegin, I cend, int) {
+      for (I i = cbegin; i < cend; ++i) {
+        body(i);
+      }
+    });
+  }
+
+private:
+
+  //
+  // Chunks are stored with bounds of the widest index type and converted 
+  // back to the index type of the dispatching call when run.
+  //
+  struct Job
+  {
+    virtual ~Job() { }
+    virtual void run(long long cbegin, long long cend, int tid) = 0;
+  };
+
+  template <typename I, typename BODY>
+  struct ChunkJob : public Job
+  {
+    explicit ChunkJob(BODY& b) : body(b) { }
+    void run(long long cbegin, long long cend, int tid)
+    {
+      body(static_cast<I>(cbegin), static_cast<I>(cend), tid);
+    }
+    BODY& body;
+  };
+
+  struct Task
+  {
+    Job* job;
+    long long begin;
+    long long end;
+  };
+
+  struct WorkQueue
+  {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  void dispatch(Job& job, long long begin, long long end);
+
+  void workerLoop(int tid);
+
+  bool popTask(int tid, Task& task);
+  bool stealTask(int tid, Task& task);
+  bool runTask(int tid);
+
+  int num_threads;
+
+  std::vector<std::thread> workers;
+  std::vector< std::unique_ptr<WorkQueue> > queues;
+
+  std::atomic<int> pending;
+  std::atomic<unsigned> generation;
+  std::atomic<bool> stopping;
+
+  std::mutex wake_mutex;
+  std::condition_variable wake_cv;
+};
+
+/*!
+ * \brief Return the suite's thread pool; started by the Executor.
+ */
+ThreadPool& getThreadPool();
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
@@ -21,6 +21,7 @@
 #include "RAJA/RAJA.hpp"
 #include "RAJA/util/defines.hpp"
 
+#include <algorithm>
 #include <iostream>
 
 namespace rajaperf 
@@ -56,6 +57,24 @@ namespace lcals
   px[i + offset * 13] = cr - px[i + offset * 12]; \
   px[i + offset * 12] = cr;
 
+//
+// Prefetch entries of cx and px that DIFF_PREDICT_BODY uses in iteration 
+// j; entries of px it writes are prefetched for writing. *_Prefetch 
+// variants prefetch once per cache line of iterations.
+//
+#define DIFF_PREDICT_PREFETCH(j) \
+  RAJAPERF_PREFETCH(&cx[(j) + offset * 4]); \
+  RAJAPERF_PREFETCH_W(&px[(j) + offset *  4]); \
+  RAJAPERF_PREFETCH_W(&px[(j) + offset *  5]); \
+  RAJAPERF_PREFETCH_W(&px[(j) + offset *  6]); \
+  RAJAPERF_PREFETCH_W(&px[(j) + offset *  7]); \
+  RAJAPERF_PREFETCH_W(&px[(j) + offset *  8]); \
+  RAJAPERF_PREFETCH_W(&px[(j) + offset *  9]); \
+  RAJAPERF_PREFETCH_W(&px[(j) + offset * 10]); \
+  RAJAPERF_PREFETCH_W(&px[(j) + offset * 11]); \
+  RAJAPERF_PREFETCH_W(&px[(j) + offset * 12]); \
+  RAJAPERF_PREFETCH_W(&px[(j) + offset * 13]);
+
 
 #if defined(RAJA_ENABLE_CUDA)
 
@@ -91,18 +110,40 @@ __global__ void diff_predict(Real_ptr px, Real_ptr cx,
 #endif // if defined(RAJA_ENABLE_CUDA)
 
 
-DIFF_PREDICT::DIFF_PREDICT(const RunParams& params)
+template <typename REAL, typename INDEX>
+DIFF_PREDICT<REAL, INDEX>::DIFF_PREDICT(const RunParams& params)
   : KernelBase(rajaperf::Lcals_DIFF_PREDICT, params)
 {
    setDefaultSize(100000);
    setDefaultReps(2000);
+
+   setVariantDefined(Base_Seq_Prefetch);
+   setVariantDefined(RAJA_Seq_Prefetch);
+#if defined(RAJA_ENABLE_OPENMP)
+   setVariantDefined(Base_OpenMP_Prefetch);
+   setVariantDefined(RAJA_OpenMP_Prefetch);
+#endif
+}
+
+template <typename REAL, typename INDEX>
+DIFF_PREDICT<REAL, INDEX>::~DIFF_PREDICT() 
+{
+}
+
+template <typename REAL, typename INDEX>
+double DIFF_PREDICT<REAL, INDEX>::getBytesPerRep() const
+{
+  return 20.0 * sizeof(Real_type) * getRunSize();
 }
 
-DIFF_PREDICT::~DIFF_PREDICT() 
+template <typename REAL, typename INDEX>
+double DIFF_PREDICT<REAL, INDEX>::getFLOPsPerRep() const
 {
+  return 9.0 * getRunSize();
 }
 
-void DIFF_PREDICT::setUp(VariantID vid)
+template <typename REAL, typename INDEX>
+void DIFF_PREDICT<REAL, INDEX>::setUp(VariantID vid)
 {
   allocAndInitData(m_px, getRunSize()*14, vid);
   allocAndInitData(m_cx, getRunSize()*14, vid);
@@ -110,9 +151,10 @@ void DIFF_PREDICT::setUp(VariantID vid)
   m_offset = getRunSize();
 }
 
-void DIFF_PREDICT::runKernel(VariantID vid)
+template <typename REAL, typename INDEX>
+void DIFF_PREDICT<REAL, INDEX>::runKernel(VariantID vid)
 {
-  const Index_type run_reps = getRunReps();
+  const Index_type run_reps = getBatchReps();
   const Index_type ibegin = 0;
   const Index_type iend = getRunSize();
 
@@ -153,6 +195,120 @@ void DIFF_PREDICT::runKernel(VariantID vid)
       break;
     }
 
+    case Base_Simd : {
+
+      DIFF_PREDICT_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          DIFF_PREDICT_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Simd : {
+
+      DIFF_PREDICT_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          DIFF_PREDICT_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_Seq_Prefetch : {
+
+      DIFF_PREDICT_DATA;
+
+      const Index_type dist = getPrefetchDistance();
+      const Index_type line_len = 
+        RAJAPERF_CACHE_LINE_BYTES / sizeof(Real_type);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type ib = ibegin; ib < iend; ib += line_len ) {
+          if ( dist > 0 && ib + dist < iend ) {
+            DIFF_PREDICT_PREFETCH(ib + dist);
+          }
+          const Index_type ie = std::min(ib + line_len, iend);
+          RAJAPERF_SIMD
+          for (Index_type i = ib; i < ie; ++i ) {
+            DIFF_PREDICT_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq_Prefetch : {
+
+      DIFF_PREDICT_DATA;
+
+      const Index_type dist = getPrefetchDistance();
+      const Index_type line_len = 
+        RAJAPERF_CACHE_LINE_BYTES / sizeof(Real_type);
+      const Index_type nlines = (iend - ibegin + line_len - 1) / line_len;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(0, nlines), [=](Index_type il) {
+          const Index_type ib = ibegin + il * line_len;
+          if ( dist > 0 && ib + dist < iend ) {
+            DIFF_PREDICT_PREFETCH(ib + dist);
+          }
+          RAJA::forall<RAJA::simd_exec>(
+            RAJA::RangeSegment(ib, std::min(ib + line_len, iend)), 
+            [=](Index_type i) {
+            DIFF_PREDICT_BODY;
+          });
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_ThreadPool : {
+
+      DIFF_PREDICT_DATA;
+
+      ThreadPool& pool = getThreadPool();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        pool.forall(ibegin, iend, [=](Index_type i) {
+          DIFF_PREDICT_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
 #if defined(RAJA_ENABLE_OPENMP)
     case Base_OpenMP : {
 
@@ -191,6 +347,66 @@ void DIFF_PREDICT::runKernel(VariantID vid)
     }
 
 
+    case Base_OpenMP_Prefetch : {
+
+      DIFF_PREDICT_DATA;
+
+      const Index_type dist = getPrefetchDistance();
+      const Index_type line_len = 
+        RAJAPERF_CACHE_LINE_BYTES / sizeof(Real_type);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type ib = ibegin; ib < iend; ib += line_len ) {
+          if ( dist > 0 && ib + dist < iend ) {
+            DIFF_PREDICT_PREFETCH(ib + dist);
+          }
+          const Index_type ie = std::min(ib + line_len, iend);
+          RAJAPERF_SIMD
+          for (Index_type i = ib; i < ie; ++i ) {
+            DIFF_PREDICT_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP_Prefetch : {
+
+      DIFF_PREDICT_DATA;
+
+      const Index_type dist = getPrefetchDistance();
+      const Index_type line_len = 
+        RAJAPERF_CACHE_LINE_BYTES / sizeof(Real_type);
+      const Index_type nlines = (iend - ibegin + line_len - 1) / line_len;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nlines), [=](Index_type il) {
+          const Index_type ib = ibegin + il * line_len;
+          if ( dist > 0 && ib + dist < iend ) {
+            DIFF_PREDICT_PREFETCH(ib + dist);
+          }
+          RAJA::forall<RAJA::simd_exec>(
+            RAJA::RangeSegment(ib, std::min(ib + line_len, iend)), 
+            [=](Index_type i) {
+            DIFF_PREDICT_BODY;
+          });
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)                     
 
 #define NUMTEAMS 128
@@ -242,6 +458,46 @@ void DIFF_PREDICT::runKernel(VariantID vid)
 #endif //RAJA_ENABLE_TARGET_OPENMP
 #endif //RAJA_ENABLE_OMP    
 
+#if defined(RAJA_ENABLE_TBB)
+    case Base_TBB : {
+
+      DIFF_PREDICT_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(ibegin, iend),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            DIFF_PREDICT_BODY;
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_TBB : {
+
+      DIFF_PREDICT_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::tbb_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          DIFF_PREDICT_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
     case Base_CUDA : {
 
@@ -292,17 +548,21 @@ void DIFF_PREDICT::runKernel(VariantID vid)
 
 }
 
-void DIFF_PREDICT::updateChecksum(VariantID vid)
+template <typename REAL, typename INDEX>
+void DIFF_PREDICT<REAL, INDEX>::updateChecksum(VariantID vid)
 {
   checksum[vid] += calcChecksum(m_px, m_offset*14);
 }
 
-void DIFF_PREDICT::tearDown(VariantID vid)
+template <typename REAL, typename INDEX>
+void DIFF_PREDICT<REAL, INDEX>::tearDown(VariantID vid)
 {
   (void) vid;
   deallocData(m_px);
   deallocData(m_cx);
 }
 
+RAJAPERF_INSTANTIATE_KERNEL(DIFF_PREDICT);
+
 } // end namespace lcals
 } // end namespace rajaperf
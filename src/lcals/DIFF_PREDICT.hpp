@@ -26,14 +26,20 @@ class RunParams;
 namespace lcals
 {
 
+template <typename REAL, typename INDEX>
 class DIFF_PREDICT : public KernelBase
 {
 public:
+  RAJAPERF_REAL_TYPES(REAL);
+  RAJAPERF_INDEX_TYPES(INDEX);
 
   DIFF_PREDICT(const RunParams& params);
 
   ~DIFF_PREDICT();
 
+  double getBytesPerRep() const;
+  double getFLOPsPerRep() const;
+
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
   void updateChecksum(VariantID vid);
@@ -85,18 +85,33 @@ __global__ void eos(Real_ptr x, Real_ptr y, Real_ptr z, Real_ptr u,
 #endif // if defined(RAJA_ENABLE_CUDA)
 
 
-EOS::EOS(const RunParams& params)
+template <typename REAL, typename INDEX>
+EOS<REAL, INDEX>::EOS(const RunParams& params)
   : KernelBase(rajaperf::Lcals_EOS, params)
 {
    setDefaultSize(100000);
    setDefaultReps(5000);
 }
 
-EOS::~EOS() 
+template <typename REAL, typename INDEX>
+EOS<REAL, INDEX>::~EOS() 
 {
 }
 
-void EOS::setUp(VariantID vid)
+template <typename REAL, typename INDEX>
+double EOS<REAL, INDEX>::getBytesPerRep() const
+{
+  return 4.0 * sizeof(Real_type) * getRunSize();
+}
+
+template <typename REAL, typename INDEX>
+double EOS<REAL, INDEX>::getFLOPsPerRep() const
+{
+  return 16.0 * getRunSize();
+}
+
+template <typename REAL, typename INDEX>
+void EOS<REAL, INDEX>::setUp(VariantID vid)
 {
   allocAndInitData(m_x, getRunSize()+7, vid);
   allocAndInitData(m_y, getRunSize()+7, vid);
@@ -108,9 +123,10 @@ void EOS::setUp(VariantID vid)
   initData(m_t, vid);
 }
 
-void EOS::runKernel(VariantID vid)
+template <typename REAL, typename INDEX>
+void EOS<REAL, INDEX>::runKernel(VariantID vid)
 {
-  const Index_type run_reps = getRunReps();
+  const Index_type run_reps = getBatchReps();
   const Index_type ibegin = 0;
   const Index_type iend = getRunSize();
 
@@ -151,6 +167,61 @@ void EOS::runKernel(VariantID vid)
       break;
     }
 
+    case Base_Simd : {
+
+      EOS_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          EOS_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Simd : {
+
+      EOS_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          EOS_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_ThreadPool : {
+
+      EOS_DATA;
+
+      ThreadPool& pool = getThreadPool();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        pool.forall(ibegin, iend, [=](Index_type i) {
+          EOS_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
 #if defined(RAJA_ENABLE_OPENMP)
     case Base_OpenMP : {
 
@@ -242,6 +313,46 @@ void EOS::runKernel(VariantID vid)
 #endif //RAJA_ENABLE_TARGET_OPENMP
 #endif //RAJA_ENABLE_OMP                             
 
+#if defined(RAJA_ENABLE_TBB)
+    case Base_TBB : {
+
+      EOS_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(ibegin, iend),
+          [=](const tbb::blocked_range<Index_type>& range) {
+          for (Index_type i = range.begin(); i < range.end(); ++i ) {
+            EOS_BODY;
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_TBB : {
+
+      EOS_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::tbb_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          EOS_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
     case Base_CUDA : {
 
@@ -292,12 +403,14 @@ void EOS::runKernel(VariantID vid)
 
 }
 
-void EOS::updateChecksum(VariantID vid)
+template <typename REAL, typename INDEX>
+void EOS<REAL, INDEX>::updateChecksum(VariantID vid)
 {
   checksum[vid] += calcChecksum(m_x, getRunSize());
 }
 
-void EOS::tearDown(VariantID vid)
+template <typename REAL, typename INDEX>
+void EOS<REAL, INDEX>::tearDown(VariantID vid)
 {
   (void) vid;
   deallocData(m_x);
@@ -306,5 +419,7 @@ void EOS::tearDown(VariantID vid)
   deallocData(m_u);
 }
 
+RAJAPERF_INSTANTIATE_KERNEL(EOS);
+
 } // end namespace lcals
 } // end namespace rajaperf
@@ -67,26 +67,42 @@ __global__ void first_diff(Real_ptr x, Real_ptr y,
 #endif // if defined(RAJA_ENABLE_CUDA)
 
 
-FIRST_DIFF::FIRST_DIFF(const RunParams& params)
+template <typename REAL, typename INDEX>
+FIRST_DIFF<REAL, INDEX>::FIRST_DIFF(const RunParams& params)
   : KernelBase(rajaperf::Lcals_FIRST_DIFF, params)
 {
    setDefaultSize(100000);
    setDefaultReps(16000);
 }
 
-FIRST_DIFF::~FIRST_DIFF() 
+template <typename REAL, typename INDEX>
+FIRST_DIFF<REAL, INDEX>::~FIRST_DIFF() 
 {
 }
 
-void FIRST_DIFF::setUp(VariantID vid)
+template <typename REAL, typename INDEX>
+double FIRST_DIFF<REAL, INDEX>::getBytesPerRep() const
+{
+  return 2.0 * sizeof(Real_type) * getRunSize();
+}
+
+template <typename REAL, typename INDEX>
+double FIRST_DIFF<REAL, INDEX>::getFLOPsPerRep() const
+{
+  return 1.0 * getRunSize();
+}
+
+template <typename REAL, typename INDEX>
+void FIRST_DIFF<REAL, INDEX>::setUp(VariantID vid)
 {
   allocAndInitData(m_x, getRunSize()+1, vid);
   allocAndInitData(m_y, getRunSize()+1, vid);
 }
 
-void FIRST_DIFF::runKernel(VariantID vid)
+template <typename REAL, typename INDEX>
+void FIRST_DIFF<REAL, INDEX>::runKernel(VariantID vid)
 {
-  const Index_type run_reps = getRunReps();
+  const Index_type run_reps = getBatchReps();
   const Index_type ibegin = 0;
   const Index_type iend = getRunSize();
 
@@ -127,6 +143,61 @@ void FIRST_DIFF::runKernel(VariantID vid)
       break;
     }
 
+    case Base_Simd : {
+
+      FIRST_DIFF_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          FIRST_DIFF_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Simd : {
+
+      FIRST_DIFF_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          FIRST_DIFF_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_ThreadPool : {
+
+      FIRST_DIFF_DATA;
+
+      ThreadPool& pool = getThreadPool();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        pool.forall(ibegin, iend, [=](Index_type i) {
+          FIRST_DIFF_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
 #if defined(RAJA_ENABLE_OPENMP)
     case Base_OpenMP : {
 
@@ -219,6 +290,46 @@ void FIRST_DIFF::runKernel(VariantID vid)
 #endif //RAJA_ENABLE_TARGET_OPENMP
 #endif //RAJA_ENABLE_OMP                             
 
+#if defined(RAJA_ENABLE_TBB)
+    case Base_TBB : {
+
+      FIRST_DIFF_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(ibegin, iend),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            FIRST_DIFF_BODY;
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_TBB : {
+
+      FIRST_DIFF_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::tbb_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          FIRST_DIFF_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
     case Base_CUDA : {
 
@@ -268,17 +379,21 @@ void FIRST_DIFF::runKernel(VariantID vid)
 
 }
 
-void FIRST_DIFF::updateChecksum(VariantID vid)
+template <typename REAL, typename INDEX>
+void FIRST_DIFF<REAL, INDEX>::updateChecksum(VariantID vid)
 {
   checksum[vid] += calcChecksum(m_x, getRunSize());
 }
 
-void FIRST_DIFF::tearDown(VariantID vid)
+template <typename REAL, typename INDEX>
+void FIRST_DIFF<REAL, INDEX>::tearDown(VariantID vid)
 {
   (void) vid;
   deallocData(m_x);
   deallocData(m_y);
 }
 
+RAJAPERF_INSTANTIATE_KERNEL(FIRST_DIFF);
+
 } // end namespace lcals
 } // end namespace rajaperf
@@ -26,14 +26,20 @@ class RunParams;
 namespace lcals
 {
 
+template <typename REAL, typename INDEX>
 class FIRST_DIFF : public KernelBase
 {
 public:
+  RAJAPERF_REAL_TYPES(REAL);
+  RAJAPERF_INDEX_TYPES(INDEX);
 
   FIRST_DIFF(const RunParams& params);
 
   ~FIRST_DIFF();
 
+  double getBytesPerRep() const;
+  double getFLOPsPerRep() const;
+
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
   void updateChecksum(VariantID vid);
@@ -79,18 +79,33 @@ __global__ void hydro_1d(Real_ptr x, Real_ptr y, Real_ptr z,
 #endif // if defined(RAJA_ENABLE_CUDA)
 
 
-HYDRO_1D::HYDRO_1D(const RunParams& params)
+template <typename REAL, typename INDEX>
+HYDRO_1D<REAL, INDEX>::HYDRO_1D(const RunParams& params)
   : KernelBase(rajaperf::Lcals_HYDRO_1D, params)
 {
    setDefaultSize(100000);
    setDefaultReps(12500);
 }
 
-HYDRO_1D::~HYDRO_1D() 
+template <typename REAL, typename INDEX>
+HYDRO_1D<REAL, INDEX>::~HYDRO_1D() 
 {
 }
 
-void HYDRO_1D::setUp(VariantID vid)
+template <typename REAL, typename INDEX>
+double HYDRO_1D<REAL, INDEX>::getBytesPerRep() const
+{
+  return 3.0 * sizeof(Real_type) * getRunSize();
+}
+
+template <typename REAL, typename INDEX>
+double HYDRO_1D<REAL, INDEX>::getFLOPsPerRep() const
+{
+  return 5.0 * getRunSize();
+}
+
+template <typename REAL, typename INDEX>
+void HYDRO_1D<REAL, INDEX>::setUp(VariantID vid)
 {
   allocAndInitData(m_x, getRunSize()+12, vid);
   allocAndInitData(m_y, getRunSize()+12, vid);
@@ -101,9 +116,10 @@ void HYDRO_1D::setUp(VariantID vid)
   initData(m_t, vid);
 }
 
-void HYDRO_1D::runKernel(VariantID vid)
+template <typename REAL, typename INDEX>
+void HYDRO_1D<REAL, INDEX>::runKernel(VariantID vid)
 {
-  const Index_type run_reps = getRunReps();
+  const Index_type run_reps = getBatchReps();
   const Index_type ibegin = 0;
   const Index_type iend = getRunSize();
 
@@ -144,6 +160,61 @@ void HYDRO_1D::runKernel(VariantID vid)
       break;
     }
 
+    case Base_Simd : {
+
+      HYDRO_1D_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          HYDRO_1D_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Simd : {
+
+      HYDRO_1D_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          HYDRO_1D_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_ThreadPool : {
+
+      HYDRO_1D_DATA;
+
+      ThreadPool& pool = getThreadPool();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        pool.forall(ibegin, iend, [=](Index_type i) {
+          HYDRO_1D_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
 #if defined(RAJA_ENABLE_OPENMP)
     case Base_OpenMP : {
 
@@ -236,6 +307,47 @@ void HYDRO_1D::runKernel(VariantID vid)
 #endif //RAJA_ENABLE_OMP                             
 
 
+#if defined(RAJA_ENABLE_TBB)
+    case Base_TBB : {
+
+      HYDRO_1D_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(ibegin, iend),
+          [=](const tbb::blocked_range<Index_type>& range) {
+          for (Index_type i = range.begin(); i < range.end(); ++i ) {
+            HYDRO_1D_BODY;
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_TBB : {
+
+      HYDRO_1D_DATA;
+      
+      startTimer();
+
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::tbb_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          HYDRO_1D_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
     case Base_CUDA : {
 
@@ -286,12 +398,14 @@ void HYDRO_1D::runKernel(VariantID vid)
 
 }
 
-void HYDRO_1D::updateChecksum(VariantID vid)
+template <typename REAL, typename INDEX>
+void HYDRO_1D<REAL, INDEX>::updateChecksum(VariantID vid)
 {
   checksum[vid] += calcChecksum(m_x, getRunSize());
 }
 
-void HYDRO_1D::tearDown(VariantID vid)
+template <typename REAL, typename INDEX>
+void HYDRO_1D<REAL, INDEX>::tearDown(VariantID vid)
 {
   (void) vid;
   deallocData(m_x);
@@ -299,5 +413,7 @@ void HYDRO_1D::tearDown(VariantID vid)
   deallocData(m_z);
 }
 
+RAJAPERF_INSTANTIATE_KERNEL(HYDRO_1D);
+
 } // end namespace lcals
 } // end namespace rajaperf
@@ -26,14 +26,20 @@ class RunParams;
 namespace lcals
 {
 
+template <typename REAL, typename INDEX>
 class HYDRO_1D : public KernelBase
 {
 public:
+  RAJAPERF_REAL_TYPES(REAL);
+  RAJAPERF_INDEX_TYPES(INDEX);
 
   HYDRO_1D(const RunParams& params);
 
   ~HYDRO_1D();
 
+  double getBytesPerRep() const;
+  double getFLOPsPerRep() const;
+
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
   void updateChecksum(VariantID vid);
@@ -20,6 +20,7 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
 
 namespace rajaperf 
@@ -47,6 +48,24 @@ namespace lcals
           c0*( px[i + offset *  4] + px[i + offset *  5] ) + \
           px[i + offset *  2]; 
 
+//
+// Prefetch entries of px that INT_PREDICT_BODY reads and writes in 
+// iteration j. *_Prefetch variants prefetch once per cache line of 
+// iterations, since each stream is contiguous in i.
+//
+#define INT_PREDICT_PREFETCH(j) \
+  RAJAPERF_PREFETCH_W(&px[(j)]); \
+  RAJAPERF_PREFETCH(&px[(j) + offset *  2]); \
+  RAJAPERF_PREFETCH(&px[(j) + offset *  4]); \
+  RAJAPERF_PREFETCH(&px[(j) + offset *  5]); \
+  RAJAPERF_PREFETCH(&px[(j) + offset *  6]); \
+  RAJAPERF_PREFETCH(&px[(j) + offset *  7]); \
+  RAJAPERF_PREFETCH(&px[(j) + offset *  8]); \
+  RAJAPERF_PREFETCH(&px[(j) + offset *  9]); \
+  RAJAPERF_PREFETCH(&px[(j) + offset * 10]); \
+  RAJAPERF_PREFETCH(&px[(j) + offset * 11]); \
+  RAJAPERF_PREFETCH(&px[(j) + offset * 12]);
+
 
 #if defined(RAJA_ENABLE_CUDA)
 
@@ -90,18 +109,40 @@ __global__ void int_predict(Real_ptr px,
 #endif // if defined(RAJA_ENABLE_CUDA)
 
 
-INT_PREDICT::INT_PREDICT(const RunParams& params)
+template <typename REAL, typename INDEX>
+INT_PREDICT<REAL, INDEX>::INT_PREDICT(const RunParams& params)
   : KernelBase(rajaperf::Lcals_INT_PREDICT, params)
 {
    setDefaultSize(100000);
    setDefaultReps(4000);
+
+   setVariantDefined(Base_Seq_Prefetch);
+   setVariantDefined(RAJA_Seq_Prefetch);
+#if defined(RAJA_ENABLE_OPENMP)
+   setVariantDefined(Base_OpenMP_Prefetch);
+   setVariantDefined(RAJA_OpenMP_Prefetch);
+#endif
+}
+
+template <typename REAL, typename INDEX>
+INT_PREDICT<REAL, INDEX>::~INT_PREDICT() 
+{
+}
+
+template <typename REAL, typename INDEX>
+double INT_PREDICT<REAL, INDEX>::getBytesPerRep() const
+{
+  return 11.0 * sizeof(Real_type) * getRunSize();
 }
 
-INT_PREDICT::~INT_PREDICT() 
+template <typename REAL, typename INDEX>
+double INT_PREDICT<REAL, INDEX>::getFLOPsPerRep() const
 {
+  return 17.0 * getRunSize();
 }
 
-void INT_PREDICT::setUp(VariantID vid)
+template <typename REAL, typename INDEX>
+void INT_PREDICT<REAL, INDEX>::setUp(VariantID vid)
 {
   allocAndInitData(m_px, getRunSize()*13, vid);
 
@@ -117,9 +158,10 @@ void INT_PREDICT::setUp(VariantID vid)
   m_offset = getRunSize();
 }
 
-void INT_PREDICT::runKernel(VariantID vid)
+template <typename REAL, typename INDEX>
+void INT_PREDICT<REAL, INDEX>::runKernel(VariantID vid)
 {
-  const Index_type run_reps = getRunReps();
+  const Index_type run_reps = getBatchReps();
   const Index_type ibegin = 0;
   const Index_type iend = getRunSize();
 
@@ -160,6 +202,120 @@ void INT_PREDICT::runKernel(VariantID vid)
       break;
     }
 
+    case Base_Simd : {
+
+      INT_PREDICT_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          INT_PREDICT_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Simd : {
+
+      INT_PREDICT_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) { 
+          INT_PREDICT_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_Seq_Prefetch : {
+
+      INT_PREDICT_DATA;
+
+      const Index_type dist = getPrefetchDistance();
+      const Index_type line_len = 
+        RAJAPERF_CACHE_LINE_BYTES / sizeof(Real_type);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type ib = ibegin; ib < iend; ib += line_len ) {
+          if ( dist > 0 && ib + dist < iend ) {
+            INT_PREDICT_PREFETCH(ib + dist);
+          }
+          const Index_type ie = std::min(ib + line_len, iend);
+          RAJAPERF_SIMD
+          for (Index_type i = ib; i < ie; ++i ) {
+            INT_PREDICT_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq_Prefetch : {
+
+      INT_PREDICT_DATA;
+
+      const Index_type dist = getPrefetchDistance();
+      const Index_type line_len = 
+        RAJAPERF_CACHE_LINE_BYTES / sizeof(Real_type);
+      const Index_type nlines = (iend - ibegin + line_len - 1) / line_len;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(0, nlines), [=](Index_type il) {
+          const Index_type ib = ibegin + il * line_len;
+          if ( dist > 0 && ib + dist < iend ) {
+            INT_PREDICT_PREFETCH(ib + dist);
+          }
+          RAJA::forall<RAJA::simd_exec>(
+            RAJA::RangeSegment(ib, std::min(ib + line_len, iend)), 
+            [=](Index_type i) {
+            INT_PREDICT_BODY;
+          });
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_ThreadPool : {
+
+      INT_PREDICT_DATA;
+
+      ThreadPool& pool = getThreadPool();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        pool.forall(ibegin, iend, [=](Index_type i) {
+          INT_PREDICT_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
 #if defined(RAJA_ENABLE_OPENMP)
     case Base_OpenMP : {
 
@@ -197,6 +353,66 @@ void INT_PREDICT::runKernel(VariantID vid)
       break;
     }
 
+    case Base_OpenMP_Prefetch : {
+
+      INT_PREDICT_DATA;
+
+      const Index_type dist = getPrefetchDistance();
+      const Index_type line_len = 
+        RAJAPERF_CACHE_LINE_BYTES / sizeof(Real_type);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type ib = ibegin; ib < iend; ib += line_len ) {
+          if ( dist > 0 && ib + dist < iend ) {
+            INT_PREDICT_PREFETCH(ib + dist);
+          }
+          const Index_type ie = std::min(ib + line_len, iend);
+          RAJAPERF_SIMD
+          for (Index_type i = ib; i < ie; ++i ) {
+            INT_PREDICT_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP_Prefetch : {
+
+      INT_PREDICT_DATA;
+
+      const Index_type dist = getPrefetchDistance();
+      const Index_type line_len = 
+        RAJAPERF_CACHE_LINE_BYTES / sizeof(Real_type);
+      const Index_type nlines = (iend - ibegin + line_len - 1) / line_len;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nlines), [=](Index_type il) {
+          const Index_type ib = ibegin + il * line_len;
+          if ( dist > 0 && ib + dist < iend ) {
+            INT_PREDICT_PREFETCH(ib + dist);
+          }
+          RAJA::forall<RAJA::simd_exec>(
+            RAJA::RangeSegment(ib, std::min(ib + line_len, iend)), 
+            [=](Index_type i) {
+            INT_PREDICT_BODY;
+          });
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
 
 #define NUMTEAMS 128
@@ -250,6 +466,46 @@ void INT_PREDICT::runKernel(VariantID vid)
 #endif //RAJA_ENABLE_TARGET_OPENMP
 #endif //RAJA_ENABLE_OMP                             
 
+#if defined(RAJA_ENABLE_TBB)
+    case Base_TBB : {
+
+      INT_PREDICT_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(ibegin, iend),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            INT_PREDICT_BODY;
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_TBB : {
+
+      INT_PREDICT_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::tbb_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          INT_PREDICT_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
     case Base_CUDA : {
 
@@ -302,16 +558,20 @@ void INT_PREDICT::runKernel(VariantID vid)
 
 }
 
-void INT_PREDICT::updateChecksum(VariantID vid)
+template <typename REAL, typename INDEX>
+void INT_PREDICT<REAL, INDEX>::updateChecksum(VariantID vid)
 {
   checksum[vid] += calcChecksum(m_px, m_offset*13);
 }
 
-void INT_PREDICT::tearDown(VariantID vid)
+template <typename REAL, typename INDEX>
+void INT_PREDICT<REAL, INDEX>::tearDown(VariantID vid)
 {
   (void) vid;
   deallocData(m_px);
 }
 
+RAJAPERF_INSTANTIATE_KERNEL(INT_PREDICT);
+
 } // end namespace lcals
 } // end namespace rajaperf
@@ -26,14 +26,20 @@ class RunParams;
 namespace lcals
 {
 
+template <typename REAL, typename INDEX>
 class INT_PREDICT : public KernelBase
 {
 public:
+  RAJAPERF_REAL_TYPES(REAL);
+  RAJAPERF_INDEX_TYPES(INDEX);
 
   INT_PREDICT(const RunParams& params);
 
   ~INT_PREDICT();
 
+  double getBytesPerRep() const;
+  double getFLOPsPerRep() const;
+
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
   void updateChecksum(VariantID vid);
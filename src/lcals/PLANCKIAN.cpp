@@ -37,7 +37,7 @@ namespace lcals
 
 #define PLANCKIAN_BODY  \
   y[i] = u[i] / v[i]; \
-  w[i] = x[i] / ( exp( y[i] ) - 1.0 );
+  w[i] = x[i] / ( exp( y[i] ) - Real_type(1.0) );
 
 
 #if defined(RAJA_ENABLE_CUDA)
@@ -82,18 +82,33 @@ __global__ void planckian(Real_ptr x, Real_ptr y,
 #endif // if defined(RAJA_ENABLE_CUDA)
 
 
-PLANCKIAN::PLANCKIAN(const RunParams& params)
+template <typename REAL, typename INDEX>
+PLANCKIAN<REAL, INDEX>::PLANCKIAN(const RunParams& params)
   : KernelBase(rajaperf::Lcals_PLANCKIAN, params)
 {
    setDefaultSize(100000);
    setDefaultReps(460);
 }
 
-PLANCKIAN::~PLANCKIAN() 
+template <typename REAL, typename INDEX>
+PLANCKIAN<REAL, INDEX>::~PLANCKIAN() 
 {
 }
 
-void PLANCKIAN::setUp(VariantID vid)
+template <typename REAL, typename INDEX>
+double PLANCKIAN<REAL, INDEX>::getBytesPerRep() const
+{
+  return 5.0 * sizeof(Real_type) * getRunSize();
+}
+
+template <typename REAL, typename INDEX>
+double PLANCKIAN<REAL, INDEX>::getFLOPsPerRep() const
+{
+  return 4.0 * getRunSize();
+}
+
+template <typename REAL, typename INDEX>
+void PLANCKIAN<REAL, INDEX>::setUp(VariantID vid)
 {
   allocAndInitData(m_x, getRunSize(), vid);
   allocAndInitData(m_y, getRunSize(), vid);
@@ -102,9 +117,10 @@ void PLANCKIAN::setUp(VariantID vid)
   allocAndInitData(m_w, getRunSize(), vid);
 }
 
-void PLANCKIAN::runKernel(VariantID vid)
+template <typename REAL, typename INDEX>
+void PLANCKIAN<REAL, INDEX>::runKernel(VariantID vid)
 {
-  const Index_type run_reps = getRunReps();
+  const Index_type run_reps = getBatchReps();
   const Index_type ibegin = 0;
   const Index_type iend = getRunSize();
 
@@ -145,6 +161,61 @@ void PLANCKIAN::runKernel(VariantID vid)
       break;
     }
 
+    case Base_Simd : {
+
+      PLANCKIAN_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          PLANCKIAN_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Simd : {
+
+      PLANCKIAN_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          PLANCKIAN_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_ThreadPool : {
+
+      PLANCKIAN_DATA;
+
+      ThreadPool& pool = getThreadPool();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        pool.forall(ibegin, iend, [=](Index_type i) {
+          PLANCKIAN_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
 #if defined(RAJA_ENABLE_OPENMP)
     case Base_OpenMP : {
 
@@ -236,6 +307,46 @@ void PLANCKIAN::runKernel(VariantID vid)
 #endif //RAJA_ENABLE_TARGET_OPENMP
 #endif //RAJA_ENABLE_OMP                             
 
+#if defined(RAJA_ENABLE_TBB)
+    case Base_TBB : {
+
+      PLANCKIAN_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(ibegin, iend),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            PLANCKIAN_BODY;
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_TBB : {
+
+      PLANCKIAN_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::tbb_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          PLANCKIAN_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
     case Base_CUDA : {
 
@@ -286,12 +397,14 @@ void PLANCKIAN::runKernel(VariantID vid)
 
 }
 
-void PLANCKIAN::updateChecksum(VariantID vid)
+template <typename REAL, typename INDEX>
+void PLANCKIAN<REAL, INDEX>::updateChecksum(VariantID vid)
 {
   checksum[vid] += calcChecksum(m_w, getRunSize());
 }
 
-void PLANCKIAN::tearDown(VariantID vid)
+template <typename REAL, typename INDEX>
+void PLANCKIAN<REAL, INDEX>::tearDown(VariantID vid)
 {
   (void) vid;
   deallocData(m_x);
@@ -301,5 +414,7 @@ void PLANCKIAN::tearDown(VariantID vid)
   deallocData(m_w);
 }
 
+RAJAPERF_INSTANTIATE_KERNEL(PLANCKIAN);
+
 } // end namespace lcals
 } // end namespace rajaperf
@@ -38,6 +38,7 @@
 
 
 #include "POLYBENCH_2MM.hpp"
+#include "PolybenchData.hpp"
 
 #include "RAJA/RAJA.hpp"
 #include "RAJA/util/defines.hpp"
@@ -45,6 +46,7 @@
 
 #include <iostream>
 #include <cstring>
+#include <algorithm>
 
 
 namespace rajaperf 
@@ -145,7 +147,8 @@ __global__ void polybench_2mm_cuda_2(Real_ptr tmp, Real_ptr A,
 
 #endif // if defined(RAJA_ENABLE_CUDA)
   
-POLYBENCH_2MM::POLYBENCH_2MM(const RunParams& params)
+template <typename REAL, typename INDEX>
+POLYBENCH_2MM<REAL, INDEX>::POLYBENCH_2MM(const RunParams& params)
   : KernelBase(rajaperf::Polybench_2MM, params)
 {
   m_alpha = 1.5;
@@ -181,6 +184,13 @@ POLYBENCH_2MM::POLYBENCH_2MM(const RunParams& params)
   setDefaultSize( m_ni*m_nj*(1+m_nk) + m_ni*m_nl*(1+m_nj) );
   setDefaultReps(m_run_reps);
 
+  setVariantDefined(Base_Seq_Tiled);
+  setVariantDefined(RAJA_Seq_Tiled);
+#if defined(RAJA_ENABLE_OPENMP)
+  setVariantDefined(Base_OpenMP_Tiled);
+  setVariantDefined(RAJA_OpenMP_Tiled);
+#endif
+
   allocAndInitData(m_tmp, m_ni * m_nj);
   allocAndInitData(m_A, m_ni * m_nk);
   allocAndInitData(m_B, m_nk * m_nj);
@@ -191,7 +201,8 @@ POLYBENCH_2MM::POLYBENCH_2MM(const RunParams& params)
 
 }
 
-POLYBENCH_2MM::~POLYBENCH_2MM() 
+template <typename REAL, typename INDEX>
+POLYBENCH_2MM<REAL, INDEX>::~POLYBENCH_2MM() 
 {
   deallocData(m_tmp);
   deallocData(m_A);
@@ -201,14 +212,40 @@ POLYBENCH_2MM::~POLYBENCH_2MM()
   deallocData(m_DD);
 }
 
-void POLYBENCH_2MM::setUp(VariantID vid)
+template <typename REAL, typename INDEX>
+double POLYBENCH_2MM<REAL, INDEX>::getBytesPerRep() const
+{
+  const double ni = m_ni;
+  const double nj = m_nj;
+  const double nk = m_nk;
+  const double nl = m_nl;
+
+  return ( ni*nk + nk*nj + nj*nl +   // A, B, C
+           2.0*ni*nj +               // tmp (written and read)
+           2.0*ni*nl ) * sizeof(Real_type);   // D (read and written)
+}
+
+template <typename REAL, typename INDEX>
+double POLYBENCH_2MM<REAL, INDEX>::getFLOPsPerRep() const
+{
+  const double ni = m_ni;
+  const double nj = m_nj;
+  const double nk = m_nk;
+  const double nl = m_nl;
+
+  return 3.0*ni*nj*nk + ni*nl + 2.0*ni*nl*nj;
+}
+
+template <typename REAL, typename INDEX>
+void POLYBENCH_2MM<REAL, INDEX>::setUp(VariantID vid)
 {
   (void) vid;
 }
 
-void POLYBENCH_2MM::runKernel(VariantID vid)
+template <typename REAL, typename INDEX>
+void POLYBENCH_2MM<REAL, INDEX>::runKernel(VariantID vid)
 {
-  const Index_type run_reps= getRunReps();
+  const Index_type run_reps= getBatchReps();
   const Index_type ni = m_ni;
   const Index_type nj = m_nj;
   const Index_type nk = m_nk;
@@ -260,12 +297,12 @@ void POLYBENCH_2MM::runKernel(VariantID vid)
                                                         RAJA::seq_exec>>> (
           RAJA::RangeSegment{0, ni}, 
           RAJA::RangeSegment{0, nj}, 
-          [=] (int i, int j) {
+          [=] (Index_type i, Index_type j) {
 
             POLYBENCH_2MM_BODY1;
 
             RAJA::forall<RAJA::seq_exec> (
-              RAJA::RangeSegment{0, nk}, [=] (int k) {
+              RAJA::RangeSegment{0, nk}, [=] (Index_type k) {
               POLYBENCH_2MM_BODY2; 
             });
 
@@ -277,12 +314,12 @@ void POLYBENCH_2MM::runKernel(VariantID vid)
                                                           RAJA::seq_exec>>> (
             RAJA::RangeSegment{0, ni}, 
             RAJA::RangeSegment{0, nl}, 
-            [=] (int i, int l) {
+            [=] (Index_type i, Index_type l) {
 
               POLYBENCH_2MM_BODY3;
 
               RAJA::forall<RAJA::seq_exec> (
-                RAJA::RangeSegment{0, nj}, [=] (int j) {
+                RAJA::RangeSegment{0, nj}, [=] (Index_type j) {
                 POLYBENCH_2MM_BODY4;
               });
           });
@@ -293,6 +330,227 @@ void POLYBENCH_2MM::runKernel(VariantID vid)
       break;
     }
 
+    case Base_Simd : {
+
+      POLYBENCH_2MM_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        //
+        // Innermost loops accumulate into one entry, so the loops around
+        // them are vectorized.
+        //
+        for (Index_type i = 0; i < ni; i++ ) { 
+          RAJAPERF_SIMD
+          for (Index_type j = 0; j < nj; j++) {
+            POLYBENCH_2MM_BODY1;
+            for (Index_type k = 0; k < nk; k++) {
+              POLYBENCH_2MM_BODY2;
+            }
+          }
+        }
+
+        memcpy(m_D,m_DD,m_ni * m_nl * sizeof(Real_type));
+
+        for (Index_type i = 0; i < ni; i++) {
+          RAJAPERF_SIMD
+          for (Index_type l = 0; l < nl; l++) {
+            POLYBENCH_2MM_BODY3;
+            for (Index_type j = 0; j < nj; j++) {
+              POLYBENCH_2MM_BODY4;
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Simd : {
+
+      POLYBENCH_2MM_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {      
+
+        RAJA::forallN<RAJA::NestedPolicy<RAJA::ExecList<RAJA::seq_exec,
+                                                        RAJA::simd_exec>>> (
+          RAJA::RangeSegment{0, ni}, 
+          RAJA::RangeSegment{0, nj}, 
+          [=] (Index_type i, Index_type j) {
+
+            POLYBENCH_2MM_BODY1;
+
+            RAJA::forall<RAJA::seq_exec> (
+              RAJA::RangeSegment{0, nk}, [=] (Index_type k) {
+              POLYBENCH_2MM_BODY2; 
+            });
+
+          });
+
+          memcpy(m_D,m_DD,m_ni * m_nl * sizeof(Real_type));
+
+          RAJA::forallN<RAJA::NestedPolicy<RAJA::ExecList<RAJA::seq_exec,
+                                                          RAJA::simd_exec>>> (
+            RAJA::RangeSegment{0, ni}, 
+            RAJA::RangeSegment{0, nl}, 
+            [=] (Index_type i, Index_type l) {
+
+              POLYBENCH_2MM_BODY3;
+
+              RAJA::forall<RAJA::seq_exec> (
+                RAJA::RangeSegment{0, nj}, [=] (Index_type j) {
+                POLYBENCH_2MM_BODY4;
+              });
+          });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_Seq_Tiled : {
+
+      POLYBENCH_2MM_DATA;
+      POLYBENCH_TILE_SIZES;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < ni; i++ ) { 
+          for (Index_type j = 0; j < nj; j++) {
+            POLYBENCH_2MM_BODY1;
+          }
+        }
+
+        for (Index_type it = 0; it < ni; it += ti) {
+          for (Index_type jt = 0; jt < nj; jt += tj) {
+            for (Index_type kt = 0; kt < nk; kt += tk) {
+              for (Index_type i = it; i < std::min(it + ti, ni); i++) {
+                for (Index_type k = kt; k < std::min(kt + tk, nk); k++) {
+                  for (Index_type j = jt; j < std::min(jt + tj, nj); j++) {
+                    POLYBENCH_2MM_BODY2;
+                  }
+                }
+              }
+            }
+          }
+        }
+
+        memcpy(m_D,m_DD,m_ni * m_nl * sizeof(Real_type));
+
+        for (Index_type i = 0; i < ni; i++) {
+          for (Index_type l = 0; l < nl; l++) {
+            POLYBENCH_2MM_BODY3;
+          }
+        }
+
+        for (Index_type it = 0; it < ni; it += ti) {
+          for (Index_type lt = 0; lt < nl; lt += tj) {
+            for (Index_type jt = 0; jt < nj; jt += tk) {
+              for (Index_type i = it; i < std::min(it + ti, ni); i++) {
+                for (Index_type j = jt; j < std::min(jt + tk, nj); j++) {
+                  for (Index_type l = lt; l < std::min(lt + tj, nl); l++) {
+                    POLYBENCH_2MM_BODY4;
+                  }
+                }
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq_Tiled : {
+
+      POLYBENCH_2MM_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {      
+
+        RAJA::forallN<RAJA::NestedPolicy<RAJA::ExecList<RAJA::seq_exec,
+                                                        RAJA::seq_exec>>> (
+          RAJA::RangeSegment{0, ni}, 
+          RAJA::RangeSegment{0, nj}, 
+          [=] (Index_type i, Index_type j) {
+          POLYBENCH_2MM_BODY1;
+        });
+
+        RAJA::forallN<TiledMatMulPolicy<RAJA::seq_exec>> (
+          RAJA::RangeSegment{0, ni}, 
+          RAJA::RangeSegment{0, nj}, 
+          RAJA::RangeSegment{0, nk}, 
+          [=] (Index_type i, Index_type j, Index_type k) {
+          POLYBENCH_2MM_BODY2;
+        });
+
+        memcpy(m_D,m_DD,m_ni * m_nl * sizeof(Real_type));
+
+        RAJA::forallN<RAJA::NestedPolicy<RAJA::ExecList<RAJA::seq_exec,
+                                                        RAJA::seq_exec>>> (
+          RAJA::RangeSegment{0, ni}, 
+          RAJA::RangeSegment{0, nl}, 
+          [=] (Index_type i, Index_type l) {
+          POLYBENCH_2MM_BODY3;
+        });
+
+        RAJA::forallN<TiledMatMulPolicy<RAJA::seq_exec>> (
+          RAJA::RangeSegment{0, ni}, 
+          RAJA::RangeSegment{0, nl}, 
+          RAJA::RangeSegment{0, nj}, 
+          [=] (Index_type i, Index_type l, Index_type j) {
+          POLYBENCH_2MM_BODY4;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_ThreadPool : {
+
+      POLYBENCH_2MM_DATA;
+
+      ThreadPool& pool = getThreadPool();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        pool.forall(0, ni, [=](Index_type i) {
+          for (Index_type j = 0; j < nj; j++) {
+            POLYBENCH_2MM_BODY1;
+            for (Index_type k = 0; k < nk; k++) {
+              POLYBENCH_2MM_BODY2;
+            }
+          }
+        });
+
+        memcpy(m_D,m_DD,m_ni * m_nl * sizeof(Real_type));
+
+        pool.forall(0, ni, [=](Index_type i) {
+          for (Index_type l = 0; l < nl; l++) {
+            POLYBENCH_2MM_BODY3;
+            for (Index_type j = 0; j < nj; j++) {
+              POLYBENCH_2MM_BODY4;
+            }
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
 #if defined(RAJA_ENABLE_OPENMP)      
     case Base_OpenMP : {
 
@@ -340,12 +598,12 @@ void POLYBENCH_2MM::runKernel(VariantID vid)
                                                         RAJA::seq_exec>>> (
           RAJA::RangeSegment{0, ni}, 
           RAJA::RangeSegment{0, nj}, 
-          [=] (int i, int j) {
+          [=] (Index_type i, Index_type j) {
 
             POLYBENCH_2MM_BODY1;
 
             RAJA::forall<RAJA::seq_exec> (
-              RAJA::RangeSegment{0, nk}, [=] (int k) {
+              RAJA::RangeSegment{0, nk}, [=] (Index_type k) {
               POLYBENCH_2MM_BODY2; 
             });
 
@@ -357,12 +615,12 @@ void POLYBENCH_2MM::runKernel(VariantID vid)
                                                         RAJA::seq_exec>>> (
           RAJA::RangeSegment{0, ni}, 
           RAJA::RangeSegment{0, nl}, 
-          [=] (int i, int l) {
+          [=] (Index_type i, Index_type l) {
 
           POLYBENCH_2MM_BODY3;
 
           RAJA::forall<RAJA::seq_exec> (
-            RAJA::RangeSegment{0, nj}, [=] (int j) {
+            RAJA::RangeSegment{0, nj}, [=] (Index_type j) {
             POLYBENCH_2MM_BODY4;
           });
 
@@ -374,6 +632,125 @@ void POLYBENCH_2MM::runKernel(VariantID vid)
       break;
     }
 
+    case Base_OpenMP_Tiled : {
+
+      POLYBENCH_2MM_DATA;
+      POLYBENCH_TILE_SIZES;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < ni; i++ ) { 
+          for (Index_type j = 0; j < nj; j++) {
+            POLYBENCH_2MM_BODY1;
+          }
+        }
+
+        #pragma omp parallel for collapse(2)
+        for (Index_type it = 0; it < ni; it += ti) {
+          for (Index_type jt = 0; jt < nj; jt += tj) {
+            for (Index_type kt = 0; kt < nk; kt += tk) {
+              for (Index_type i = it; i < std::min(it + ti, ni); i++) {
+                for (Index_type k = kt; k < std::min(kt + tk, nk); k++) {
+                  for (Index_type j = jt; j < std::min(jt + tj, nj); j++) {
+                    POLYBENCH_2MM_BODY2;
+                  }
+                }
+              }
+            }
+          }
+        }
+
+        memcpy(m_D,m_DD,m_ni * m_nl * sizeof(Real_type));
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < ni; i++) {
+          for (Index_type l = 0; l < nl; l++) {
+            POLYBENCH_2MM_BODY3;
+          }
+        }
+
+        #pragma omp parallel for collapse(2)
+        for (Index_type it = 0; it < ni; it += ti) {
+          for (Index_type lt = 0; lt < nl; lt += tj) {
+            for (Index_type jt = 0; jt < nj; jt += tk) {
+              for (Index_type i = it; i < std::min(it + ti, ni); i++) {
+                for (Index_type j = jt; j < std::min(jt + tk, nj); j++) {
+                  for (Index_type l = lt; l < std::min(lt + tj, nl); l++) {
+                    POLYBENCH_2MM_BODY4;
+                  }
+                }
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP_Tiled : {
+
+      POLYBENCH_2MM_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        //
+        // RAJA tile loops run sequentially, so each product runs as a 
+        // parallel loop over tiles of rows, and each tile of rows runs the 
+        // tiled loop nest sequentially. Each entry of the product is 
+        // computed by one thread, and a product takes one parallel region.
+        //
+        RAJA::forallN<RAJA::NestedPolicy<RAJA::ExecList<RAJA::omp_parallel_for_exec,
+                                                        RAJA::seq_exec>>> (
+          RAJA::RangeSegment{0, ni}, 
+          RAJA::RangeSegment{0, nj}, 
+          [=] (Index_type i, Index_type j) {
+          POLYBENCH_2MM_BODY1;
+        });
+
+        RAJA::forall<RAJA::omp_parallel_for_exec> (
+          RAJA::RangeSegment{0, getNumRAJATiles(ni)}, [=] (Index_type t) {
+          RAJA::forallN<TiledMatMulPolicy<RAJA::seq_exec>> (
+            getRAJATileSegment(t, ni), 
+            RAJA::RangeSegment{0, nj}, 
+            RAJA::RangeSegment{0, nk}, 
+            [=] (Index_type i, Index_type j, Index_type k) {
+            POLYBENCH_2MM_BODY2;
+          });
+        });
+
+        memcpy(m_D,m_DD,m_ni * m_nl * sizeof(Real_type));
+
+        RAJA::forallN<RAJA::NestedPolicy<RAJA::ExecList<RAJA::omp_parallel_for_exec,
+                                                        RAJA::seq_exec>>> (
+          RAJA::RangeSegment{0, ni}, 
+          RAJA::RangeSegment{0, nl}, 
+          [=] (Index_type i, Index_type l) {
+          POLYBENCH_2MM_BODY3;
+        });
+
+        RAJA::forall<RAJA::omp_parallel_for_exec> (
+          RAJA::RangeSegment{0, getNumRAJATiles(ni)}, [=] (Index_type t) {
+          RAJA::forallN<TiledMatMulPolicy<RAJA::seq_exec>> (
+            getRAJATileSegment(t, ni), 
+            RAJA::RangeSegment{0, nl}, 
+            RAJA::RangeSegment{0, nj}, 
+            [=] (Index_type i, Index_type l, Index_type j) {
+            POLYBENCH_2MM_BODY4;
+          });
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)                     
 
 #define NUMTEAMS 128
@@ -464,6 +841,92 @@ void POLYBENCH_2MM::runKernel(VariantID vid)
 #endif //RAJA_ENABLE_TARGET_OPENMP
 #endif //RAJA_ENABLE_OMP                             
 
+#if defined(RAJA_ENABLE_TBB)
+    case Base_TBB : {
+
+      POLYBENCH_2MM_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(0, ni),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            for (Index_type j = 0; j < nj; j++) {
+              POLYBENCH_2MM_BODY1;
+              for (Index_type k = 0; k < nk; k++) {
+                POLYBENCH_2MM_BODY2;
+              }
+            }
+          }
+        });
+
+        memcpy(m_D,m_DD,m_ni * m_nl * sizeof(Real_type));
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(0, ni),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            for (Index_type l = 0; l < nl; l++) {
+              POLYBENCH_2MM_BODY3;
+              for (Index_type j = 0; j < nj; j++) {
+                POLYBENCH_2MM_BODY4;
+              }
+            }
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_TBB : {
+
+      POLYBENCH_2MM_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forallN<RAJA::NestedPolicy<RAJA::ExecList<RAJA::tbb_for_exec,
+                                                        RAJA::seq_exec>>> (
+          RAJA::RangeSegment{0, ni}, 
+          RAJA::RangeSegment{0, nj}, 
+          [=] (Index_type i, Index_type j) {
+
+            POLYBENCH_2MM_BODY1;
+
+            RAJA::forall<RAJA::seq_exec> (
+              RAJA::RangeSegment{0, nk}, [=] (Index_type k) {
+              POLYBENCH_2MM_BODY2; 
+            });
+
+        });
+
+        memcpy(m_D,m_DD,m_ni * m_nl * sizeof(Real_type));
+
+        RAJA::forallN<RAJA::NestedPolicy<RAJA::ExecList<RAJA::tbb_for_exec,
+                                                        RAJA::seq_exec>>> (
+          RAJA::RangeSegment{0, ni}, 
+          RAJA::RangeSegment{0, nl}, 
+          [=] (Index_type i, Index_type l) {
+
+          POLYBENCH_2MM_BODY3;
+
+          RAJA::forall<RAJA::seq_exec> (
+            RAJA::RangeSegment{0, nj}, [=] (Index_type j) {
+            POLYBENCH_2MM_BODY4;
+          });
+
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
     case Base_CUDA : {
 
@@ -500,7 +963,7 @@ void POLYBENCH_2MM::runKernel(VariantID vid)
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
        
         RAJA::forall<RAJA::cuda_exec<block_size>> (
-          RAJA::RangeSegment{0, ni * nj}, [=] __device__ (int ii) {
+          RAJA::RangeSegment{0, ni * nj}, [=] __device__ (Index_type ii) {
 
           Index_type i,j,k;
           *(tmp + ii) = 0.0;
@@ -515,7 +978,7 @@ void POLYBENCH_2MM::runKernel(VariantID vid)
         initCudaDeviceData(D,m_D,m_ni * m_nl ); 
 
         RAJA::forall<RAJA::cuda_exec<block_size>> (
-          RAJA::RangeSegment{0, ni * nl}, [=] __device__ (int ii) {
+          RAJA::RangeSegment{0, ni * nl}, [=] __device__ (Index_type ii) {
 
           *(D + ii) *= beta;
           Index_type i,l,j;
@@ -544,16 +1007,20 @@ void POLYBENCH_2MM::runKernel(VariantID vid)
 
 }
 
-void POLYBENCH_2MM::updateChecksum(VariantID vid)
+template <typename REAL, typename INDEX>
+void POLYBENCH_2MM<REAL, INDEX>::updateChecksum(VariantID vid)
 {
   checksum[vid] += calcChecksum(m_D, m_ni * m_nl);
 }
 
-void POLYBENCH_2MM::tearDown(VariantID vid)
+template <typename REAL, typename INDEX>
+void POLYBENCH_2MM<REAL, INDEX>::tearDown(VariantID vid)
 {
   (void) vid;
 
 }
 
+RAJAPERF_INSTANTIATE_KERNEL(POLYBENCH_2MM);
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -47,11 +47,13 @@
 ///
 
 #include "POLYBENCH_3MM.hpp"
+#include "PolybenchData.hpp"
 
 #include "RAJA/RAJA.hpp"
 #include "common/DataUtils.hpp"
 
 #include <iostream>
+#include <algorithm>
 
 namespace rajaperf 
 {
@@ -179,7 +181,8 @@ __global__ void polybench_3mm_cuda_3(Real_ptr A,
 
 #endif // if defined(RAJA_RAJA_ENABLE_CUDA)
   
-POLYBENCH_3MM::POLYBENCH_3MM(const RunParams& params)
+template <typename REAL, typename INDEX>
+POLYBENCH_3MM<REAL, INDEX>::POLYBENCH_3MM(const RunParams& params)
   : KernelBase(rajaperf::Polybench_3MM, params)
 {
   SizeSpec_T lsizespec = KernelBase::getSizeSpec();
@@ -213,6 +216,13 @@ POLYBENCH_3MM::POLYBENCH_3MM(const RunParams& params)
   setDefaultSize(m_ni*m_nj*(1+m_nk) + m_nj*m_nl*(1+m_nm) + m_ni*m_nl*(1+m_nj));
   setDefaultReps(m_run_reps);
 
+  setVariantDefined(Base_Seq_Tiled);
+  setVariantDefined(RAJA_Seq_Tiled);
+#if defined(RAJA_ENABLE_OPENMP)
+  setVariantDefined(Base_OpenMP_Tiled);
+  setVariantDefined(RAJA_OpenMP_Tiled);
+#endif
+
   allocAndInitData(m_A, m_ni * m_nk);
   allocAndInitData(m_B, m_nk * m_nj);
   allocAndInitData(m_C, m_nj * m_nm);
@@ -222,7 +232,8 @@ POLYBENCH_3MM::POLYBENCH_3MM(const RunParams& params)
   allocAndInitData(m_G, m_ni * m_nl);
 }
 
-POLYBENCH_3MM::~POLYBENCH_3MM() 
+template <typename REAL, typename INDEX>
+POLYBENCH_3MM<REAL, INDEX>::~POLYBENCH_3MM() 
 {
   deallocData(m_A);
   deallocData(m_B);
@@ -233,14 +244,42 @@ POLYBENCH_3MM::~POLYBENCH_3MM()
   deallocData(m_G);
 }
 
-void POLYBENCH_3MM::setUp(VariantID vid)
+template <typename REAL, typename INDEX>
+double POLYBENCH_3MM<REAL, INDEX>::getBytesPerRep() const
+{
+  const double ni = m_ni;
+  const double nj = m_nj;
+  const double nk = m_nk;
+  const double nl = m_nl;
+  const double nm = m_nm;
+
+  return ( ni*nk + nk*nj + nj*nm + nm*nl +   // A, B, C, D
+           2.0*ni*nj + 2.0*nj*nl +           // E, F (written and read)
+           ni*nl ) * sizeof(Real_type);               // G
+}
+
+template <typename REAL, typename INDEX>
+double POLYBENCH_3MM<REAL, INDEX>::getFLOPsPerRep() const
+{
+  const double ni = m_ni;
+  const double nj = m_nj;
+  const double nk = m_nk;
+  const double nl = m_nl;
+  const double nm = m_nm;
+
+  return 2.0*ni*nj*nk + 2.0*nj*nl*nm + 2.0*ni*nl*nj;
+}
+
+template <typename REAL, typename INDEX>
+void POLYBENCH_3MM<REAL, INDEX>::setUp(VariantID vid)
 {
   (void) vid;
 }
 
-void POLYBENCH_3MM::runKernel(VariantID vid)
+template <typename REAL, typename INDEX>
+void POLYBENCH_3MM<REAL, INDEX>::runKernel(VariantID vid)
 {
-  const Index_type run_reps = getRunReps();
+  const Index_type run_reps = getBatchReps();
   const Index_type ni = m_ni;
   const Index_type nj = m_nj;
   const Index_type nk = m_nk;
@@ -300,12 +339,12 @@ void POLYBENCH_3MM::runKernel(VariantID vid)
                                                         RAJA::seq_exec>>> (
           RAJA::RangeSegment{0, ni}, 
           RAJA::RangeSegment{0, nj}, 
-          [=] (int i, int j) {
+          [=] (Index_type i, Index_type j) {
 
             POLYBENCH_3MM_BODY1;
 
             RAJA::forall<RAJA::seq_exec> (
-              RAJA::RangeSegment{0, nk}, [=] (int k) {
+              RAJA::RangeSegment{0, nk}, [=] (Index_type k) {
               POLYBENCH_3MM_BODY2; 
             });
 
@@ -315,12 +354,12 @@ void POLYBENCH_3MM::runKernel(VariantID vid)
                                                         RAJA::seq_exec>>> (
           RAJA::RangeSegment{0, nj}, 
           RAJA::RangeSegment{0, nl}, 
-          [=] (int j, int l) {
+          [=] (Index_type j, Index_type l) {
 
             POLYBENCH_3MM_BODY3;
 
             RAJA::forall<RAJA::seq_exec> (
-              RAJA::RangeSegment{0, nm}, [=] (int m) {
+              RAJA::RangeSegment{0, nm}, [=] (Index_type m) {
               POLYBENCH_3MM_BODY4;
             });
 
@@ -330,12 +369,117 @@ void POLYBENCH_3MM::runKernel(VariantID vid)
                                                         RAJA::seq_exec>>> (
           RAJA::RangeSegment{0, ni},
           RAJA::RangeSegment{0, nl}, 
-          [=] (int i, int l) {
+          [=] (Index_type i, Index_type l) {
+
+            POLYBENCH_3MM_BODY5;
+
+            RAJA::forall<RAJA::seq_exec> (
+              RAJA::RangeSegment{0, nj}, [=] (Index_type j) {
+              POLYBENCH_3MM_BODY6;
+            });
+
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_Simd : {
+
+      POLYBENCH_3MM_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        //
+        // Innermost loops accumulate into one entry, so the loops around
+        // them are vectorized.
+        //
+        for (Index_type i = 0; i < ni; i++ ) {
+          RAJAPERF_SIMD
+          for (Index_type j = 0; j < nj; j++) {
+            POLYBENCH_3MM_BODY1;
+            for (Index_type k = 0; k < nk; k++) {
+              POLYBENCH_3MM_BODY2;
+            }
+          }
+        }
+
+        for (Index_type j = 0; j < nj; j++) {
+          RAJAPERF_SIMD
+          for (Index_type l = 0; l < nl; l++) {
+            POLYBENCH_3MM_BODY3;
+            for (Index_type m = 0; m < nm; m++) {
+              POLYBENCH_3MM_BODY4;
+            }
+          }
+        }
+
+        for (Index_type i = 0; i < ni; i++) {
+          RAJAPERF_SIMD
+          for (Index_type l = 0; l < nl; l++) {
+            POLYBENCH_3MM_BODY5;
+            for (Index_type j = 0; j < nj; j++) {
+              POLYBENCH_3MM_BODY6;
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Simd : {
+
+      POLYBENCH_3MM_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forallN<RAJA::NestedPolicy<RAJA::ExecList<RAJA::seq_exec,
+                                                        RAJA::simd_exec>>> (
+          RAJA::RangeSegment{0, ni}, 
+          RAJA::RangeSegment{0, nj}, 
+          [=] (Index_type i, Index_type j) {
+
+            POLYBENCH_3MM_BODY1;
+
+            RAJA::forall<RAJA::seq_exec> (
+              RAJA::RangeSegment{0, nk}, [=] (Index_type k) {
+              POLYBENCH_3MM_BODY2; 
+            });
+
+        });
+
+        RAJA::forallN<RAJA::NestedPolicy<RAJA::ExecList<RAJA::seq_exec,
+                                                        RAJA::simd_exec>>> (
+          RAJA::RangeSegment{0, nj}, 
+          RAJA::RangeSegment{0, nl}, 
+          [=] (Index_type j, Index_type l) {
+
+            POLYBENCH_3MM_BODY3;
+
+            RAJA::forall<RAJA::seq_exec> (
+              RAJA::RangeSegment{0, nm}, [=] (Index_type m) {
+              POLYBENCH_3MM_BODY4;
+            });
+
+        });
+
+        RAJA::forallN<RAJA::NestedPolicy<RAJA::ExecList<RAJA::seq_exec,
+                                                        RAJA::simd_exec>>> (
+          RAJA::RangeSegment{0, ni},
+          RAJA::RangeSegment{0, nl}, 
+          [=] (Index_type i, Index_type l) {
 
             POLYBENCH_3MM_BODY5;
 
             RAJA::forall<RAJA::seq_exec> (
-              RAJA::RangeSegment{0, nj}, [=] (int j) {
+              RAJA::RangeSegment{0, nj}, [=] (Index_type j) {
               POLYBENCH_3MM_BODY6;
             });
 
@@ -347,6 +491,183 @@ void POLYBENCH_3MM::runKernel(VariantID vid)
       break;
     }
 
+    case Base_Seq_Tiled : {
+
+      POLYBENCH_3MM_DATA;
+      POLYBENCH_TILE_SIZES;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < ni; i++) {
+          for (Index_type j = 0; j < nj; j++) {
+            POLYBENCH_3MM_BODY1;
+          }
+        }
+
+        for (Index_type it = 0; it < ni; it += ti) {
+          for (Index_type jt = 0; jt < nj; jt += tj) {
+            for (Index_type kt = 0; kt < nk; kt += tk) {
+              for (Index_type i = it; i < std::min(it + ti, ni); i++) {
+                for (Index_type k = kt; k < std::min(kt + tk, nk); k++) {
+                  for (Index_type j = jt; j < std::min(jt + tj, nj); j++) {
+                    POLYBENCH_3MM_BODY2;
+                  }
+                }
+              }
+            }
+          }
+        }
+
+        for (Index_type j = 0; j < nj; j++) {
+          for (Index_type l = 0; l < nl; l++) {
+            POLYBENCH_3MM_BODY3;
+          }
+        }
+
+        for (Index_type jt = 0; jt < nj; jt += ti) {
+          for (Index_type lt = 0; lt < nl; lt += tj) {
+            for (Index_type mt = 0; mt < nm; mt += tk) {
+              for (Index_type j = jt; j < std::min(jt + ti, nj); j++) {
+                for (Index_type m = mt; m < std::min(mt + tk, nm); m++) {
+                  for (Index_type l = lt; l < std::min(lt + tj, nl); l++) {
+                    POLYBENCH_3MM_BODY4;
+                  }
+                }
+              }
+            }
+          }
+        }
+
+        for (Index_type i = 0; i < ni; i++) {
+          for (Index_type l = 0; l < nl; l++) {
+            POLYBENCH_3MM_BODY5;
+          }
+        }
+
+        for (Index_type it = 0; it < ni; it += ti) {
+          for (Index_type lt = 0; lt < nl; lt += tj) {
+            for (Index_type jt = 0; jt < nj; jt += tk) {
+              for (Index_type i = it; i < std::min(it + ti, ni); i++) {
+                for (Index_type j = jt; j < std::min(jt + tk, nj); j++) {
+                  for (Index_type l = lt; l < std::min(lt + tj, nl); l++) {
+                    POLYBENCH_3MM_BODY6;
+                  }
+                }
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq_Tiled : {
+
+      POLYBENCH_3MM_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forallN<RAJA::NestedPolicy<RAJA::ExecList<RAJA::seq_exec,
+                                                        RAJA::seq_exec>>> (
+          RAJA::RangeSegment{0, ni}, 
+          RAJA::RangeSegment{0, nj}, 
+          [=] (Index_type i, Index_type j) {
+          POLYBENCH_3MM_BODY1;
+        });
+
+        RAJA::forallN<TiledMatMulPolicy<RAJA::seq_exec>> (
+          RAJA::RangeSegment{0, ni}, 
+          RAJA::RangeSegment{0, nj}, 
+          RAJA::RangeSegment{0, nk}, 
+          [=] (Index_type i, Index_type j, Index_type k) {
+          POLYBENCH_3MM_BODY2;
+        });
+
+        RAJA::forallN<RAJA::NestedPolicy<RAJA::ExecList<RAJA::seq_exec,
+                                                        RAJA::seq_exec>>> (
+          RAJA::RangeSegment{0, nj}, 
+          RAJA::RangeSegment{0, nl}, 
+          [=] (Index_type j, Index_type l) {
+          POLYBENCH_3MM_BODY3;
+        });
+
+        RAJA::forallN<TiledMatMulPolicy<RAJA::seq_exec>> (
+          RAJA::RangeSegment{0, nj}, 
+          RAJA::RangeSegment{0, nl}, 
+          RAJA::RangeSegment{0, nm}, 
+          [=] (Index_type j, Index_type l, Index_type m) {
+          POLYBENCH_3MM_BODY4;
+        });
+
+        RAJA::forallN<RAJA::NestedPolicy<RAJA::ExecList<RAJA::seq_exec,
+                                                        RAJA::seq_exec>>> (
+          RAJA::RangeSegment{0, ni}, 
+          RAJA::RangeSegment{0, nl}, 
+          [=] (Index_type i, Index_type l) {
+          POLYBENCH_3MM_BODY5;
+        });
+
+        RAJA::forallN<TiledMatMulPolicy<RAJA::seq_exec>> (
+          RAJA::RangeSegment{0, ni}, 
+          RAJA::RangeSegment{0, nl}, 
+          RAJA::RangeSegment{0, nj}, 
+          [=] (Index_type i, Index_type l, Index_type j) {
+          POLYBENCH_3MM_BODY6;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_ThreadPool : {
+
+      POLYBENCH_3MM_DATA;
+
+      ThreadPool& pool = getThreadPool();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        pool.forall(0, ni, [=](Index_type i) {
+          for (Index_type j = 0; j < nj; j++) {
+            POLYBENCH_3MM_BODY1;
+            for (Index_type k = 0; k < nk; k++) {
+              POLYBENCH_3MM_BODY2;
+            }
+          }
+        });
+
+        pool.forall(0, nj, [=](Index_type j) {
+          for (Index_type l = 0; l < nl; l++) {
+            POLYBENCH_3MM_BODY3;
+            for (Index_type m = 0; m < nm; m++) {
+              POLYBENCH_3MM_BODY4;
+            }
+          }
+        });
+
+        pool.forall(0, ni, [=](Index_type i) {
+          for (Index_type l = 0; l < nl; l++) {
+            POLYBENCH_3MM_BODY5;
+            for (Index_type j = 0; j < nj; j++) {
+              POLYBENCH_3MM_BODY6;
+            }
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
 #if defined(RAJA_ENABLE_OPENMP)      
     case Base_OpenMP : {
 
@@ -402,12 +723,12 @@ void POLYBENCH_3MM::runKernel(VariantID vid)
                                                         RAJA::seq_exec>>> (
           RAJA::RangeSegment{0, ni},
           RAJA::RangeSegment{0, nj},
-          [=] (int i, int j) {
+          [=] (Index_type i, Index_type j) {
 
           POLYBENCH_3MM_BODY1;
 
           RAJA::forall<RAJA::seq_exec> (
-          RAJA::RangeSegment{0, nk}, [=] (int k) {
+          RAJA::RangeSegment{0, nk}, [=] (Index_type k) {
             POLYBENCH_3MM_BODY2; 
           });
 
@@ -417,12 +738,12 @@ void POLYBENCH_3MM::runKernel(VariantID vid)
                                                         RAJA::seq_exec>>> (
           RAJA::RangeSegment{0, nj}, 
           RAJA::RangeSegment{0, nl},
-          [=] (int j, int l) {
+          [=] (Index_type j, Index_type l) {
 
           POLYBENCH_3MM_BODY3;
 
           RAJA::forall<RAJA::seq_exec> (
-          RAJA::RangeSegment{0, nm}, [=] (int m) {
+          RAJA::RangeSegment{0, nm}, [=] (Index_type m) {
             POLYBENCH_3MM_BODY4;
           });
 
@@ -432,12 +753,12 @@ void POLYBENCH_3MM::runKernel(VariantID vid)
                                                         RAJA::seq_exec>>> (
           RAJA::RangeSegment{0, ni}, 
           RAJA::RangeSegment{0, nl}, 
-          [=] (int i, int l) {
+          [=] (Index_type i, Index_type l) {
 
             POLYBENCH_3MM_BODY5;
 
             RAJA::forall<RAJA::seq_exec> (
-              RAJA::RangeSegment{0, nj}, [=] (int j) {
+              RAJA::RangeSegment{0, nj}, [=] (Index_type j) {
               POLYBENCH_3MM_BODY6;
           });
 
@@ -449,6 +770,162 @@ void POLYBENCH_3MM::runKernel(VariantID vid)
       break;
     }
 
+    case Base_OpenMP_Tiled : {
+
+      POLYBENCH_3MM_DATA;
+      POLYBENCH_TILE_SIZES;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < ni; i++) {
+          for (Index_type j = 0; j < nj; j++) {
+            POLYBENCH_3MM_BODY1;
+          }
+        }
+
+        #pragma omp parallel for collapse(2)
+        for (Index_type it = 0; it < ni; it += ti) {
+          for (Index_type jt = 0; jt < nj; jt += tj) {
+            for (Index_type kt = 0; kt < nk; kt += tk) {
+              for (Index_type i = it; i < std::min(it + ti, ni); i++) {
+                for (Index_type k = kt; k < std::min(kt + tk, nk); k++) {
+                  for (Index_type j = jt; j < std::min(jt + tj, nj); j++) {
+                    POLYBENCH_3MM_BODY2;
+                  }
+                }
+              }
+            }
+          }
+        }
+
+        #pragma omp parallel for
+        for (Index_type j = 0; j < nj; j++) {
+          for (Index_type l = 0; l < nl; l++) {
+            POLYBENCH_3MM_BODY3;
+          }
+        }
+
+        #pragma omp parallel for collapse(2)
+        for (Index_type jt = 0; jt < nj; jt += ti) {
+          for (Index_type lt = 0; lt < nl; lt += tj) {
+            for (Index_type mt = 0; mt < nm; mt += tk) {
+              for (Index_type j = jt; j < std::min(jt + ti, nj); j++) {
+                for (Index_type m = mt; m < std::min(mt + tk, nm); m++) {
+                  for (Index_type l = lt; l < std::min(lt + tj, nl); l++) {
+                    POLYBENCH_3MM_BODY4;
+                  }
+                }
+              }
+            }
+          }
+        }
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < ni; i++) {
+          for (Index_type l = 0; l < nl; l++) {
+            POLYBENCH_3MM_BODY5;
+          }
+        }
+
+        #pragma omp parallel for collapse(2)
+        for (Index_type it = 0; it < ni; it += ti) {
+          for (Index_type lt = 0; lt < nl; lt += tj) {
+            for (Index_type jt = 0; jt < nj; jt += tk) {
+              for (Index_type i = it; i < std::min(it + ti, ni); i++) {
+                for (Index_type j = jt; j < std::min(jt + tk, nj); j++) {
+                  for (Index_type l = lt; l < std::min(lt + tj, nl); l++) {
+                    POLYBENCH_3MM_BODY6;
+                  }
+                }
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP_Tiled : {
+
+      POLYBENCH_3MM_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        //
+        // RAJA tile loops run sequentially, so each product runs as a 
+        // parallel loop over tiles of rows, and each tile of rows runs the 
+        // tiled loop nest sequentially. Each entry of the product is 
+        // computed by one thread, and a product takes one parallel region.
+        //
+        RAJA::forallN<RAJA::NestedPolicy<RAJA::ExecList<RAJA::omp_parallel_for_exec,
+                                                        RAJA::seq_exec>>> (
+          RAJA::RangeSegment{0, ni}, 
+          RAJA::RangeSegment{0, nj}, 
+          [=] (Index_type i, Index_type j) {
+          POLYBENCH_3MM_BODY1;
+        });
+
+        RAJA::forall<RAJA::omp_parallel_for_exec> (
+          RAJA::RangeSegment{0, getNumRAJATiles(ni)}, [=] (Index_type t) {
+          RAJA::forallN<TiledMatMulPolicy<RAJA::seq_exec>> (
+            getRAJATileSegment(t, ni), 
+            RAJA::RangeSegment{0, nj}, 
+            RAJA::RangeSegment{0, nk}, 
+            [=] (Index_type i, Index_type j, Index_type k) {
+            POLYBENCH_3MM_BODY2;
+          });
+        });
+
+        RAJA::forallN<RAJA::NestedPolicy<RAJA::ExecList<RAJA::omp_parallel_for_exec,
+                                                        RAJA::seq_exec>>> (
+          RAJA::RangeSegment{0, nj}, 
+          RAJA::RangeSegment{0, nl}, 
+          [=] (Index_type j, Index_type l) {
+          POLYBENCH_3MM_BODY3;
+        });
+
+        RAJA::forall<RAJA::omp_parallel_for_exec> (
+          RAJA::RangeSegment{0, getNumRAJATiles(nj)}, [=] (Index_type t) {
+          RAJA::forallN<TiledMatMulPolicy<RAJA::seq_exec>> (
+            getRAJATileSegment(t, nj), 
+            RAJA::RangeSegment{0, nl}, 
+            RAJA::RangeSegment{0, nm}, 
+            [=] (Index_type j, Index_type l, Index_type m) {
+            POLYBENCH_3MM_BODY4;
+          });
+        });
+
+        RAJA::forallN<RAJA::NestedPolicy<RAJA::ExecList<RAJA::omp_parallel_for_exec,
+                                                        RAJA::seq_exec>>> (
+          RAJA::RangeSegment{0, ni}, 
+          RAJA::RangeSegment{0, nl}, 
+          [=] (Index_type i, Index_type l) {
+          POLYBENCH_3MM_BODY5;
+        });
+
+        RAJA::forall<RAJA::omp_parallel_for_exec> (
+          RAJA::RangeSegment{0, getNumRAJATiles(ni)}, [=] (Index_type t) {
+          RAJA::forallN<TiledMatMulPolicy<RAJA::seq_exec>> (
+            getRAJATileSegment(t, ni), 
+            RAJA::RangeSegment{0, nl}, 
+            RAJA::RangeSegment{0, nj}, 
+            [=] (Index_type i, Index_type l, Index_type j) {
+            POLYBENCH_3MM_BODY6;
+          });
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
 
 #define NUMTEAMS 128
@@ -555,6 +1032,115 @@ void POLYBENCH_3MM::runKernel(VariantID vid)
 #endif //RAJA_ENABLE_TARGET_OPENMP
 #endif //RAJA_ENABLE_OMP                             
 
+#if defined(RAJA_ENABLE_TBB)
+    case Base_TBB : {
+
+      POLYBENCH_3MM_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(0, ni),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            for (Index_type j = 0; j < nj; j++) {
+              POLYBENCH_3MM_BODY1;
+              for (Index_type k = 0; k < nk; k++) {
+                POLYBENCH_3MM_BODY2;
+              }
+            }
+          }
+        });
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(0, nj),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type j = r.begin(); j < r.end(); ++j ) {
+            for (Index_type l = 0; l < nl; l++) {
+              POLYBENCH_3MM_BODY3;
+              for (Index_type m = 0; m < nm; m++) {
+                POLYBENCH_3MM_BODY4;
+              }
+            }
+          }
+        });
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(0, ni),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            for (Index_type l = 0; l < nl; l++) {
+              POLYBENCH_3MM_BODY5;
+              for (Index_type j = 0; j < nj; j++) {
+                POLYBENCH_3MM_BODY6;
+              }
+            }
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_TBB : {
+
+      POLYBENCH_3MM_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forallN<RAJA::NestedPolicy<RAJA::ExecList<RAJA::tbb_for_exec,
+                                                        RAJA::seq_exec>>> (
+          RAJA::RangeSegment{0, ni},
+          RAJA::RangeSegment{0, nj},
+          [=] (Index_type i, Index_type j) {
+
+          POLYBENCH_3MM_BODY1;
+
+          RAJA::forall<RAJA::seq_exec> (
+          RAJA::RangeSegment{0, nk}, [=] (Index_type k) {
+            POLYBENCH_3MM_BODY2; 
+          });
+
+        });
+
+        RAJA::forallN<RAJA::NestedPolicy<RAJA::ExecList<RAJA::tbb_for_exec,
+                                                        RAJA::seq_exec>>> (
+          RAJA::RangeSegment{0, nj}, 
+          RAJA::RangeSegment{0, nl},
+          [=] (Index_type j, Index_type l) {
+
+          POLYBENCH_3MM_BODY3;
+
+          RAJA::forall<RAJA::seq_exec> (
+          RAJA::RangeSegment{0, nm}, [=] (Index_type m) {
+            POLYBENCH_3MM_BODY4;
+          });
+
+        });
+
+        RAJA::forallN<RAJA::NestedPolicy<RAJA::ExecList<RAJA::tbb_for_exec,
+                                                        RAJA::seq_exec>>> (
+          RAJA::RangeSegment{0, ni}, 
+          RAJA::RangeSegment{0, nl}, 
+          [=] (Index_type i, Index_type l) {
+
+            POLYBENCH_3MM_BODY5;
+
+            RAJA::forall<RAJA::seq_exec> (
+              RAJA::RangeSegment{0, nj}, [=] (Index_type j) {
+              POLYBENCH_3MM_BODY6;
+          });
+
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
     case Base_CUDA : {
 
@@ -591,7 +1177,7 @@ void POLYBENCH_3MM::runKernel(VariantID vid)
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
        
         RAJA::forall<RAJA::cuda_exec<block_size>> (
-          RAJA::RangeSegment{0, ni * nj}, [=] __device__ (int ii) {
+          RAJA::RangeSegment{0, ni * nj}, [=] __device__ (Index_type ii) {
 
           Index_type i,j,k;
           *(E + ii) = 0.0;
@@ -603,7 +1189,7 @@ void POLYBENCH_3MM::runKernel(VariantID vid)
         });
 
         RAJA::forall<RAJA::cuda_exec<block_size>> (
-          RAJA::RangeSegment{0, nj * nl}, [=] __device__ (int ii) {
+          RAJA::RangeSegment{0, nj * nl}, [=] __device__ (Index_type ii) {
 
           *(F + ii) = 0.0;
           Index_type j,l,m;
@@ -615,7 +1201,7 @@ void POLYBENCH_3MM::runKernel(VariantID vid)
         });
 
         RAJA::forall<RAJA::cuda_exec<block_size>> (
-        RAJA::RangeSegment{0, ni * nl}, [=] __device__ (int ii) {
+        RAJA::RangeSegment{0, ni * nl}, [=] __device__ (Index_type ii) {
 
           *(G + ii) = 0.0;
           Index_type i,l,j;
@@ -643,16 +1229,20 @@ void POLYBENCH_3MM::runKernel(VariantID vid)
 
 }
 
-void POLYBENCH_3MM::updateChecksum(VariantID vid)
+template <typename REAL, typename INDEX>
+void POLYBENCH_3MM<REAL, INDEX>::updateChecksum(VariantID vid)
 {
   checksum[vid] += calcChecksum(m_G, m_ni * m_nl);
 }
 
-void POLYBENCH_3MM::tearDown(VariantID vid)
+template <typename REAL, typename INDEX>
+void POLYBENCH_3MM<REAL, INDEX>::tearDown(VariantID vid)
 {
   (void) vid;
 
 }
 
+RAJAPERF_INSTANTIATE_KERNEL(POLYBENCH_3MM);
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -27,14 +27,19 @@ class RunParams;
 namespace polybench
 {
 
+template <typename REAL, typename INDEX>
 class POLYBENCH_3MM : public KernelBase
 {
 public:
+  RAJAPERF_REAL_TYPES(REAL);
+  RAJAPERF_INDEX_TYPES(INDEX);
 
   POLYBENCH_3MM(const RunParams& params);
 
   ~POLYBENCH_3MM();
 
+  double getBytesPerRep() const;
+  double getFLOPsPerRep() const;
 
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
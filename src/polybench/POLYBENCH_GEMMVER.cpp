@@ -41,6 +41,7 @@
 
 
 #include "POLYBENCH_GEMMVER.hpp"
+#include "PolybenchData.hpp"
 
 #include "common/DataUtils.hpp"
 #include <RAJA/RAJA.hpp>
@@ -79,6 +80,16 @@ namespace polybench
 #define POLYBENCH_GEMMVER_BODY4 \
   *(w + i) = *(w + i) + alpha * *(A + i * n + j) * *(x + j);
 
+//
+// Fused variants merge the first two loops into one sweep over the rows 
+// of A: each entry of A is added into x right after it is updated. Each 
+// entry of x still accumulates rows of A in order. The last loop needs 
+// all of x, so it cannot be merged.
+//
+#define POLYBENCH_GEMMVER_BODY1_2 \
+  POLYBENCH_GEMMVER_BODY1; \
+  *(x + j) = *(x + j) + beta * *(A + i * n + j) * *(y + i);
+
 
 
 #if defined(RAJA_ENABLE_CUDA)
@@ -176,7 +187,8 @@ __global__ void polybench_gemmver_cuda_4(Real_type alpha,
 
 #endif // if defined(RAJA_ENABLE_CUDA)
   
-POLYBENCH_GEMMVER::POLYBENCH_GEMMVER(const RunParams& params)
+template <typename REAL, typename INDEX>
+POLYBENCH_GEMMVER<REAL, INDEX>::POLYBENCH_GEMMVER(const RunParams& params)
   : KernelBase(rajaperf::Polybench_GEMMVER, params)
 {
   SizeSpec_T lsizespec = KernelBase::getSizeSpec();
@@ -210,6 +222,13 @@ POLYBENCH_GEMMVER::POLYBENCH_GEMMVER(const RunParams& params)
   setDefaultSize(m_n*m_n + m_n*m_n + m_n + m_n*m_n);
   setDefaultReps(m_run_reps);
 
+  setVariantDefined(Base_Seq_Fused);
+  setVariantDefined(RAJA_Seq_Fused);
+#if defined(RAJA_ENABLE_OPENMP)
+  setVariantDefined(Base_OpenMP_Fused);
+  setVariantDefined(RAJA_OpenMP_Fused);
+#endif
+
   allocAndInitData(m_A, m_n * m_n);
   allocAndInitData(m_u1, m_n);
   allocAndInitData(m_v1, m_n);
@@ -221,7 +240,8 @@ POLYBENCH_GEMMVER::POLYBENCH_GEMMVER(const RunParams& params)
   allocAndInitData(m_z, m_n);
 }
 
-POLYBENCH_GEMMVER::~POLYBENCH_GEMMVER() 
+template <typename REAL, typename INDEX>
+POLYBENCH_GEMMVER<REAL, INDEX>::~POLYBENCH_GEMMVER() 
 {
   deallocData(m_A);
   deallocData(m_u1);
@@ -234,15 +254,43 @@ POLYBENCH_GEMMVER::~POLYBENCH_GEMMVER()
   deallocData(m_z);
 }
 
-void POLYBENCH_GEMMVER::setUp(VariantID vid)
+template <typename REAL, typename INDEX>
+double POLYBENCH_GEMMVER<REAL, INDEX>::getBytesPerRep() const
+{
+  const double n = m_n;
+
+  return ( 4.0*n*n +    // A (read and written, then read twice)
+           10.0*n ) * sizeof(Real_type);   // u1, v1, u2, v2, y, z, x (rw), w (rw)
+}
+
+template <typename REAL, typename INDEX>
+double POLYBENCH_GEMMVER<REAL, INDEX>::getFusedBytesPerRep() const
+{
+  const double n = m_n;
+
+  return ( 3.0*n*n +    // A (read and written, then read once)
+           10.0*n ) * sizeof(Real_type);   // u1, v1, u2, v2, y, z, x (rw), w (rw)
+}
+
+template <typename REAL, typename INDEX>
+double POLYBENCH_GEMMVER<REAL, INDEX>::getFLOPsPerRep() const
+{
+  const double n = m_n;
+
+  return 10.0*n*n + n;
+}
+
+template <typename REAL, typename INDEX>
+void POLYBENCH_GEMMVER<REAL, INDEX>::setUp(VariantID vid)
 {
   (void) vid;
 }
 
-void POLYBENCH_GEMMVER::runKernel(VariantID vid)
+template <typename REAL, typename INDEX>
+void POLYBENCH_GEMMVER<REAL, INDEX>::runKernel(VariantID vid)
 {
 
-  const Index_type run_reps = getRunReps();
+  const Index_type run_reps = getBatchReps();
   const Index_type n = m_n;
 
   switch ( vid ) {
@@ -267,9 +315,7 @@ void POLYBENCH_GEMMVER::runKernel(VariantID vid)
         }
 
         for (Index_type i = 0; i < n; i++ ) { 
-          for (Index_type j = 0; j < n; j++) {
-            POLYBENCH_GEMMVER_BODY3;
-          }
+          POLYBENCH_GEMMVER_BODY3;
         }
 
         for (Index_type i = 0; i < n; i++ ) { 
@@ -295,7 +341,7 @@ void POLYBENCH_GEMMVER::runKernel(VariantID vid)
                                                         RAJA::seq_exec>>> (
           RAJA::RangeSegment{0, n}, 
           RAJA::RangeSegment{0, n}, 
-          [=] (int i, int j) {
+          [=] (Index_type i, Index_type j) {
           POLYBENCH_GEMMVER_BODY1;
         });
 
@@ -303,13 +349,13 @@ void POLYBENCH_GEMMVER::runKernel(VariantID vid)
                                                         RAJA::seq_exec>>> (
           RAJA::RangeSegment{0, n}, 
           RAJA::RangeSegment{0, n}, 
-          [=] (int i, int j) {
+          [=] (Index_type i, Index_type j) {
           POLYBENCH_GEMMVER_BODY2;
         });
 
 
         RAJA::forall<RAJA::seq_exec> (
-          RAJA::RangeSegment{0, n}, [=] (int i) {
+          RAJA::RangeSegment{0, n}, [=] (Index_type i) {
           POLYBENCH_GEMMVER_BODY3; 
         });
 
@@ -317,7 +363,7 @@ void POLYBENCH_GEMMVER::runKernel(VariantID vid)
                                                         RAJA::seq_exec>>> (
           RAJA::RangeSegment{0, n}, 
           RAJA::RangeSegment{0, n}, 
-          [=] (int i, int j) {
+          [=] (Index_type i, Index_type j) {
           POLYBENCH_GEMMVER_BODY4;
         });
 
@@ -327,6 +373,192 @@ void POLYBENCH_GEMMVER::runKernel(VariantID vid)
       break;
     }
 
+    case Base_Simd : {
+
+      POLYBENCH_GEMMVER_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < n; i++ ) {
+          RAJAPERF_SIMD
+          for (Index_type j = 0; j < n; j++) {
+            POLYBENCH_GEMMVER_BODY1;
+          }
+        }
+
+        //
+        // Loops over j accumulate into one entry of x or w, so loops over i
+        // are vectorized.
+        //
+        RAJAPERF_SIMD
+        for (Index_type i = 0; i < n; i++ ) { 
+          for (Index_type j = 0; j < n; j++) {
+            POLYBENCH_GEMMVER_BODY2;
+          }
+        }
+
+        RAJAPERF_SIMD
+        for (Index_type i = 0; i < n; i++ ) { 
+          POLYBENCH_GEMMVER_BODY3;
+        }
+
+        RAJAPERF_SIMD
+        for (Index_type i = 0; i < n; i++ ) { 
+          for (Index_type j = 0; j < n; j++) {
+            POLYBENCH_GEMMVER_BODY4;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Simd : {
+
+      POLYBENCH_GEMMVER_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forallN<RAJA::NestedPolicy<RAJA::ExecList<RAJA::seq_exec,
+                                                        RAJA::simd_exec>>> (
+          RAJA::RangeSegment{0, n}, 
+          RAJA::RangeSegment{0, n}, 
+          [=] (Index_type i, Index_type j) {
+          POLYBENCH_GEMMVER_BODY1;
+        });
+
+        RAJA::forallN<RAJA::NestedPolicy<RAJA::ExecList<RAJA::simd_exec,
+                                                        RAJA::seq_exec>>> (
+          RAJA::RangeSegment{0, n}, 
+          RAJA::RangeSegment{0, n}, 
+          [=] (Index_type i, Index_type j) {
+          POLYBENCH_GEMMVER_BODY2;
+        });
+
+
+        RAJA::forall<RAJA::simd_exec> (
+          RAJA::RangeSegment{0, n}, [=] (Index_type i) {
+          POLYBENCH_GEMMVER_BODY3; 
+        });
+
+        RAJA::forallN<RAJA::NestedPolicy<RAJA::ExecList<RAJA::simd_exec,
+                                                        RAJA::seq_exec>>> (
+          RAJA::RangeSegment{0, n}, 
+          RAJA::RangeSegment{0, n}, 
+          [=] (Index_type i, Index_type j) {
+          POLYBENCH_GEMMVER_BODY4;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_Seq_Fused : {
+
+      POLYBENCH_GEMMVER_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < n; i++ ) {
+          for (Index_type j = 0; j < n; j++) {
+            POLYBENCH_GEMMVER_BODY1_2;
+          }
+        }
+
+        for (Index_type i = 0; i < n; i++ ) { 
+          POLYBENCH_GEMMVER_BODY3;
+        }
+
+        for (Index_type i = 0; i < n; i++ ) { 
+          for (Index_type j = 0; j < n; j++) {
+            POLYBENCH_GEMMVER_BODY4;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq_Fused : {
+
+      POLYBENCH_GEMMVER_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forallN<RAJA::NestedPolicy<RAJA::ExecList<RAJA::seq_exec,
+                                                        RAJA::seq_exec>>> (
+          RAJA::RangeSegment{0, n}, 
+          RAJA::RangeSegment{0, n}, 
+          [=] (Index_type i, Index_type j) {
+          POLYBENCH_GEMMVER_BODY1_2;
+        });
+
+        RAJA::forall<RAJA::seq_exec> (
+          RAJA::RangeSegment{0, n}, [=] (Index_type i) {
+          POLYBENCH_GEMMVER_BODY3; 
+        });
+
+        RAJA::forallN<RAJA::NestedPolicy<RAJA::ExecList<RAJA::seq_exec,
+                                                        RAJA::seq_exec>>> (
+          RAJA::RangeSegment{0, n}, 
+          RAJA::RangeSegment{0, n}, 
+          [=] (Index_type i, Index_type j) {
+          POLYBENCH_GEMMVER_BODY4;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_ThreadPool : {
+
+      POLYBENCH_GEMMVER_DATA;
+
+      ThreadPool& pool = getThreadPool();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        pool.forall(0, n, [=](Index_type i) {
+          for (Index_type j = 0; j < n; j++) {
+            POLYBENCH_GEMMVER_BODY1;
+          }
+        });
+
+        pool.forall(0, n, [=](Index_type i) {
+          for (Index_type j = 0; j < n; j++) {
+            POLYBENCH_GEMMVER_BODY2;
+          }
+        });
+
+        pool.forall(0, n, [=](Index_type i) {
+          POLYBENCH_GEMMVER_BODY3;
+        });
+
+        pool.forall(0, n, [=](Index_type i) {
+          for (Index_type j = 0; j < n; j++) {
+            POLYBENCH_GEMMVER_BODY4;
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
 #if defined(RAJA_ENABLE_OPENMP)      
     case Base_OpenMP : {
 
@@ -351,9 +583,7 @@ void POLYBENCH_GEMMVER::runKernel(VariantID vid)
 
         #pragma omp parallel for  
         for (Index_type i = 0; i < n; i++ ) {
-          for (Index_type j = 0; j < n; j++) {
-            POLYBENCH_GEMMVER_BODY3;
-          }
+          POLYBENCH_GEMMVER_BODY3;
         }
 
         #pragma omp parallel for  
@@ -380,7 +610,7 @@ void POLYBENCH_GEMMVER::runKernel(VariantID vid)
                                                         RAJA::seq_exec>>> (
           RAJA::RangeSegment{0, n}, 
           RAJA::RangeSegment{0, n}, 
-          [=] (int i, int j) {
+          [=] (Index_type i, Index_type j) {
           POLYBENCH_GEMMVER_BODY1;
         });
 
@@ -388,13 +618,13 @@ void POLYBENCH_GEMMVER::runKernel(VariantID vid)
                                                         RAJA::seq_exec>>> (
           RAJA::RangeSegment{0, n}, 
           RAJA::RangeSegment{0, n}, 
-          [=] (int i, int j) {
+          [=] (Index_type i, Index_type j) {
           POLYBENCH_GEMMVER_BODY2;
         });
 
 
         RAJA::forall<RAJA::omp_parallel_for_exec> (
-          RAJA::RangeSegment{0, n}, [=] (int i) {
+          RAJA::RangeSegment{0, n}, [=] (Index_type i) {
           POLYBENCH_GEMMVER_BODY3; 
         });
 
@@ -402,7 +632,94 @@ void POLYBENCH_GEMMVER::runKernel(VariantID vid)
                                                         RAJA::seq_exec>>> (
           RAJA::RangeSegment{0, n}, 
           RAJA::RangeSegment{0, n}, 
-          [=] (int i, int j) {
+          [=] (Index_type i, Index_type j) {
+          POLYBENCH_GEMMVER_BODY4;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_OpenMP_Fused : {
+
+      POLYBENCH_GEMMVER_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        //
+        // Each thread sweeps all rows of A over its own block of columns,
+        // so it alone updates the entries of x for those columns.
+        //
+        #pragma omp parallel
+        {
+          const Index_type nthreads = omp_get_num_threads();
+          const Index_type tid = omp_get_thread_num();
+          const Index_type jbegin = tid * n / nthreads;
+          const Index_type jend = (tid + 1) * n / nthreads;
+
+          for (Index_type i = 0; i < n; i++ ) {
+            for (Index_type j = jbegin; j < jend; j++) {
+              POLYBENCH_GEMMVER_BODY1_2;
+            }
+          }
+        }
+
+        #pragma omp parallel for  
+        for (Index_type i = 0; i < n; i++ ) {
+          POLYBENCH_GEMMVER_BODY3;
+        }
+
+        #pragma omp parallel for  
+        for (Index_type i = 0; i < n; i++ ) {
+          for (Index_type j = 0; j < n; j++) {
+            POLYBENCH_GEMMVER_BODY4;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP_Fused : {
+
+      POLYBENCH_GEMMVER_DATA;
+
+      const Index_type nblocks = omp_get_max_threads();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        //
+        // Blocks of columns of A run in parallel, as in Base_OpenMP_Fused.
+        //
+        RAJA::forall<RAJA::omp_parallel_for_exec> (
+          RAJA::RangeSegment{0, nblocks}, [=] (Index_type b) {
+
+          RAJA::forallN<RAJA::NestedPolicy<RAJA::ExecList<RAJA::seq_exec,
+                                                          RAJA::seq_exec>>> (
+            RAJA::RangeSegment{0, n}, 
+            RAJA::RangeSegment{b * n / nblocks, (b + 1) * n / nblocks}, 
+            [=] (Index_type i, Index_type j) {
+            POLYBENCH_GEMMVER_BODY1_2;
+          });
+
+        });
+
+        RAJA::forall<RAJA::omp_parallel_for_exec> (
+          RAJA::RangeSegment{0, n}, [=] (Index_type i) {
+          POLYBENCH_GEMMVER_BODY3; 
+        });
+
+        RAJA::forallN<RAJA::NestedPolicy<RAJA::ExecList<RAJA::omp_parallel_for_exec,
+                                                        RAJA::seq_exec>>> (
+          RAJA::RangeSegment{0, n}, 
+          RAJA::RangeSegment{0, n}, 
+          [=] (Index_type i, Index_type j) {
           POLYBENCH_GEMMVER_BODY4;
         });
 
@@ -440,11 +757,9 @@ void POLYBENCH_GEMMVER::runKernel(VariantID vid)
           }
         }
 
-        #pragma omp target teams distribute parallel for num_teams(NUMTEAMS) schedule(static, 1) collapse(2)
+        #pragma omp target teams distribute parallel for num_teams(NUMTEAMS) schedule(static, 1)
         for (Index_type i = 0; i < n; i++ ) {
-          for(Index_type j = 0; j < n; j++) {
-            POLYBENCH_GEMMVER_BODY3;
-          }
+          POLYBENCH_GEMMVER_BODY3;
         }
 
         #pragma omp target teams distribute parallel for num_teams(NUMTEAMS) schedule(static, 1) collapse(2)
@@ -509,6 +824,98 @@ void POLYBENCH_GEMMVER::runKernel(VariantID vid)
 #endif //RAJA_ENABLE_OMP                             
      
 
+#if defined(RAJA_ENABLE_TBB)
+    case Base_TBB : {
+
+      POLYBENCH_GEMMVER_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(0, n),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            for (Index_type j = 0; j < n; j++) {
+              POLYBENCH_GEMMVER_BODY1;
+            }
+          }
+        });
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(0, n),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            for (Index_type j = 0; j < n; j++) {
+              POLYBENCH_GEMMVER_BODY2;
+            }
+          }
+        });
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(0, n),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            POLYBENCH_GEMMVER_BODY3;
+          }
+        });
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(0, n),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            for (Index_type j = 0; j < n; j++) {
+              POLYBENCH_GEMMVER_BODY4;
+            }
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_TBB : {
+
+      POLYBENCH_GEMMVER_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forallN<RAJA::NestedPolicy<RAJA::ExecList<RAJA::tbb_for_exec,
+                                                        RAJA::seq_exec>>> (
+          RAJA::RangeSegment{0, n}, 
+          RAJA::RangeSegment{0, n}, 
+          [=] (Index_type i, Index_type j) {
+          POLYBENCH_GEMMVER_BODY1;
+        });
+
+        RAJA::forallN<RAJA::NestedPolicy<RAJA::ExecList<RAJA::tbb_for_exec,
+                                                        RAJA::seq_exec>>> (
+          RAJA::RangeSegment{0, n}, 
+          RAJA::RangeSegment{0, n}, 
+          [=] (Index_type i, Index_type j) {
+          POLYBENCH_GEMMVER_BODY2;
+        });
+
+
+        RAJA::forall<RAJA::tbb_for_exec> (
+          RAJA::RangeSegment{0, n}, [=] (Index_type i) {
+          POLYBENCH_GEMMVER_BODY3; 
+        });
+
+        RAJA::forallN<RAJA::NestedPolicy<RAJA::ExecList<RAJA::tbb_for_exec,
+                                                        RAJA::seq_exec>>> (
+          RAJA::RangeSegment{0, n}, 
+          RAJA::RangeSegment{0, n}, 
+          [=] (Index_type i, Index_type j) {
+          POLYBENCH_GEMMVER_BODY4;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
     case Base_CUDA : {
 
@@ -543,26 +950,26 @@ void POLYBENCH_GEMMVER::runKernel(VariantID vid)
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
        
         RAJA::forall<RAJA::cuda_exec<block_size>> (
-          RAJA::RangeSegment{0, n * n}, [=] __device__ (int ii) {
+          RAJA::RangeSegment{0, n * n}, [=] __device__ (Index_type ii) {
           Index_type i,j;
           i = ii/n; j = ii % n;
           POLYBENCH_GEMMVER_BODY1; 
         });
 
         RAJA::forall<RAJA::cuda_exec<block_size>> (
-          RAJA::RangeSegment{0, n * n}, [=] __device__ (int ii) {
+          RAJA::RangeSegment{0, n * n}, [=] __device__ (Index_type ii) {
           Index_type i,j;
           i = ii/n; j = ii % n;
           POLYBENCH_GEMMVER_BODY2;
         });
 
         RAJA::forall<RAJA::cuda_exec<block_size>> (
-          RAJA::RangeSegment{0, n}, [=] __device__ (int i) {
+          RAJA::RangeSegment{0, n}, [=] __device__ (Index_type i) {
           POLYBENCH_GEMMVER_BODY3;
         });
 
         RAJA::forall<RAJA::cuda_exec<block_size>> (
-          RAJA::RangeSegment{0, n * n}, [=] __device__ (int ii) {
+          RAJA::RangeSegment{0, n * n}, [=] __device__ (Index_type ii) {
           Index_type i,j;
           i = ii/n; j = ii % n;
           POLYBENCH_GEMMVER_BODY4;
@@ -584,16 +991,20 @@ void POLYBENCH_GEMMVER::runKernel(VariantID vid)
 
 }
 
-void POLYBENCH_GEMMVER::updateChecksum(VariantID vid)
+template <typename REAL, typename INDEX>
+void POLYBENCH_GEMMVER<REAL, INDEX>::updateChecksum(VariantID vid)
 {
   checksum[vid] += calcChecksum(m_w, m_n);
 }
 
-void POLYBENCH_GEMMVER::tearDown(VariantID vid)
+template <typename REAL, typename INDEX>
+void POLYBENCH_GEMMVER<REAL, INDEX>::tearDown(VariantID vid)
 {
   (void) vid;
 
 }
 
+RAJAPERF_INSTANTIATE_KERNEL(POLYBENCH_GEMMVER);
+
 } // end namespace basic
 } // end namespace rajaperf
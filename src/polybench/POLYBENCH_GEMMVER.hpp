@@ -27,14 +27,20 @@ class RunParams;
 namespace polybench
 {
 
+template <typename REAL, typename INDEX>
 class POLYBENCH_GEMMVER : public KernelBase
 {
 public:
+  RAJAPERF_REAL_TYPES(REAL);
+  RAJAPERF_INDEX_TYPES(INDEX);
 
   POLYBENCH_GEMMVER(const RunParams& params);
 
   ~POLYBENCH_GEMMVER();
 
+  double getBytesPerRep() const;
+  double getFLOPsPerRep() const;
+  double getFusedBytesPerRep() const;
 
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
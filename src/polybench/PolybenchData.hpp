@@ -0,0 +1,83 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-738930
+//
+// All rights reserved.
+//
+// This file is part of the RAJA Performance Suite.
+//
+// For details about use and distribution, please read raja-perfsuite/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJAPerf_PolybenchData_HPP
+#define RAJAPerf_PolybenchData_HPP
+
+#include "common/RAJAPerfSuite.hpp"
+#include "common/RPTypes.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+//
+// Tiled variants run each matrix product C[i][j] += A[i][k] * B[k][j] as 
+// a loop nest over tiles of all three loops, in i, j, k order, and then 
+// over the entries of a tile in i, k, j order, so the innermost loop runs 
+// along rows of B and C. Since k tiles run in order for each entry of C, 
+// sums are accumulated in the same order as in untiled variants.
+//
+// Policy for RAJA tiled variants; lambda arguments are (i, j, k) and the
+// execution policy applies to the i loop within a tile.
+//
+template <typename EXEC_POL>
+using TiledMatMulPolicy = 
+  RAJA::NestedPolicy<RAJA::ExecList<EXEC_POL, 
+                                    RAJA::seq_exec, 
+                                    RAJA::seq_exec>,
+                     RAJA::Tile<RAJA::TileList<
+                                  RAJA::tile_fixed<RAJAPERF_RAJA_TILE_SIZE>,
+                                  RAJA::tile_fixed<RAJAPERF_RAJA_TILE_SIZE>,
+                                  RAJA::tile_fixed<RAJAPERF_RAJA_TILE_SIZE>>,
+                                RAJA::Permute<RAJA::PERM_IKJ>>>;
+
+//
+// Number of tiles of RAJA tiled variants along a loop of length n, and 
+// range of tile t, for running tiles of a loop in parallel.
+//
+template <typename INDEX>
+INDEX getNumRAJATiles(INDEX n)
+{
+  return (n + RAJAPERF_RAJA_TILE_SIZE - 1) / RAJAPERF_RAJA_TILE_SIZE;
+}
+
+template <typename INDEX>
+RAJA::RangeSegment getRAJATileSegment(INDEX t, INDEX n)
+{
+  const INDEX tbegin = t * RAJAPERF_RAJA_TILE_SIZE;
+  const INDEX tend = tbegin + RAJAPERF_RAJA_TILE_SIZE;
+  return RAJA::RangeSegment(tbegin, tend < n ? tend : n);
+}
+
+//
+// Tile sizes of Base tiled variants, from run parameters.
+//
+#define POLYBENCH_TILE_SIZES \
+  const Index_type ti = run_params.getTileSize(0); \
+  const Index_type tj = run_params.getTileSize(1); \
+  const Index_type tk = run_params.getTileSize(2);
+
+}  // end namespace polybench
+}  // end namespace rajaperf
+
+#endif  // closing endif for header file include guard
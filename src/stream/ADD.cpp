@@ -24,6 +24,8 @@
 #include "ADD.hpp"
 
 #include "common/DataUtils.hpp"
+#include "common/StdPar.hpp"
+#include "common/SimdIntrinsics.hpp"
 
 #include "RAJA/RAJA.hpp"
 #include "RAJA/util/defines.hpp"
@@ -43,6 +45,9 @@ namespace stream
 #define ADD_BODY  \
   c[i] = a[i] + b[i];
 
+#define ADD_SIMD_BODY  \
+  ( Vec::load(a+i) + Vec::load(b+i) ).store(c+i);
+
 
 #if defined(RAJA_ENABLE_CUDA)
 
@@ -79,27 +84,47 @@ __global__ void add(Real_ptr c, Real_ptr a, Real_ptr b,
 #endif // if defined(RAJA_ENABLE_CUDA)
 
 
-ADD::ADD(const RunParams& params)
+template <typename REAL, typename INDEX>
+ADD<REAL, INDEX>::ADD(const RunParams& params)
   : KernelBase(rajaperf::Stream_ADD, params)
 {
    setDefaultSize(1000000);
    setDefaultReps(1000);
+
+#if defined(RAJAPERF_ENABLE_STDPAR)
+   setVariantDefined(Base_StdPar);
+#endif
+}
+
+template <typename REAL, typename INDEX>
+ADD<REAL, INDEX>::~ADD() 
+{
+}
+
+template <typename REAL, typename INDEX>
+double ADD<REAL, INDEX>::getBytesPerRep() const
+{
+  return 3.0 * sizeof(Real_type) * getRunSize();
 }
 
-ADD::~ADD() 
+template <typename REAL, typename INDEX>
+double ADD<REAL, INDEX>::getFLOPsPerRep() const
 {
+  return 1.0 * getRunSize();
 }
 
-void ADD::setUp(VariantID vid)
+template <typename REAL, typename INDEX>
+void ADD<REAL, INDEX>::setUp(VariantID vid)
 {
   allocAndInitData(m_a, getRunSize(), vid);
   allocAndInitData(m_b, getRunSize(), vid);
   allocAndInitData(m_c, getRunSize(), vid);
 }
 
-void ADD::runKernel(VariantID vid)
+template <typename REAL, typename INDEX>
+void ADD<REAL, INDEX>::runKernel(VariantID vid)
 {
-  const Index_type run_reps = getRunReps();
+  const Index_type run_reps = getBatchReps();
   const Index_type ibegin = 0;
   const Index_type iend = getRunSize();
 
@@ -140,6 +165,90 @@ void ADD::runKernel(VariantID vid)
       break;
     }
 
+    case Base_Simd : {
+
+      ADD_DATA;
+
+#if defined(RAJAPERF_HAVE_SIMD_INTRINSICS)
+      typedef SimdVec<Real_type> Vec;
+#endif
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+#if defined(RAJAPERF_HAVE_SIMD_INTRINSICS)
+        forallSimd<Vec>(ibegin, iend,
+          [=](Index_type i) { ADD_SIMD_BODY; },
+          [=](Index_type i) { ADD_BODY; });
+#else
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ADD_BODY;
+        }
+#endif
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Simd : {
+
+      ADD_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          ADD_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_ThreadPool : {
+
+      ADD_DATA;
+
+      ThreadPool& pool = getThreadPool();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        pool.forall(ibegin, iend, [=](Index_type i) {
+          ADD_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RAJAPERF_ENABLE_STDPAR)
+    case Base_StdPar : {
+
+      ADD_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        std::transform(std::execution::par_unseq,
+                       a + ibegin, a + iend, b + ibegin, c + ibegin,
+                       [=](Real_type ai, Real_type bi) { return ai + bi; });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_OPENMP)
     case Base_OpenMP : {
 
@@ -185,7 +294,7 @@ void ADD::runKernel(VariantID vid)
 
       ADD_DATA;
 
-      int n = getRunSize();
+      Index_type n = getRunSize();
       #pragma omp target enter data map(to:a[0:n],b[0:n],c[0:n])
 
       startTimer();
@@ -208,7 +317,7 @@ void ADD::runKernel(VariantID vid)
 
       ADD_DATA;
 
-      int n = getRunSize();
+      Index_type n = getRunSize();
       #pragma omp target enter data map(to:a[0:n],b[0:n],c[0:n])
 
       startTimer();
@@ -230,6 +339,46 @@ void ADD::runKernel(VariantID vid)
 #endif //RAJA_ENABLE_TARGET_OPENMP
 #endif //RAJA_ENABLE_OMP                             
 
+#if defined(RAJA_ENABLE_TBB)
+    case Base_TBB : {
+
+      ADD_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(ibegin, iend),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            ADD_BODY;
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_TBB : {
+
+      ADD_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::tbb_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          ADD_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
     case Base_CUDA : {
 
@@ -279,12 +428,14 @@ void ADD::runKernel(VariantID vid)
 
 }
 
-void ADD::updateChecksum(VariantID vid)
+template <typename REAL, typename INDEX>
+void ADD<REAL, INDEX>::updateChecksum(VariantID vid)
 {
   checksum[vid] += calcChecksum(m_c, getRunSize());
 }
 
-void ADD::tearDown(VariantID vid)
+template <typename REAL, typename INDEX>
+void ADD<REAL, INDEX>::tearDown(VariantID vid)
 {
   (void) vid;
   deallocData(m_a);
@@ -292,5 +443,7 @@ void ADD::tearDown(VariantID vid)
   deallocData(m_c);
 }
 
+RAJAPERF_INSTANTIATE_KERNEL(ADD);
+
 } // end namespace stream
 } // end namespace rajaperf
@@ -26,14 +26,20 @@ class RunParams;
 namespace stream
 {
 
+template <typename REAL, typename INDEX>
 class ADD : public KernelBase
 {
 public:
+  RAJAPERF_REAL_TYPES(REAL);
+  RAJAPERF_INDEX_TYPES(INDEX);
 
   ADD(const RunParams& params);
 
   ~ADD();
 
+  double getBytesPerRep() const;
+  double getFLOPsPerRep() const;
+
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
   void updateChecksum(VariantID vid);
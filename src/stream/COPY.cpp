@@ -24,6 +24,9 @@
 #include "COPY.hpp"
 
 #include "common/DataUtils.hpp"
+#include "common/StdPar.hpp"
+#include "common/SimdIntrinsics.hpp"
+#include "common/StreamingStores.hpp"
 
 #include "RAJA/RAJA.hpp"
 
@@ -41,6 +44,18 @@ namespace stream
 #define COPY_BODY  \
   c[i] = a[i] ;
 
+#define COPY_SIMD_BODY  \
+  Vec::load(a+i).store(c+i);
+
+//
+// Value stored by COPY_BODY, for *_NTStore variants.
+//
+#define COPY_VALUE  \
+  a[i]
+
+#define COPY_NT_OUTPUTS  \
+  Real_ptr const nt_out[1] = { c };
+
 
 #if defined(RAJA_ENABLE_CUDA)
 
@@ -74,26 +89,61 @@ __global__ void copy(Real_ptr c, Real_ptr a,
 #endif // if defined(RAJA_ENABLE_CUDA)
 
 
-COPY::COPY(const RunParams& params)
+template <typename REAL, typename INDEX>
+COPY<REAL, INDEX>::COPY(const RunParams& params)
   : KernelBase(rajaperf::Stream_COPY, params)
 {
    setDefaultSize(1000000);
    setDefaultReps(1800);
+
+#if defined(RAJAPERF_ENABLE_STDPAR)
+   setVariantDefined(Base_StdPar);
+#endif
+
+#if defined(RAJAPERF_HAVE_NT_STORES)
+   setVariantDefined(Base_Seq_NTStore);
+   setVariantDefined(RAJA_Seq_NTStore);
+#if defined(RAJA_ENABLE_OPENMP)
+   setVariantDefined(Base_OpenMP_NTStore);
+   setVariantDefined(RAJA_OpenMP_NTStore);
+#endif
+#endif
 }
 
-COPY::~COPY() 
+template <typename REAL, typename INDEX>
+COPY<REAL, INDEX>::~COPY() 
 {
 }
 
-void COPY::setUp(VariantID vid)
+template <typename REAL, typename INDEX>
+double COPY<REAL, INDEX>::getBytesPerRep() const
+{
+  return 2.0 * sizeof(Real_type) * getRunSize();
+}
+
+template <typename REAL, typename INDEX>
+double COPY<REAL, INDEX>::getBytesWrittenPerRep() const
+{
+  return 1.0 * sizeof(Real_type) * getRunSize();
+}
+
+template <typename REAL, typename INDEX>
+double COPY<REAL, INDEX>::getFLOPsPerRep() const
+{
+  return 0.0;
+}
+
+template <typename REAL, typename INDEX>
+void COPY<REAL, INDEX>::setUp(VariantID vid)
 {
   allocAndInitData(m_a, getRunSize(), vid);
   allocAndInitData(m_c, getRunSize(), vid);
 }
 
-void COPY::runKernel(VariantID vid)
+template <typename REAL, typename INDEX>
+void COPY<REAL, INDEX>::runKernel(VariantID vid)
 {
-  const Index_type run_reps = getRunReps();
+  const Index_type run_reps = getBatchReps();
   const Index_type ibegin = 0;
   const Index_type iend = getRunSize();
 
@@ -134,6 +184,128 @@ void COPY::runKernel(VariantID vid)
       break;
     }
 
+    case Base_Simd : {
+
+      COPY_DATA;
+
+#if defined(RAJAPERF_HAVE_SIMD_INTRINSICS)
+      typedef SimdVec<Real_type> Vec;
+#endif
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+#if defined(RAJAPERF_HAVE_SIMD_INTRINSICS)
+        forallSimd<Vec>(ibegin, iend,
+          [=](Index_type i) { COPY_SIMD_BODY; },
+          [=](Index_type i) { COPY_BODY; });
+#else
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          COPY_BODY;
+        }
+#endif
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Simd : {
+
+      COPY_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          COPY_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RAJAPERF_HAVE_NT_STORES)
+    case Base_Seq_NTStore : {
+
+      COPY_DATA;
+      COPY_NT_OUTPUTS;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        ntStoreRange(nt_out, ibegin, iend, [=](Index_type i) {
+          return COPY_VALUE;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq_NTStore : {
+
+      COPY_DATA;
+      COPY_NT_OUTPUTS;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        forallNTStore<RAJA::seq_exec>(nt_out, ibegin, iend, 
+          [=](Index_type i) {
+          return COPY_VALUE;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
+    case Base_ThreadPool : {
+
+      COPY_DATA;
+
+      ThreadPool& pool = getThreadPool();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        pool.forall(ibegin, iend, [=](Index_type i) {
+          COPY_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RAJAPERF_ENABLE_STDPAR)
+    case Base_StdPar : {
+
+      COPY_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        std::copy(std::execution::par_unseq,
+                  a + ibegin, a + iend, c + ibegin);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_OPENMP)
     case Base_OpenMP : {
 
@@ -171,6 +343,52 @@ void COPY::runKernel(VariantID vid)
       break;
     }
 
+#if defined(RAJAPERF_HAVE_NT_STORES)
+    case Base_OpenMP_NTStore : {
+
+      COPY_DATA;
+      COPY_NT_OUTPUTS;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          Index_type cbegin, cend;
+          getNTStoreChunk<Real_type>(ibegin, iend, 
+                                     omp_get_num_threads(), 
+                                     omp_get_thread_num(), cbegin, cend);
+          ntStoreRange(nt_out, cbegin, cend, [=](Index_type i) {
+            return COPY_VALUE;
+          });
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP_NTStore : {
+
+      COPY_DATA;
+      COPY_NT_OUTPUTS;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        forallNTStore<RAJA::omp_parallel_for_exec>(nt_out, ibegin, iend, 
+          [=](Index_type i) {
+          return COPY_VALUE;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
 
 #define NUMTEAMS 128
@@ -179,7 +397,7 @@ void COPY::runKernel(VariantID vid)
 
       COPY_DATA;
 
-      int n = getRunSize();
+      Index_type n = getRunSize();
       #pragma omp target enter data map(to:a[0:n],c[0:n])
 
       startTimer();
@@ -202,7 +420,7 @@ void COPY::runKernel(VariantID vid)
 
       COPY_DATA;
 
-      int n = getRunSize();
+      Index_type n = getRunSize();
       #pragma omp target enter data map(to:a[0:n],c[0:n])
 
       startTimer();
@@ -224,6 +442,46 @@ void COPY::runKernel(VariantID vid)
 #endif //RAJA_ENABLE_TARGET_OPENMP
 #endif //RAJA_ENABLE_OMP                             
 
+#if defined(RAJA_ENABLE_TBB)
+    case Base_TBB : {
+
+      COPY_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(ibegin, iend),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            COPY_BODY;
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_TBB : {
+
+      COPY_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::tbb_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          COPY_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
     case Base_CUDA : {
 
@@ -273,17 +531,21 @@ void COPY::runKernel(VariantID vid)
 
 }
 
-void COPY::updateChecksum(VariantID vid)
+template <typename REAL, typename INDEX>
+void COPY<REAL, INDEX>::updateChecksum(VariantID vid)
 {
   checksum[vid] += calcChecksum(m_c, getRunSize());
 }
 
-void COPY::tearDown(VariantID vid)
+template <typename REAL, typename INDEX>
+void COPY<REAL, INDEX>::tearDown(VariantID vid)
 {
   (void) vid;
   deallocData(m_a);
   deallocData(m_c);
 }
 
+RAJAPERF_INSTANTIATE_KERNEL(COPY);
+
 } // end namespace stream
 } // end namespace rajaperf
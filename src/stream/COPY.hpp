@@ -26,14 +26,21 @@ class RunParams;
 namespace stream
 {
 
+template <typename REAL, typename INDEX>
 class COPY : public KernelBase
 {
 public:
+  RAJAPERF_REAL_TYPES(REAL);
+  RAJAPERF_INDEX_TYPES(INDEX);
 
   COPY(const RunParams& params);
 
   ~COPY();
 
+  double getBytesPerRep() const;
+  double getBytesWrittenPerRep() const;
+  double getFLOPsPerRep() const;
+
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
   void updateChecksum(VariantID vid);
@@ -28,11 +28,16 @@
 #include "DOT.hpp"
 
 #include "common/DataUtils.hpp"
+#include "common/StdPar.hpp"
+#include "common/SimdIntrinsics.hpp"
 
 #include "RAJA/RAJA.hpp"
 #include "RAJA/policy/cuda.hpp"
 
+#include <algorithm>
+#include <functional>
 #include <iostream>
+#include <vector>
 
 #define USE_THRUST
 //#undef USE_THRUST
@@ -55,6 +60,9 @@ namespace stream
 #define DOT_BODY  \
   dot += a[i] * b[i] ;
 
+#define DOT_SIMD_BODY  \
+  vdot = vdot + Vec::load(a+i) * Vec::load(b+i);
+
 
 #if defined(RAJA_ENABLE_CUDA)
 
@@ -115,18 +123,37 @@ __global__ void dot(Real_ptr a, Real_ptr b,
 #endif // if defined(RAJA_ENABLE_CUDA)
 
 
-DOT::DOT(const RunParams& params)
+template <typename REAL, typename INDEX>
+DOT<REAL, INDEX>::DOT(const RunParams& params)
   : KernelBase(rajaperf::Stream_DOT, params)
 {
    setDefaultSize(1000000);
    setDefaultReps(2000);
+
+#if defined(RAJAPERF_ENABLE_STDPAR)
+   setVariantDefined(Base_StdPar);
+#endif
+}
+
+template <typename REAL, typename INDEX>
+DOT<REAL, INDEX>::~DOT() 
+{
+}
+
+template <typename REAL, typename INDEX>
+double DOT<REAL, INDEX>::getBytesPerRep() const
+{
+  return 2.0 * sizeof(Real_type) * getRunSize();
 }
 
-DOT::~DOT() 
+template <typename REAL, typename INDEX>
+double DOT<REAL, INDEX>::getFLOPsPerRep() const
 {
+  return 2.0 * getRunSize();
 }
 
-void DOT::setUp(VariantID vid)
+template <typename REAL, typename INDEX>
+void DOT<REAL, INDEX>::setUp(VariantID vid)
 {
   allocAndInitData(m_a, getRunSize(), vid);
   allocAndInitData(m_b, getRunSize(), vid);
@@ -135,9 +162,10 @@ void DOT::setUp(VariantID vid)
   m_dot_init = 0.0;
 }
 
-void DOT::runKernel(VariantID vid)
+template <typename REAL, typename INDEX>
+void DOT<REAL, INDEX>::runKernel(VariantID vid)
 {
-  const Index_type run_reps = getRunReps();
+  const Index_type run_reps = getBatchReps();
   const Index_type ibegin = 0;
   const Index_type iend = getRunSize();
 
@@ -186,6 +214,120 @@ void DOT::runKernel(VariantID vid)
       break;
     }
 
+    case Base_Simd : {
+
+      DOT_DATA;
+
+#if defined(RAJAPERF_HAVE_SIMD_INTRINSICS)
+      typedef SimdVec<Real_type> Vec;
+#endif
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type dot = m_dot_init;
+
+#if defined(RAJAPERF_HAVE_SIMD_INTRINSICS)
+        Vec vdot = Vec::zero();
+        forallSimd<Vec>(ibegin, iend,
+          [&](Index_type i) { DOT_SIMD_BODY; },
+          [&](Index_type i) { DOT_BODY; });
+        dot += simdSum(vdot);
+#else
+        RAJAPERF_SIMD_REDUCE(reduction(+:dot))
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          DOT_BODY;
+        }
+#endif
+
+         m_dot += dot;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Simd : {
+
+      DOT_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::ReduceSum<RAJA::seq_reduce, Real_type> dot(m_dot_init);
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          DOT_BODY;
+        });
+
+        m_dot += static_cast<Real_type>(dot.get());
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Base_ThreadPool : {
+
+      DOT_DATA;
+
+      ThreadPool& pool = getThreadPool();
+      std::vector<Real_type> dot_part(pool.getNumThreads());
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        std::fill(dot_part.begin(), dot_part.end(), 0.0);
+        Real_type* dot_thread = &dot_part[0];
+
+        pool.forallChunks(ibegin, iend,
+          [=](Index_type cbegin, Index_type cend, int tid) {
+          Real_type dot = 0.0;
+          for (Index_type i = cbegin; i < cend; ++i ) {
+            DOT_BODY;
+          }
+          dot_thread[tid] += dot;
+        });
+
+        Real_type dot = m_dot_init;
+        for (size_t t = 0; t < dot_part.size(); ++t) {
+          dot += dot_part[t];
+        }
+
+        m_dot += dot;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RAJAPERF_ENABLE_STDPAR)
+    case Base_StdPar : {
+
+      DOT_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type dot = m_dot_init;
+
+        dot += std::transform_reduce(std::execution::par_unseq,
+                                     a + ibegin, a + iend, b + ibegin, 
+                                     Real_type(0.0));
+
+        m_dot += dot;
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_OPENMP)
     case Base_OpenMP : {
 
@@ -239,7 +381,7 @@ void DOT::runKernel(VariantID vid)
 
       DOT_DATA;
 
-      int n = getRunSize();
+      Index_type n = getRunSize();
       #pragma omp target enter data map(to:a[0:n],b[0:n])
 
       startTimer();
@@ -267,7 +409,7 @@ void DOT::runKernel(VariantID vid)
 
       DOT_DATA;
 
-      int n = getRunSize();
+      Index_type n = getRunSize();
       #pragma omp target enter data map(to:a[0:n],b[0:n])
 
       startTimer();
@@ -293,6 +435,56 @@ void DOT::runKernel(VariantID vid)
 #endif //RAJA_ENABLE_TARGET_OPENMP
 #endif //RAJA_ENABLE_OMP                             
 
+#if defined(RAJA_ENABLE_TBB)
+    case Base_TBB : {
+
+      DOT_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type dot = m_dot_init;
+
+        dot += tbb::parallel_reduce(
+          tbb::blocked_range<Index_type>(ibegin, iend), Real_type(0.0),
+          [=](const tbb::blocked_range<Index_type>& r, Real_type dot) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            DOT_BODY;
+          }
+          return dot;
+        }, std::plus<Real_type>());
+
+        m_dot += dot;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_TBB : {
+
+      DOT_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::ReduceSum<RAJA::tbb_reduce, Real_type> dot(m_dot_init);
+
+        RAJA::forall<RAJA::tbb_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          DOT_BODY;
+        });
+
+        m_dot += dot;
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
     case Base_CUDA : {
 
@@ -376,17 +568,21 @@ void DOT::runKernel(VariantID vid)
 
 }
 
-void DOT::updateChecksum(VariantID vid)
+template <typename REAL, typename INDEX>
+void DOT<REAL, INDEX>::updateChecksum(VariantID vid)
 {
   checksum[vid] += m_dot;
 }
 
-void DOT::tearDown(VariantID vid)
+template <typename REAL, typename INDEX>
+void DOT<REAL, INDEX>::tearDown(VariantID vid)
 {
   (void) vid;
   deallocData(m_a);
   deallocData(m_b);
 }
 
+RAJAPERF_INSTANTIATE_KERNEL(DOT);
+
 } // end namespace stream
 } // end namespace rajaperf
@@ -24,6 +24,9 @@
 #include "MUL.hpp"
 
 #include "common/DataUtils.hpp"
+#include "common/StdPar.hpp"
+#include "common/SimdIntrinsics.hpp"
+#include "common/StreamingStores.hpp"
 
 #include "RAJA/RAJA.hpp"
 
@@ -42,6 +45,18 @@ namespace stream
 #define MUL_BODY  \
   b[i] = alpha * c[i] ;
 
+#define MUL_SIMD_BODY  \
+  ( valpha * Vec::load(c+i) ).store(b+i);
+
+//
+// Value stored by MUL_BODY, for *_NTStore variants.
+//
+#define MUL_VALUE  \
+  alpha * c[i]
+
+#define MUL_NT_OUTPUTS  \
+  Real_ptr const nt_out[1] = { b };
+
 
 #if defined(RAJA_ENABLE_CUDA)
 
@@ -76,28 +91,63 @@ __global__ void mul(Real_ptr b, Real_ptr c, Real_type alpha,
 #endif // if defined(RAJA_ENABLE_CUDA)
 
 
-MUL::MUL(const RunParams& params)
+template <typename REAL, typename INDEX>
+MUL<REAL, INDEX>::MUL(const RunParams& params)
   : KernelBase(rajaperf::Stream_MUL, params)
 {
    setDefaultSize(1000000);
    setDefaultReps(1800);
+
+#if defined(RAJAPERF_ENABLE_STDPAR)
+   setVariantDefined(Base_StdPar);
+#endif
+
+#if defined(RAJAPERF_HAVE_NT_STORES)
+   setVariantDefined(Base_Seq_NTStore);
+   setVariantDefined(RAJA_Seq_NTStore);
+#if defined(RAJA_ENABLE_OPENMP)
+   setVariantDefined(Base_OpenMP_NTStore);
+   setVariantDefined(RAJA_OpenMP_NTStore);
+#endif
+#endif
 }
 
-MUL::~MUL() 
+template <typename REAL, typename INDEX>
+MUL<REAL, INDEX>::~MUL() 
 {
 
 }
 
-void MUL::setUp(VariantID vid)
+template <typename REAL, typename INDEX>
+double MUL<REAL, INDEX>::getBytesPerRep() const
+{
+  return 2.0 * sizeof(Real_type) * getRunSize();
+}
+
+template <typename REAL, typename INDEX>
+double MUL<REAL, INDEX>::getBytesWrittenPerRep() const
+{
+  return 1.0 * sizeof(Real_type) * getRunSize();
+}
+
+template <typename REAL, typename INDEX>
+double MUL<REAL, INDEX>::getFLOPsPerRep() const
+{
+  return 1.0 * getRunSize();
+}
+
+template <typename REAL, typename INDEX>
+void MUL<REAL, INDEX>::setUp(VariantID vid)
 {
   allocAndInitData(m_b, getRunSize(), vid);
   allocAndInitData(m_c, getRunSize(), vid);
   initData(m_alpha, vid);
 }
 
-void MUL::runKernel(VariantID vid)
+template <typename REAL, typename INDEX>
+void MUL<REAL, INDEX>::runKernel(VariantID vid)
 {
-  const Index_type run_reps = getRunReps();
+  const Index_type run_reps = getBatchReps();
   const Index_type ibegin = 0;
   const Index_type iend = getRunSize();
 
@@ -138,6 +188,130 @@ void MUL::runKernel(VariantID vid)
       break;
     }
 
+    case Base_Simd : {
+
+      MUL_DATA;
+
+#if defined(RAJAPERF_HAVE_SIMD_INTRINSICS)
+      typedef SimdVec<Real_type> Vec;
+      const Vec valpha = Vec::set1(alpha);
+#endif
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+#if defined(RAJAPERF_HAVE_SIMD_INTRINSICS)
+        forallSimd<Vec>(ibegin, iend,
+          [=](Index_type i) { MUL_SIMD_BODY; },
+          [=](Index_type i) { MUL_BODY; });
+#else
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          MUL_BODY;
+        }
+#endif
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Simd : {
+
+      MUL_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          MUL_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RAJAPERF_HAVE_NT_STORES)
+    case Base_Seq_NTStore : {
+
+      MUL_DATA;
+      MUL_NT_OUTPUTS;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        ntStoreRange(nt_out, ibegin, iend, [=](Index_type i) {
+          return MUL_VALUE;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq_NTStore : {
+
+      MUL_DATA;
+      MUL_NT_OUTPUTS;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        forallNTStore<RAJA::seq_exec>(nt_out, ibegin, iend, 
+          [=](Index_type i) {
+          return MUL_VALUE;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
+    case Base_ThreadPool : {
+
+      MUL_DATA;
+
+      ThreadPool& pool = getThreadPool();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        pool.forall(ibegin, iend, [=](Index_type i) {
+          MUL_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RAJAPERF_ENABLE_STDPAR)
+    case Base_StdPar : {
+
+      MUL_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        std::transform(std::execution::par_unseq,
+                       c + ibegin, c + iend, b + ibegin,
+                       [=](Real_type ci) { return alpha * ci; });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_OPENMP)
     case Base_OpenMP : {
 
@@ -175,6 +349,52 @@ void MUL::runKernel(VariantID vid)
       break;
     }
 
+#if defined(RAJAPERF_HAVE_NT_STORES)
+    case Base_OpenMP_NTStore : {
+
+      MUL_DATA;
+      MUL_NT_OUTPUTS;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          Index_type cbegin, cend;
+          getNTStoreChunk<Real_type>(ibegin, iend, 
+                                     omp_get_num_threads(), 
+                                     omp_get_thread_num(), cbegin, cend);
+          ntStoreRange(nt_out, cbegin, cend, [=](Index_type i) {
+            return MUL_VALUE;
+          });
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP_NTStore : {
+
+      MUL_DATA;
+      MUL_NT_OUTPUTS;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        forallNTStore<RAJA::omp_parallel_for_exec>(nt_out, ibegin, iend, 
+          [=](Index_type i) {
+          return MUL_VALUE;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
 
 #define NUMTEAMS 128
@@ -183,7 +403,7 @@ void MUL::runKernel(VariantID vid)
 
       MUL_DATA;
 
-      int n = getRunSize();
+      Index_type n = getRunSize();
       #pragma omp target enter data map(to:b[0:n],c[0:n],alpha)
 
       startTimer();
@@ -206,7 +426,7 @@ void MUL::runKernel(VariantID vid)
 
       MUL_DATA;
 
-      int n = getRunSize();
+      Index_type n = getRunSize();
       #pragma omp target enter data map(to:b[0:n],c[0:n],alpha)
 
       startTimer();
@@ -228,6 +448,46 @@ void MUL::runKernel(VariantID vid)
 #endif //RAJA_ENABLE_TARGET_OPENMP
 #endif //RAJA_ENABLE_OPENMP
 
+#if defined(RAJA_ENABLE_TBB)
+    case Base_TBB : {
+
+      MUL_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(ibegin, iend),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            MUL_BODY;
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_TBB : {
+
+      MUL_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::tbb_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          MUL_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
     case Base_CUDA : {
 
@@ -277,17 +537,21 @@ void MUL::runKernel(VariantID vid)
 
 }
 
-void MUL::updateChecksum(VariantID vid)
+template <typename REAL, typename INDEX>
+void MUL<REAL, INDEX>::updateChecksum(VariantID vid)
 {
   checksum[vid] += calcChecksum(m_b, getRunSize());
 }
 
-void MUL::tearDown(VariantID vid)
+template <typename REAL, typename INDEX>
+void MUL<REAL, INDEX>::tearDown(VariantID vid)
 {
   (void) vid;
   deallocData(m_b);
   deallocData(m_c);
 }
 
+RAJAPERF_INSTANTIATE_KERNEL(MUL);
+
 } // end namespace stream
 } // end namespace rajaperf
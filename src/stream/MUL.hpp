@@ -26,14 +26,21 @@ class RunParams;
 namespace stream
 {
 
+template <typename REAL, typename INDEX>
 class MUL : public KernelBase
 {
 public:
+  RAJAPERF_REAL_TYPES(REAL);
+  RAJAPERF_INDEX_TYPES(INDEX);
 
   MUL(const RunParams& params);
 
   ~MUL();
 
+  double getBytesPerRep() const;
+  double getBytesWrittenPerRep() const;
+  double getFLOPsPerRep() const;
+
   void setUp(VariantID vid);
   void runKernel(VariantID vid); 
   void updateChecksum(VariantID vid);
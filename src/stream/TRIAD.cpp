@@ -24,6 +24,9 @@
 #include "TRIAD.hpp"
 
 #include "common/DataUtils.hpp"
+#include "common/StdPar.hpp"
+#include "common/SimdIntrinsics.hpp"
+#include "common/StreamingStores.hpp"
 
 #include "RAJA/RAJA.hpp"
 
@@ -43,6 +46,18 @@ namespace stream
 #define TRIAD_BODY  \
   a[i] = b[i] + alpha * c[i] ;
 
+#define TRIAD_SIMD_BODY  \
+  ( Vec::load(b+i) + valpha * Vec::load(c+i) ).store(a+i);
+
+//
+// Value stored by TRIAD_BODY, for *_NTStore variants.
+//
+#define TRIAD_VALUE  \
+  b[i] + alpha * c[i]
+
+#define TRIAD_NT_OUTPUTS  \
+  Real_ptr const nt_out[1] = { a };
+
 
 #if defined(RAJA_ENABLE_CUDA)
 
@@ -80,18 +95,52 @@ __global__ void triad(Real_ptr a, Real_ptr b, Real_ptr c, Real_type alpha,
 #endif // if defined(RAJA_ENABLE_CUDA)
 
 
-TRIAD::TRIAD(const RunParams& params)
+template <typename REAL, typename INDEX>
+TRIAD<REAL, INDEX>::TRIAD(const RunParams& params)
   : KernelBase(rajaperf::Stream_TRIAD, params)
 {
    setDefaultSize(1000000);
    setDefaultReps(1000);
+
+#if defined(RAJAPERF_ENABLE_STDPAR)
+   setVariantDefined(Base_StdPar);
+#endif
+
+#if defined(RAJAPERF_HAVE_NT_STORES)
+   setVariantDefined(Base_Seq_NTStore);
+   setVariantDefined(RAJA_Seq_NTStore);
+#if defined(RAJA_ENABLE_OPENMP)
+   setVariantDefined(Base_OpenMP_NTStore);
+   setVariantDefined(RAJA_OpenMP_NTStore);
+#endif
+#endif
 }
 
-TRIAD::~TRIAD() 
+template <typename REAL, typename INDEX>
+TRIAD<REAL, INDEX>::~TRIAD() 
 {
 }
 
-void TRIAD::setUp(VariantID vid)
+template <typename REAL, typename INDEX>
+double TRIAD<REAL, INDEX>::getBytesPerRep() const
+{
+  return 3.0 * sizeof(Real_type) * getRunSize();
+}
+
+template <typename REAL, typename INDEX>
+double TRIAD<REAL, INDEX>::getBytesWrittenPerRep() const
+{
+  return 1.0 * sizeof(Real_type) * getRunSize();
+}
+
+template <typename REAL, typename INDEX>
+double TRIAD<REAL, INDEX>::getFLOPsPerRep() const
+{
+  return 2.0 * getRunSize();
+}
+
+template <typename REAL, typename INDEX>
+void TRIAD<REAL, INDEX>::setUp(VariantID vid)
 {
   allocAndInitData(m_a, getRunSize(), vid);
   allocAndInitData(m_b, getRunSize(), vid);
@@ -99,9 +148,10 @@ void TRIAD::setUp(VariantID vid)
   initData(m_alpha, vid);
 }
 
-void TRIAD::runKernel(VariantID vid)
+template <typename REAL, typename INDEX>
+void TRIAD<REAL, INDEX>::runKernel(VariantID vid)
 {
-  const Index_type run_reps = getRunReps();
+  const Index_type run_reps = getBatchReps();
   const Index_type ibegin = 0;
   const Index_type iend = getRunSize();
 
@@ -142,6 +192,132 @@ void TRIAD::runKernel(VariantID vid)
       break;
     }
 
+    case Base_Simd : {
+
+      TRIAD_DATA;
+
+#if defined(RAJAPERF_HAVE_SIMD_INTRINSICS)
+      typedef SimdVec<Real_type> Vec;
+      const Vec valpha = Vec::set1(alpha);
+#endif
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+#if defined(RAJAPERF_HAVE_SIMD_INTRINSICS)
+        forallSimd<Vec>(ibegin, iend,
+          [=](Index_type i) { TRIAD_SIMD_BODY; },
+          [=](Index_type i) { TRIAD_BODY; });
+#else
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          TRIAD_BODY;
+        }
+#endif
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Simd : {
+
+      TRIAD_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          TRIAD_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RAJAPERF_HAVE_NT_STORES)
+    case Base_Seq_NTStore : {
+
+      TRIAD_DATA;
+      TRIAD_NT_OUTPUTS;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        ntStoreRange(nt_out, ibegin, iend, [=](Index_type i) {
+          return TRIAD_VALUE;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq_NTStore : {
+
+      TRIAD_DATA;
+      TRIAD_NT_OUTPUTS;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        forallNTStore<RAJA::seq_exec>(nt_out, ibegin, iend, 
+          [=](Index_type i) {
+          return TRIAD_VALUE;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
+    case Base_ThreadPool : {
+
+      TRIAD_DATA;
+
+      ThreadPool& pool = getThreadPool();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        pool.forall(ibegin, iend, [=](Index_type i) {
+          TRIAD_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RAJAPERF_ENABLE_STDPAR)
+    case Base_StdPar : {
+
+      TRIAD_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        std::transform(std::execution::par_unseq,
+                       b + ibegin, b + iend, c + ibegin, a + ibegin,
+                       [=](Real_type bi, Real_type ci) { 
+                         return bi + alpha * ci; 
+                       });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_OPENMP)
     case Base_OpenMP : {
 
@@ -179,6 +355,52 @@ void TRIAD::runKernel(VariantID vid)
       break;
     }
 
+#if defined(RAJAPERF_HAVE_NT_STORES)
+    case Base_OpenMP_NTStore : {
+
+      TRIAD_DATA;
+      TRIAD_NT_OUTPUTS;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          Index_type cbegin, cend;
+          getNTStoreChunk<Real_type>(ibegin, iend, 
+                                     omp_get_num_threads(), 
+                                     omp_get_thread_num(), cbegin, cend);
+          ntStoreRange(nt_out, cbegin, cend, [=](Index_type i) {
+            return TRIAD_VALUE;
+          });
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP_NTStore : {
+
+      TRIAD_DATA;
+      TRIAD_NT_OUTPUTS;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        forallNTStore<RAJA::omp_parallel_for_exec>(nt_out, ibegin, iend, 
+          [=](Index_type i) {
+          return TRIAD_VALUE;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
 
 #define NUMTEAMS 128
@@ -187,7 +409,7 @@ void TRIAD::runKernel(VariantID vid)
 
       TRIAD_DATA;
 
-      int n = getRunSize();
+      Index_type n = getRunSize();
       #pragma omp target enter data map(to:a[0:n],b[0:n],c[0:n],alpha)
 
       startTimer();
@@ -210,7 +432,7 @@ void TRIAD::runKernel(VariantID vid)
 
       TRIAD_DATA;
 
-      int n = getRunSize();
+      Index_type n = getRunSize();
       #pragma omp target enter data map(to:a[0:n],b[0:n],c[0:n],alpha)
 
       startTimer();
@@ -232,6 +454,46 @@ void TRIAD::runKernel(VariantID vid)
 #endif //RAJA_ENABLE_TARGET_OPENMP
 #endif //RAJA_ENABLE_OMP                             
 
+#if defined(RAJA_ENABLE_TBB)
+    case Base_TBB : {
+
+      TRIAD_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        tbb::parallel_for(tbb::blocked_range<Index_type>(ibegin, iend),
+          [=](const tbb::blocked_range<Index_type>& r) {
+          for (Index_type i = r.begin(); i < r.end(); ++i ) {
+            TRIAD_BODY;
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_TBB : {
+
+      TRIAD_DATA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::tbb_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          TRIAD_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
     case Base_CUDA : {
 
@@ -281,12 +543,14 @@ void TRIAD::runKernel(VariantID vid)
 
 }
 
-void TRIAD::updateChecksum(VariantID vid)
+template <typename REAL, typename INDEX>
+void TRIAD<REAL, INDEX>::updateChecksum(VariantID vid)
 {
   checksum[vid] += calcChecksum(m_a, getRunSize());
 }
 
-void TRIAD::tearDown(VariantID vid)
+template <typename REAL, typename INDEX>
+void TRIAD<REAL, INDEX>::tearDown(VariantID vid)
 {
   (void) vid;
   deallocData(m_a);
@@ -294,5 +558,7 @@ void TRIAD::tearDown(VariantID vid)
   deallocData(m_c);
 }
 
+RAJAPERF_INSTANTIATE_KERNEL(TRIAD);
+
 } // end namespace stream
 } // end namespace rajaperf